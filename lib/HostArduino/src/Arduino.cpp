@@ -0,0 +1,220 @@
+// Arduino.cpp - host implementation of the Arduino-ESP32 calls the firmware uses
+#include "HostArduino.h"
+#include "SPI.h"
+#include <stdarg.h>
+#include <poll.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+SPIClass SPI;
+
+// ---- Time ----
+static uint64_t virtualUs = 0;
+static bool     realClock = false;
+
+static uint64_t steadyUs() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static uint64_t nowUs() {
+  if (!realClock) return virtualUs;
+  static const uint64_t t0 = steadyUs();
+  return virtualUs + steadyUs() - t0;
+}
+
+unsigned long millis() { return (unsigned long)(uint32_t)(nowUs() / 1000); }
+unsigned long micros() { return (unsigned long)(uint32_t)nowUs(); }
+
+void delay(unsigned long ms) {
+  if (realClock) std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  else virtualUs += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+  if (!realClock) virtualUs += us;
+}
+
+void hostAdvanceMs(uint32_t ms) { virtualUs += (uint64_t)ms * 1000; }
+void hostAdvanceUs(uint32_t us) { virtualUs += us; }
+void hostUseRealClock(bool on) { realClock = on; }
+
+uint32_t EspClass::getCycleCount() { return (uint32_t)(steadyUs() * 240); }
+uint32_t getCpuFrequencyMhz() { return 240; }
+
+// ---- Pins ----
+static constexpr int PINS = 64;
+static int8_t   digitalIn[PINS];
+static bool     digitalSet[PINS];
+static int8_t   digitalOut[PINS] = {};
+static bool     outWritten[PINS];
+static uint16_t analogIn[PINS];
+static bool     analogSet[PINS];
+static void   (*isrs[PINS])();
+
+void pinMode(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= PINS || !digitalSet[pin]) return HIGH;
+  return digitalIn[pin];
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  if (pin >= PINS) return;
+  digitalOut[pin] = level ? HIGH : LOW;
+  outWritten[pin] = true;
+}
+
+// Unset inputs read 2000, a room-temperature NTC on the stock divider
+uint16_t analogRead(uint8_t pin) {
+  if (pin >= PINS || !analogSet[pin]) return 2000;
+  return analogIn[pin];
+}
+
+void analogReadResolution(uint8_t) {}
+void analogSetPinAttenuation(uint8_t, int) {}
+void tone(uint8_t, unsigned int, unsigned long) {}
+
+long map(long x, long inLo, long inHi, long outLo, long outHi) {
+  return (x - inLo) * (outHi - outLo) / (inHi - inLo) + outLo;
+}
+
+long random(long hi) { return hi > 0 ? rand() % hi : 0; }
+long random(long lo, long hi) { return hi > lo ? lo + rand() % (hi - lo) : lo; }
+
+uint32_t ledcSetup(uint8_t, uint32_t freq, uint8_t) { return freq; }
+void ledcAttachPin(uint8_t, uint8_t) {}
+void ledcWrite(uint8_t, uint32_t) {}
+
+int digitalPinToInterrupt(int pin) { return pin; }
+
+void attachInterrupt(int irq, void (*isr)(), int) {
+  if (irq >= 0 && irq < PINS) isrs[irq] = isr;
+}
+
+void detachInterrupt(int irq) {
+  if (irq >= 0 && irq < PINS) isrs[irq] = nullptr;
+}
+
+void noInterrupts() {}
+void interrupts() {}
+
+void hostSetDigital(uint8_t pin, int level) {
+  if (pin >= PINS) return;
+  digitalIn[pin] = level ? HIGH : LOW;
+  digitalSet[pin] = true;
+}
+
+void hostSetAnalog(uint8_t pin, uint16_t raw) {
+  if (pin >= PINS) return;
+  analogIn[pin] = raw;
+  analogSet[pin] = true;
+}
+
+int hostDigitalOut(uint8_t pin) {
+  return (pin < PINS && outWritten[pin]) ? digitalOut[pin] : -1;
+}
+
+bool hostFireInterrupt(uint8_t pin) {
+  if (pin >= PINS || !isrs[pin]) return false;
+  isrs[pin]();
+  return true;
+}
+
+// ---- Tasks ----
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t,
+                                   void* arg, UBaseType_t, TaskHandle_t* handle, int) {
+  std::thread(fn, arg).detach();
+  if (handle) *handle = nullptr;
+  return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+TickType_t xTaskGetTickCount() { return (TickType_t)millis(); }
+
+// ---- Print / Serial ----
+size_t Print::write(const uint8_t* buf, size_t n) {
+  size_t done = 0;
+  while (done < n && write(buf[done])) done++;
+  return done;
+}
+
+size_t Print::print(long v, int base) {
+  if (base == DEC) {
+    char b[24];
+    snprintf(b, sizeof(b), "%ld", v);
+    return write(b);
+  }
+  return print((unsigned long)v, base);
+}
+
+size_t Print::print(unsigned long v, int base) {
+  char b[40];
+  snprintf(b, sizeof(b), base == HEX ? "%lX" : "%lu", v);
+  return write(b);
+}
+
+size_t Print::print(double v, int digits) {
+  char b[48];
+  snprintf(b, sizeof(b), "%.*f", digits, v);
+  return write(b);
+}
+
+size_t Print::printf(const char* fmt, ...) {
+  char b[512];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(b, sizeof(b), fmt, ap);
+  va_end(ap);
+  if (n < 0) return 0;
+  return write((const uint8_t*)b, (size_t)n < sizeof(b) ? (size_t)n : sizeof(b) - 1);
+}
+
+static int         serialFd = STDOUT_FILENO;
+static std::string serialIn;
+
+void hostSerialAttach(int fd) { serialFd = fd; }
+void hostSerialInput(const char* bytes) { serialIn += bytes; }
+
+size_t HardwareSerial::write(const uint8_t* buf, size_t n) {
+  if (serialFd == STDOUT_FILENO) return fwrite(buf, 1, n, stdout);
+  ssize_t w = ::write(serialFd, buf, n);
+  return w > 0 ? (size_t)w : 0;
+}
+
+// Pulls whatever the attached fd already has into the queue, never waits
+static void pollSerialFd() {
+  if (serialFd == STDOUT_FILENO) return;
+  struct pollfd p = {serialFd, POLLIN, 0};
+  if (poll(&p, 1, 0) <= 0 || !(p.revents & POLLIN)) return;
+  uint8_t b[64];
+  ssize_t n = ::read(serialFd, b, sizeof(b));
+  if (n > 0) serialIn.append((const char*)b, n);
+}
+
+int HardwareSerial::available() {
+  if (serialIn.empty()) pollSerialFd();
+  return (int)serialIn.size();
+}
+
+int HardwareSerial::read() {
+  if (!available()) return -1;
+  int c = (uint8_t)serialIn[0];
+  serialIn.erase(0, 1);
+  return c;
+}
+
+int HardwareSerial::peek() {
+  return available() ? (uint8_t)serialIn[0] : -1;
+}
+
+void HardwareSerial::flush() {
+  if (serialFd == STDOUT_FILENO) fflush(stdout);
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <Arduino.h>
+
+// Controls for the host side of the shim: tests drive time, pins and
+// the serial port through these. Nothing here exists on the target.
+
+// Virtual clock (the default): millis()/micros() only move when told to,
+// delay() advances it. Real-clock mode follows the host's steady clock,
+// for the interactive host station.
+void hostAdvanceMs(uint32_t ms);
+void hostAdvanceUs(uint32_t us);
+void hostUseRealClock(bool on);
+
+// Input levels seen by digitalRead()/analogRead(); unset digital pins read HIGH
+void hostSetDigital(uint8_t pin, int level);
+void hostSetAnalog(uint8_t pin, uint16_t raw);
+// Last level written with digitalWrite(), -1 if never written
+int  hostDigitalOut(uint8_t pin);
+// Run the ISR attached to a pin; false when none is attached
+bool hostFireInterrupt(uint8_t pin);
+
+// Serial: output goes to fd (stdout by default) and input is read from it
+// when it is not stdout. hostSerialInput() queues bytes for read() instead.
+void hostSerialAttach(int fd);
+void hostSerialInput(const char* bytes);
+
+// LittleFS lives in a host directory: $HOST_FS_DIR, else a fresh
+// directory per process under /tmp. Failing removes exercise the
+// recorder's full-filesystem paths.
+const char* hostFsDir();
+void hostFsWipe();
+void hostFsFailRemove(bool fail);
@@ -0,0 +1,48 @@
+// HostMain.cpp - main() for the native program envs (built with -DHOST_MAIN)
+//   --pty       Serial on a fresh pseudo-terminal (its path is printed on
+//               stdout), real-time clock, runs until killed
+//   --loops N   call loop() N times on the virtual clock, then exit
+// Unity tests bring their own main() and leave HOST_MAIN undefined.
+#ifdef HOST_MAIN
+#include "HostArduino.h"
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+static int openPty() {
+  int m = posix_openpt(O_RDWR | O_NOCTTY);
+  if (m < 0 || grantpt(m) != 0 || unlockpt(m) != 0) return -1;
+  struct termios t;
+  tcgetattr(m, &t);
+  cfmakeraw(&t);
+  tcsetattr(m, TCSANOW, &t);
+  printf("%s\n", ptsname(m));
+  fflush(stdout);
+  return m;
+}
+
+int main(int argc, char** argv) {
+  bool pty = false;
+  long loops = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--pty")) pty = true;
+    else if (!strcmp(argv[i], "--loops") && i + 1 < argc) loops = atol(argv[++i]);
+    else { fprintf(stderr, "usage: %s [--pty] [--loops N]\n", argv[0]); return 2; }
+  }
+
+  if (pty) {
+    int fd = openPty();
+    if (fd < 0) { perror("pty"); return 1; }
+    hostSerialAttach(fd);
+    hostUseRealClock(true);
+  }
+
+  setup();
+  if (pty) {
+    for (;;) { loop(); usleep(1000); }
+  }
+  for (long i = 0; i < loops; i++) loop();
+  fflush(stdout);
+  return 0;
+}
+#endif
@@ -0,0 +1,153 @@
+// LittleFS.cpp - host directory backing for the LittleFS calls
+#include "LittleFS.h"
+#include "HostArduino.h"
+#include <unistd.h>
+#include <filesystem>
+
+namespace fsys = std::filesystem;
+
+LittleFSFS LittleFS;
+
+static bool failRemove = false;
+
+const char* hostFsDir() {
+  static std::string dir;
+  if (dir.empty()) {
+    const char* env = getenv("HOST_FS_DIR");
+    dir = env ? env : "/tmp/hostfs-" + std::to_string(getpid());
+    fsys::create_directories(dir);
+  }
+  return dir.c_str();
+}
+
+void hostFsWipe() {
+  std::error_code ec;
+  for (auto& e : fsys::directory_iterator(hostFsDir(), ec)) fsys::remove_all(e.path(), ec);
+}
+
+void hostFsFailRemove(bool fail) { failRemove = fail; }
+
+static std::string full(const char* path) {
+  return std::string(hostFsDir()) + (path[0] == '/' ? "" : "/") + path;
+}
+
+bool LittleFSFS::begin(bool) { hostFsDir(); return true; }
+bool LittleFSFS::format() { hostFsWipe(); return true; }
+
+bool LittleFSFS::exists(const char* path) {
+  std::error_code ec;
+  return fsys::exists(full(path), ec);
+}
+
+bool LittleFSFS::mkdir(const char* path) {
+  std::error_code ec;
+  fsys::create_directory(full(path), ec);
+  return !ec;
+}
+
+bool LittleFSFS::remove(const char* path) {
+  if (failRemove) return false;
+  std::error_code ec;
+  return fsys::is_regular_file(full(path), ec) && fsys::remove(full(path), ec);
+}
+
+bool LittleFSFS::rmdir(const char* path) {
+  std::error_code ec;
+  return fsys::is_directory(full(path), ec) && fsys::remove(full(path), ec);
+}
+
+bool LittleFSFS::rename(const char* from, const char* to) {
+  std::error_code ec;
+  fsys::rename(full(from), full(to), ec);
+  return !ec;
+}
+
+size_t LittleFSFS::usedBytes() {
+  size_t n = 0;
+  std::error_code ec;
+  for (auto& e : fsys::recursive_directory_iterator(hostFsDir(), ec))
+    if (e.is_regular_file(ec)) n += e.file_size(ec);
+  return n;
+}
+
+File LittleFSFS::open(const char* path, const char* mode) {
+  File f;
+  std::string p = full(path);
+  std::error_code ec;
+  auto h = std::make_shared<File::Handle>();
+  h->path = path;
+  h->name = fsys::path(path).filename().string();
+  if (fsys::is_directory(p, ec)) {
+    h->isDir = true;
+    for (auto& e : fsys::directory_iterator(p, ec)) h->entries.push_back(e.path().filename().string());
+    std::sort(h->entries.begin(), h->entries.end());
+  } else {
+    if (mode[0] == 'r' && !fsys::exists(p, ec)) return f;
+    h->fp = fopen(p.c_str(), (std::string(mode) + "b").c_str());
+    if (!h->fp) return f;
+  }
+  f.h_ = h;
+  return f;
+}
+
+size_t File::write(const uint8_t* buf, size_t n) {
+  return (h_ && h_->fp) ? fwrite(buf, 1, n, h_->fp) : 0;
+}
+
+size_t File::read(uint8_t* buf, size_t n) {
+  return (h_ && h_->fp) ? fread(buf, 1, n, h_->fp) : 0;
+}
+
+int File::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek() {
+  if (!h_ || !h_->fp) return -1;
+  int c = fgetc(h_->fp);
+  if (c != EOF) ungetc(c, h_->fp);
+  return c == EOF ? -1 : c;
+}
+
+int File::available() {
+  return (int)(size() - position());
+}
+
+void File::flush() {
+  if (h_ && h_->fp) fflush(h_->fp);
+}
+
+bool File::seek(uint32_t pos) {
+  return h_ && h_->fp && fseek(h_->fp, pos, SEEK_SET) == 0;
+}
+
+size_t File::position() const {
+  return (h_ && h_->fp) ? (size_t)ftell(h_->fp) : 0;
+}
+
+size_t File::size() const {
+  if (!h_ || !h_->fp) return 0;
+  long here = ftell(h_->fp);
+  fseek(h_->fp, 0, SEEK_END);
+  long end = ftell(h_->fp);
+  fseek(h_->fp, here, SEEK_SET);
+  return (size_t)end;
+}
+
+void File::close() {
+  if (h_ && h_->fp) { fclose(h_->fp); h_->fp = nullptr; }
+  h_.reset();
+}
+
+const char* File::name() const {
+  return h_ ? h_->name.c_str() : "";
+}
+
+File File::openNextFile() {
+  if (!h_ || !h_->isDir || h_->next >= h_->entries.size()) return File();
+  std::string child = h_->path;
+  if (child.empty() || child.back() != '/') child += '/';
+  child += h_->entries[h_->next++];
+  return LittleFS.open(child.c_str(), "r");
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <Arduino.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+// LittleFS on a host directory (see hostFsDir()). File is a shared handle
+// like the core's: copies refer to the same open file.
+class File : public Stream {
+public:
+  File() {}
+
+  operator bool() const { return h_ && (h_->fp || h_->isDir); }
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buf, size_t n) override;
+  using Print::write;
+  size_t read(uint8_t* buf, size_t n);
+  int read() override;
+  int peek() override;
+  int available() override;
+  void flush() override;
+
+  bool seek(uint32_t pos);
+  size_t position() const;
+  size_t size() const;
+  void close();
+
+  const char* name() const;        // last path component, as core 2.x returns it
+  const char* path() const { return h_ ? h_->path.c_str() : ""; }
+  bool isDirectory() const { return h_ && h_->isDir; }
+  File openNextFile();
+
+private:
+  friend class LittleFSFS;
+  struct Handle {
+    FILE* fp = nullptr;
+    bool  isDir = false;
+    std::string path, name;
+    std::vector<std::string> entries;
+    size_t next = 0;
+    ~Handle() { if (fp) fclose(fp); }
+  };
+  std::shared_ptr<Handle> h_;
+};
+
+class LittleFSFS {
+public:
+  bool begin(bool formatOnFail = false);
+  void end() {}
+  bool format();
+  bool exists(const char* path);
+  bool mkdir(const char* path);
+  bool remove(const char* path);
+  bool rename(const char* from, const char* to);
+  bool rmdir(const char* path);
+  File open(const char* path, const char* mode = "r");
+  size_t totalBytes() { return 1536 * 1024; }
+  size_t usedBytes();
+};
+
+extern LittleFSFS LittleFS;
@@ -0,0 +1,102 @@
+// Preferences.cpp - in-memory NVS for the host builds
+#include "Preferences.h"
+#include <map>
+#include <string>
+#include <vector>
+
+typedef std::map<std::string, std::vector<uint8_t>> NvsMap;
+
+static void save(const NvsMap& m) {
+  const char* path = getenv("HOST_NVS_FILE");
+  if (!path) return;
+  FILE* f = fopen(path, "w");
+  if (!f) return;
+  for (auto& e : m) {
+    fprintf(f, "%s %u", e.first.c_str(), (unsigned)e.second.size());
+    for (uint8_t b : e.second) fprintf(f, " %02x", b);
+    fputc('\n', f);
+  }
+  fclose(f);
+}
+
+static NvsMap& nvs() {
+  static NvsMap m;
+  static bool loaded = false;
+  if (!loaded) {
+    loaded = true;
+    const char* path = getenv("HOST_NVS_FILE");
+    FILE* f = path ? fopen(path, "r") : nullptr;
+    char key[64];
+    unsigned n;
+    while (f && fscanf(f, "%63s %u", key, &n) == 2) {
+      std::vector<uint8_t> v(n);
+      for (auto& b : v) { unsigned x = 0; if (fscanf(f, "%x", &x) != 1) break; b = (uint8_t)x; }
+      m[key] = v;
+    }
+    if (f) fclose(f);
+  }
+  return m;
+}
+
+static std::string fullKey(const char* ns, const char* key) {
+  return std::string(ns) + "/" + key;
+}
+
+bool Preferences::begin(const char* ns, bool readOnly) {
+  if (strlen(ns) >= sizeof(ns_)) return false;   // NVS caps names at 15 chars
+  strcpy(ns_, ns);
+  readOnly_ = readOnly;
+  open_ = true;
+  return true;
+}
+
+bool Preferences::clear() {
+  if (!open_ || readOnly_) return false;
+  std::string prefix = fullKey(ns_, "");
+  NvsMap& m = nvs();
+  for (auto it = m.begin(); it != m.end();) {
+    if (it->first.compare(0, prefix.size(), prefix) == 0) it = m.erase(it);
+    else ++it;
+  }
+  save(m);
+  return true;
+}
+
+bool Preferences::remove(const char* key) {
+  if (!open_ || readOnly_) return false;
+  bool had = nvs().erase(fullKey(ns_, key)) > 0;
+  save(nvs());
+  return had;
+}
+
+bool Preferences::isKey(const char* key) {
+  return open_ && nvs().count(fullKey(ns_, key)) > 0;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t n) {
+  if (!open_ || readOnly_ || strlen(key) > 15) return 0;
+  const uint8_t* p = (const uint8_t*)value;
+  nvs()[fullKey(ns_, key)] = std::vector<uint8_t>(p, p + n);
+  save(nvs());
+  return n;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  if (!open_) return 0;
+  auto it = nvs().find(fullKey(ns_, key));
+  return it == nvs().end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t cap) {
+  if (!open_) return 0;
+  auto it = nvs().find(fullKey(ns_, key));
+  if (it == nvs().end() || it->second.size() > cap) return 0;
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+uint16_t Preferences::getUShort(const char* key, uint16_t dflt) {
+  uint16_t v = dflt;
+  if (getBytesLength(key) == sizeof(v)) getBytes(key, &v, sizeof(v));
+  return v;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <Arduino.h>
+
+// NVS stand-in: one in-memory map for all namespaces. With $HOST_NVS_FILE
+// set it is loaded from and saved to that file, so settings survive a
+// restart of the host station.
+class Preferences {
+public:
+  bool begin(const char* ns, bool readOnly = false);
+  void end() { open_ = false; }
+
+  bool clear();
+  bool remove(const char* key);
+  bool isKey(const char* key);
+
+  size_t putBytes(const char* key, const void* value, size_t n);
+  size_t getBytes(const char* key, void* buf, size_t cap);
+  size_t getBytesLength(const char* key);
+  size_t putUShort(const char* key, uint16_t v) { return putBytes(key, &v, sizeof(v)); }
+  uint16_t getUShort(const char* key, uint16_t dflt = 0);
+
+private:
+  char ns_[16] = {};
+  bool open_ = false;
+  bool readOnly_ = false;
+};
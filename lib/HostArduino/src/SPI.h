@@ -0,0 +1,26 @@
+#pragma once
+#include <Arduino.h>
+
+#define MSBFIRST  1
+#define SPI_MODE0 0
+
+struct SPISettings {
+  SPISettings(uint32_t clock = 1000000, uint8_t order = MSBFIRST, uint8_t mode = SPI_MODE0) {
+    (void)clock; (void)order; (void)mode;
+  }
+};
+
+// No devices on the host bus: every transfer reads back zero. Sensor tests
+// replace the bus (ThermoBus) instead.
+class SPIClass {
+public:
+  void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {
+    (void)sck; (void)miso; (void)mosi; (void)ss;
+  }
+  void end() {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction() {}
+  uint8_t transfer(uint8_t) { return 0; }
+  uint16_t transfer16(uint16_t) { return 0; }
+};
+extern SPIClass SPI;
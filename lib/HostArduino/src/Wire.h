@@ -0,0 +1,9 @@
+#pragma once
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t freq = 0) { (void)sda; (void)scl; (void)freq; return true; }
+  void setClock(uint32_t hz) { (void)hz; }
+};
+extern TwoWire Wire;
@@ -0,0 +1,116 @@
+// Bench.cpp
+#include "Bench.h"
+#include "NtcSensor.h"
+#include "HampelFilter.h"
+#include "PlateEstimator.h"
+#include "HeaterController.h"
+#include "ProfileRunner.h"
+#include "UiScenes.h"
+#include "Clock.h"
+#include "Boards.h"
+
+static constexpr uint8_t BENCH_FORMAT = 1;
+
+// Results are folded into this so the compiler can't drop the work
+static volatile uint32_t g_sink = 0;
+
+static inline void sink(float v)    { g_sink = g_sink * 31u + (uint32_t)(int32_t)(v * 100.0f); }
+static inline void sink(uint32_t v) { g_sink = g_sink * 31u + v; }
+
+// Runs fn(i) for iters/8 warm-up rounds, then times iters rounds
+template <typename F>
+static uint32_t timeLoop(uint32_t iters, F fn) {
+  for (uint32_t i = 0; i < iters / 8; i++) fn(i);
+  uint32_t start = ESP.getCycleCount();
+  for (uint32_t i = 0; i < iters; i++) fn(i);
+  return ESP.getCycleCount() - start;
+}
+
+void Bench::report_(const char* name, uint32_t iters, uint32_t cycles) {
+  uint32_t perIter = cycles / iters;
+  uint32_t ns = (uint32_t)((uint64_t)cycles * 1000u / getCpuFrequencyMhz() / iters);
+  Serial.printf("BENCH,%s,%lu,%lu,%lu\n", name, (unsigned long)iters,
+                (unsigned long)perIter, (unsigned long)ns);
+  Serial.flush();
+}
+
+void Bench::run(DisplayUI& ui) {
+  Serial.printf("BENCH_BEGIN,%u,%lu\n", BENCH_FORMAT, (unsigned long)getCpuFrequencyMhz());
+
+  // Deterministic ADC-like input: slow ramp + noise + a spike every 61 samples
+  static uint16_t adc[256];
+  uint32_t lcg = 12345;
+  for (int i = 0; i < 256; i++) {
+    lcg = lcg * 1664525u + 1013904223u;
+    adc[i] = 1800 + i * 4 + ((lcg >> 24) & 15) + ((i % 61) == 0 ? 900 : 0);
+  }
+
+  // --- Sensor path ---
+  {
+    NtcSensor ntc(255);
+    uint32_t n = 20000;
+    report_("ntc_adc_to_temp", n, timeLoop(n, [&](uint32_t i) { sink(ntc.adcToTemp(adc[i & 255])); }));
+  }
+  {
+    HampelFilter<15> f;
+    f.configure(7, 3.0f);
+    uint32_t n = 20000;
+    report_("hampel_w7", n, timeLoop(n, [&](uint32_t i) { sink((uint32_t)f.filter(adc[i & 255])); }));
+    f.configure(15, 3.0f);
+    report_("hampel_w15", n, timeLoop(n, [&](uint32_t i) { sink((uint32_t)f.filter(adc[i & 255])); }));
+  }
+  {
+    PlateEstimator est;
+    est.begin(PlantParams{2.0f, 0.0017f, 4.0f, 25.0f}, 25.0f);
+    uint32_t n = 20000;
+    report_("estimator_update", n, timeLoop(n, [&](uint32_t i) {
+      est.update(25.0f + (i & 1023) * 0.2f, (i >> 4) & 63, 0.02f);
+      sink(est.tempC());
+    }));
+  }
+
+  // --- Control path ---
+  {
+    // PID plus the SSR window for one plate; drivePin() keeps the SSRs off here
+    HeaterController h;
+    h.begin(board.ssrFront, board.ssrBack, board.ssrWindowMs);
+    h.setGains({6.0f, 0.15f, 3.0f, 150.0f});
+    h.setMaxOutput(90);
+    uint32_t n = 20000;
+    report_("heater_control", n, timeLoop(n, [&](uint32_t i) {
+      h.control(HEAT_FRONT, 150.0f, 100.0f + (i & 127) * 0.5f, 0.0f);
+      sink((uint32_t)h.dutyFrontPct());
+    }));
+  }
+  {
+    ProfileRunner r;
+    r.begin(PROFILES[0]);
+    uint32_t t0 = clockMs();
+    uint32_t spanMs = r.durationSec() * 1000u;
+    uint32_t n = 20000;
+    report_("profile_update", n, timeLoop(n, [&](uint32_t i) {
+      bool finished;
+      sink(r.update(t0 + (i * 7919u) % spanMs, finished));
+    }));
+  }
+
+  // --- Display: buffer rendering only, then one screen with the I2C push ---
+  ui.setOutputEnabled(false);
+  const Profile& prof = PROFILES[0];
+  uint32_t n = 200;
+  int spanSec = prof.slots[prof.slotCount - 1].slotSecs;
+  report_("ui_profile_setup", n, timeLoop(n, [&](uint32_t) { ui.setupProfileDisplay(prof, spanSec); }));
+  for (uint8_t sc = 0; sc < UI_SCENE_COUNT; sc++) {
+    char name[32];
+    snprintf(name, sizeof(name), "ui_%s", uiSceneName(sc));
+    report_(name, n, timeLoop(n, [&](uint32_t i) { uiRenderScene(ui, sc, i); }));
+  }
+
+  ui.setOutputEnabled(true);
+  n = 20;
+  report_("ui_menu_i2c", n, timeLoop(n, [&](uint32_t i) {
+    uiRenderScene(ui, SCENE_MENU, i);
+  }));
+
+  Serial.printf("BENCH_END,%08lX\n", (unsigned long)g_sink);
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <Arduino.h>
+#include "DisplayUI.h"
+
+// Fixed-iteration microbenchmarks of the hot-path kernels.
+// Build the `bench` env (-DREFLOW_BENCH): setup() runs the suite once and
+// prints machine-readable lines, nothing else starts and the SSRs stay off.
+//   BENCH_BEGIN,<format>,<cpu_mhz>
+//   BENCH,<name>,<iters>,<cycles_per_iter>,<ns_per_iter>
+//   BENCH_END,<checksum>
+// Iteration counts are fixed so runs from different commits compare 1:1
+// (tools/bench_compare.py).
+class Bench {
+public:
+  static void run(DisplayUI& ui);
+
+private:
+  static void report_(const char* name, uint32_t iters, uint32_t cycles);
+};
@@ -0,0 +1,114 @@
+#pragma once
+#include <stdint.h>
+#include "NtcSensor.h"
+
+// Board descriptors: the pins and board-level constants of one hardware
+// revision in one constexpr struct. Each env in platformio.ini picks one
+// with -DBOARD=<descriptor> (default BOARD_DEVKIT_V1). The checks at the
+// bottom reject a descriptor whose pins clash or cannot do their job, at
+// compile time.
+static constexpr uint8_t PIN_NONE = 0xFF;
+
+struct BoardConfig {
+  const char* name;
+  uint8_t   zones;                          // heater zones (plates)
+  uint8_t   ssrFront, ssrBack;
+  uint16_t  ssrWindowMs;                    // SSR time-proportioning window
+  uint8_t   thermFront, thermBack;          // NTC dividers, ADC1 only (ADC2 stops under WiFi)
+  NtcParams ntc;
+  uint8_t   tcSck, tcMiso, tcCsFront, tcCsBack;   // thermocouple amplifiers (-DSENSOR_MAX*)
+  uint8_t   fan;
+  bool      fanActiveLow;                   // LOW at the fan input = on
+  uint32_t  fanPwmHz;
+  uint8_t   fanPwmBits;
+  uint8_t   fanLedcChannel;                 // core 2.x; tone() owns channel 0
+  uint8_t   tach;                           // PIN_NONE: no tach wired
+  uint8_t   buzzer;
+  uint8_t   encA, encB, encBtn;
+  uint8_t   i2cSda, i2cScl;
+};
+
+// ESP32 DevKit V1 as wired in the README
+static constexpr BoardConfig BOARD_DEVKIT_V1 = {
+  "devkit-v1", 2,
+  18, 5, 1000,
+  32, 33, NTC_100K_3950_6K8,
+  14, 27, 16, 17,
+  19, true, 25000, 8, 6,
+  26,
+  23,
+  34, 35, 25,
+  21, 22,
+};
+
+#ifndef BOARD
+#define BOARD BOARD_DEVKIT_V1
+#endif
+static constexpr const BoardConfig& board = BOARD;
+
+// ---- Compile-time checks ----
+namespace board_check {
+#if defined(SENSOR_MAX31855) || defined(SENSOR_MAX6675)
+constexpr bool USES_TC = true;
+#else
+constexpr bool USES_TC = false;
+#endif
+
+constexpr uint8_t used(uint8_t pin, bool inUse) { return inUse ? pin : PIN_NONE; }
+
+// Every pin the build drives or reads, PIN_NONE where not in use
+constexpr uint8_t PINS[] = {
+  board.ssrFront, board.ssrBack,
+  used(board.thermFront, !USES_TC), used(board.thermBack, !USES_TC),
+  used(board.tcSck, USES_TC), used(board.tcMiso, USES_TC),
+  used(board.tcCsFront, USES_TC), used(board.tcCsBack, USES_TC),
+  board.fan, board.tach, board.buzzer,
+  board.encA, board.encB, board.encBtn,
+  board.i2cSda, board.i2cScl,
+};
+constexpr uint8_t PIN_COUNT = sizeof(PINS) / sizeof(PINS[0]);
+
+constexpr uint8_t countOf(const uint8_t* p, uint8_t n, uint8_t pin) {
+  return n == 0 ? 0 : (uint8_t)((p[0] == pin) + countOf(p + 1, n - 1, pin));
+}
+// Not used for anything else (unused pins always pass)
+constexpr bool own(uint8_t pin) { return pin == PIN_NONE || countOf(PINS, PIN_COUNT, pin) == 1; }
+
+// GPIO 6..11 are the SPI flash; 20, 24 and 28..31 are not bonded out
+constexpr bool gpio(uint8_t pin) {
+  return pin == PIN_NONE || (pin <= 39 && !(pin >= 6 && pin <= 11) && pin != 20 && pin != 24 && !(pin >= 28 && pin <= 31));
+}
+// 34..39 are inputs without pull-ups
+constexpr bool output(uint8_t pin) { return pin == PIN_NONE || (gpio(pin) && pin < 34); }
+constexpr bool pullUp(uint8_t pin) { return output(pin); }
+constexpr bool adc1(uint8_t pin)   { return pin == PIN_NONE || (pin >= 32 && pin <= 39); }
+
+static_assert(board.zones == 2, "board: the firmware drives exactly two plates (front, back)");
+static_assert(own(board.ssrFront),  "board: SSR front pin is also used by another function");
+static_assert(own(board.ssrBack),   "board: SSR back pin is also used by another function");
+static_assert(own(used(board.thermFront, !USES_TC)) && own(used(board.thermBack, !USES_TC)),
+              "board: NTC pin is also used by another function");
+static_assert(own(used(board.tcSck, USES_TC)) && own(used(board.tcMiso, USES_TC)) &&
+              own(used(board.tcCsFront, USES_TC)) && own(used(board.tcCsBack, USES_TC)),
+              "board: thermocouple SPI pin is also used by another function");
+static_assert(own(board.fan),       "board: fan PWM pin is also used by another function");
+static_assert(own(board.tach),      "board: fan tach pin is also used by another function");
+static_assert(own(board.buzzer),    "board: buzzer pin is also used by another function");
+static_assert(own(board.encA) && own(board.encB) && own(board.encBtn),
+              "board: encoder pin is also used by another function");
+static_assert(own(board.i2cSda) && own(board.i2cScl), "board: I2C pin is also used by another function");
+
+static_assert(gpio(board.encA) && gpio(board.encB), "board: encoder pin is not a usable GPIO");
+static_assert(output(board.ssrFront) && output(board.ssrBack) && output(board.fan) && output(board.buzzer),
+              "board: SSR, fan and buzzer need output-capable pins (not 34..39, not flash)");
+static_assert(output(board.i2cSda) && output(board.i2cScl), "board: I2C needs output-capable pins");
+static_assert(!USES_TC || (output(board.tcSck) && output(board.tcCsFront) && output(board.tcCsBack) &&
+                           gpio(board.tcMiso)),
+              "board: thermocouple SCK / CS need output-capable pins");
+static_assert(pullUp(board.tach) && pullUp(board.encBtn),
+              "board: tach and encoder button use the internal pull-up (not on 34..39)");
+static_assert(USES_TC || (adc1(board.thermFront) && adc1(board.thermBack)),
+              "board: NTC inputs must be ADC1 pins (32..39)");
+static_assert(board.fanLedcChannel > 0 && board.fanLedcChannel < 16, "board: fan LEDC channel 1..15 (tone() uses 0)");
+static_assert(board.ssrWindowMs >= 100, "board: SSR window below 100 ms (zero-cross SSRs need whole mains cycles)");
+}
@@ -0,0 +1,14 @@
+#pragma once
+#include <Arduino.h>
+
+// Time base for the control stack (sensors, PID, profile, run state).
+// Normal builds use millis(); replay builds (REFLOW_REPLAY) run on a
+// virtual clock that the replay driver steps, so a recorded run can be
+// pushed through the real control logic faster than real time.
+#ifdef REFLOW_REPLAY
+extern uint32_t g_virtualMs;
+inline uint32_t clockMs() { return g_virtualMs; }
+inline void clockAdvance(uint32_t ms) { g_virtualMs += ms; }
+#else
+inline uint32_t clockMs() { return millis(); }
+#endif
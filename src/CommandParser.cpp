@@ -0,0 +1,123 @@
+// CommandParser.cpp
+#include "CommandParser.h"
+#include "Log.h"
+
+CommandParser commands;
+
+void CommandParser::poll(Stream& in) {
+  for (uint8_t n = 0; n < MAX_BYTES_PER_POLL && in.available() > 0; n++) {
+    int c = in.read();
+    if (c < 0) break;
+    feed((char)c);
+  }
+}
+
+void CommandParser::feed(char c) {
+  if (c == '\r' || c == '\n') {
+    if (overflow_) {
+      overflow_ = false;
+      len_ = 0;
+      replied_ = false;
+      err("line too long");
+      return;
+    }
+    if (len_ == 0) return;          // blank line, or the LF of a CRLF
+    line_[len_] = '\0';
+    len_ = 0;
+    run_(line_);
+    return;
+  }
+  if (overflow_) return;
+  if (len_ >= LINE_MAX - 1) { overflow_ = true; return; }
+  if (c == '\b' || c == 0x7F) { if (len_) len_--; return; }   // terminal editing
+  if ((uint8_t)c < 0x20 && c != '\t') return;                  // stray control bytes
+  line_[len_++] = c;
+}
+
+void CommandParser::execute(const char* line) {
+  char buf[LINE_MAX];
+  strncpy(buf, line, sizeof(buf) - 1);
+  buf[sizeof(buf) - 1] = '\0';
+  run_(buf);
+}
+
+void CommandParser::run_(char* line) {
+  char* argv[MAX_ARGS + 2];
+  uint8_t argc = 0;
+  for (char* p = line; *p && argc < MAX_ARGS + 2; ) {
+    while (*p == ' ' || *p == '\t') *p++ = '\0';
+    if (!*p) break;
+    argv[argc++] = p;
+    while (*p && *p != ' ' && *p != '\t') p++;
+  }
+  if (argc == 0) return;
+  lines_++;
+  replied_ = false;
+
+  for (uint8_t i = 0; i < count_; i++) {
+    const CommandSpec& c = table_[i];
+    if (strcmp(c.name, argv[0]) != 0) continue;
+    if (argc - 1 < c.minArgs || argc - 1 > c.maxArgs) { err("usage: %s", c.usage); return; }
+    c.fn(argc, argv);
+    if (!replied_) ok();
+    return;
+  }
+  err("unknown command '%s' (try help)", argv[0]);
+}
+
+void CommandParser::help() {
+  for (uint8_t i = 0; i < count_; i++) info("%s", table_[i].usage);
+  ok("%u commands", count_);
+}
+
+void CommandParser::send_(const char* prefix, const char* fmt, va_list ap) {
+  char buf[LINE_MAX + 32];
+  int n = snprintf(buf, sizeof(buf), "%s", prefix);
+  if (fmt) {
+    buf[n++] = ' ';
+    int m = vsnprintf(buf + n, sizeof(buf) - n - 1, fmt, ap);
+    n += m < 0 ? 0 : min(m, (int)(sizeof(buf) - n - 2));
+  }
+  buf[n++] = '\n';
+  logger.writeRaw(buf, n);
+}
+
+void CommandParser::ok(const char* fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  send_("ok", fmt, ap);
+  va_end(ap);
+  replied_ = true;
+}
+
+void CommandParser::err(const char* fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  send_("err", fmt, ap);
+  va_end(ap);
+  replied_ = true;
+  errors_++;
+}
+
+void CommandParser::info(const char* fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  send_("-", fmt, ap);
+  va_end(ap);
+}
+
+bool CommandParser::toInt(const char* s, long lo, long hi, long& out) {
+  char* end;
+  long v = strtol(s, &end, 10);
+  if (end == s || *end || v < lo || v > hi) return false;
+  out = v;
+  return true;
+}
+
+bool CommandParser::toFloat(const char* s, float lo, float hi, float& out) {
+  char* end;
+  float v = strtof(s, &end);
+  if (end == s || *end || !(v >= lo && v <= hi)) return false;
+  out = v;
+  return true;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <Arduino.h>
+#include <stdarg.h>
+
+// Line-oriented remote control on the log UART.
+// poll() moves the bytes already waiting (at most MAX_BYTES_PER_POLL) into
+// a fixed line buffer and runs each line as it completes; it never waits
+// for input, so it is safe to call every loop. A line is a command word
+// and up to MAX_ARGS arguments separated by spaces, ended by CR or LF.
+// It is tokenised in place and looked up in a static table; nothing is
+// allocated. Overlong lines are dropped whole.
+//
+// Each command answers with exactly one final line, "ok ..." or
+// "err ...", optionally preceded by "- ..." detail lines. Replies are
+// queued through the logger like everything else on the UART, so they
+// never split a log line or a telemetry frame. Log lines start with
+// "[TAG]", so a host can tell the three apart.
+typedef void (*CommandFn)(uint8_t argc, char** argv);   // argv[0] is the command
+
+struct CommandSpec {
+  const char* name;
+  uint8_t     minArgs;     // not counting the command word
+  uint8_t     maxArgs;
+  CommandFn   fn;          // replies through ok()/err(); silence means "ok"
+  const char* usage;       // for `help`
+};
+
+class CommandParser {
+public:
+  static constexpr uint8_t LINE_MAX = 96;
+  static constexpr uint8_t MAX_ARGS = 6;
+  static constexpr uint8_t MAX_BYTES_PER_POLL = 64;
+
+  void begin(const CommandSpec* table, uint8_t count) { table_ = table; count_ = count; }
+
+  void poll(Stream& in);
+  void feed(char c);                 // one input byte
+  // A complete line from elsewhere (the dashboard); replies still go to the UART
+  void execute(const char* line);
+
+  // Replies, for command handlers
+  void ok(const char* fmt = nullptr, ...) __attribute__((format(printf, 2, 3)));
+  void err(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  void info(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  void help();
+
+  // Argument helpers: false unless the whole token parses and is in range
+  static bool toInt(const char* s, long lo, long hi, long& out);
+  static bool toFloat(const char* s, float lo, float hi, float& out);
+
+  uint32_t lines()  const { return lines_; }
+  uint32_t errors() const { return errors_; }
+
+private:
+  void run_(char* line);
+  void send_(const char* prefix, const char* fmt, va_list ap);
+
+  const CommandSpec* table_ = nullptr;
+  uint8_t  count_ = 0;
+  char     line_[LINE_MAX];
+  uint8_t  len_ = 0;
+  bool     overflow_ = false;     // dropping until the end of the line
+  bool     replied_ = false;
+  uint32_t lines_ = 0, errors_ = 0;
+};
+
+extern CommandParser commands;
@@ -0,0 +1,64 @@
+// ConstantRunner.cpp
+#include "ConstantRunner.h"
+
+void ConstantRunner::begin(float targetC, float rampCps, uint16_t holdSec, float startC, uint32_t nowMs) {
+  holdSec_ = holdSec;
+  heldMs_ = 0;
+  timing_ = timedOut_ = false;
+  sp_ = startC < targetC ? startC : targetC;
+  retarget(targetC, rampCps, nowMs);
+}
+
+void ConstantRunner::retarget(float targetC, float rampCps, uint32_t nowMs) {
+  if (timing_) heldMs_ += nowMs - timingSinceMs_;
+  timing_ = false;
+  rampDone_ = false;
+  dirKnown_ = false;
+  reachSec_ = 0;
+  target_ = targetC;
+  rate_ = rampCps < 0.0f ? 0.0f : rampCps;
+  from_ = sp_;
+  rampStartMs_ = rampEndMs_ = nowMs;
+  if (rate_ <= 0.0f || target_ <= from_) sp_ = from_ = target_;
+}
+
+uint16_t ConstantRunner::heldSec(uint32_t nowMs) const {
+  return (heldMs_ + (timing_ ? nowMs - timingSinceMs_ : 0)) / 1000U;
+}
+
+uint16_t ConstantRunner::remainingSec(uint32_t nowMs) const {
+  uint16_t held = heldSec(nowMs);
+  return held >= holdSec_ ? 0 : holdSec_ - held;
+}
+
+float ConstantRunner::update(uint32_t nowMs, bool& finished, float loC, float hiC) {
+  if (!dirKnown_) {
+    rising_ = loC < target_;
+    dirKnown_ = true;
+  }
+  if (sp_ < target_) {
+    sp_ = from_ + rate_ * (nowMs - rampStartMs_) / 1000.0f;
+    if (sp_ >= target_) sp_ = target_;
+  }
+  if (!ramping() && !rampDone_) {
+    rampDone_ = true;
+    rampEndMs_ = nowMs;
+  }
+
+  // Heating up the coldest plate decides, cooling down the hottest
+  if (!timing_ && rampDone_) {
+    bool reached = rising_ ? loC >= target_ - REACHED_BAND_C : hiC <= target_ + REACHED_BAND_C;
+    if (!reached && nowMs - rampEndMs_ >= REACH_TIMEOUT_S * 1000UL) {
+      reached = true;
+      timedOut_ = true;
+    }
+    if (reached) {
+      timing_ = true;
+      timingSinceMs_ = nowMs;
+      reachSec_ = (nowMs - rampStartMs_) / 1000U;
+    }
+  }
+
+  finished = timing_ && heldSec(nowMs) >= holdSec_;
+  return sp_;
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <stdint.h>
+
+// Setpoint and timer for a constant-temperature run.
+// The setpoint ramps up from the plate temperature at rampCps instead of
+// stepping, so the PID is never asked for a 150 °C jump. Lower targets,
+// and rampCps = 0, step: the plates can only cool passively anyway.
+// The hold timer starts when the plates reach the target, not at start,
+// or REACH_TIMEOUT_S after the ramp ends if they never quite get there.
+class ConstantRunner {
+public:
+  static constexpr float    REACHED_BAND_C  = 2.0f;
+  static constexpr uint16_t REACH_TIMEOUT_S = 600;
+
+  // startC: where the ramp begins, normally the coldest active plate
+  void begin(float targetC, float rampCps, uint16_t holdSec, float startC, uint32_t nowMs);
+  // New target mid-run: ramps from the current setpoint, and the timer
+  // pauses until the plates are there (time already held still counts)
+  void retarget(float targetC, float rampCps, uint32_t nowMs);
+  // Editable while running; at or below the time already held, the run ends
+  void setHoldSec(uint16_t s) { holdSec_ = s; }
+
+  // loC/hiC: lowest and highest active plate temps. Returns the setpoint;
+  // finished once the plates have held the target for holdSec
+  float update(uint32_t nowMs, bool& finished, float loC, float hiC);
+
+  float    setpoint() const { return sp_; }
+  float    targetC()  const { return target_; }
+  float    rampCps()  const { return rate_; }
+  bool     ramping()  const { return sp_ != target_; }
+  bool     timing()   const { return timing_; }
+  bool     reachTimedOut() const { return timedOut_; }
+  uint16_t holdSec()  const { return holdSec_; }
+  uint16_t heldSec(uint32_t nowMs) const;
+  uint16_t remainingSec(uint32_t nowMs) const;   // the full hold until the timer starts
+  // Seconds from start (or retarget) until the plates reached the target
+  uint16_t reachSec() const { return reachSec_; }
+
+private:
+  float    target_ = 0, rate_ = 0, from_ = 0, sp_ = 0;
+  uint16_t holdSec_ = 0, reachSec_ = 0;
+  uint32_t rampStartMs_ = 0, rampEndMs_ = 0;
+  uint32_t timingSinceMs_ = 0;
+  uint32_t heldMs_ = 0;                        // finished stretches (before a retarget)
+  bool     timing_ = false, rampDone_ = false, timedOut_ = false;
+  bool     rising_ = true, dirKnown_ = false;   // plates below the target when it was set
+};
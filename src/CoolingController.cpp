@@ -0,0 +1,161 @@
+// CoolingController.cpp
+#include "CoolingController.h"
+#include "Telemetry.h"
+#include "Log.h"
+#include <LittleFS.h>
+
+// Fan-off loss as in the estimator; fan term from the 200->120 C in ~2 min
+// noted in Profiles.cpp (see also DEFAULT_PLATE_LIMITS)
+const FanModel DEFAULT_FAN_MODEL = {0.0017f, 0.0055f, 25.0f, 20, {0, 0, 0, 0, 0}};
+
+float fanLossAt(const FanModel& m, uint8_t dutyPct) {
+  if (dutyPct <= m.minSpinPct || m.minSpinPct >= 100) return 0.0f;
+  return m.fanLossCoef * (dutyPct - m.minSpinPct) / (100.0f - m.minSpinPct);
+}
+
+uint16_t fanRpmAt(const FanModel& m, uint8_t dutyPct) {
+  if (dutyPct < FAN_RPM_STEP || dutyPct <= m.minSpinPct) return 0;
+  uint8_t i = min(dutyPct / FAN_RPM_STEP, FAN_RPM_POINTS) - 1;
+  if (i + 1 >= FAN_RPM_POINTS) return m.rpmAt[FAN_RPM_POINTS - 1];
+  uint16_t a = m.rpmAt[i], b = m.rpmAt[i + 1];
+  if (!a || !b) return 0;
+  float f = (dutyPct - (i + 1) * FAN_RPM_STEP) / (float)FAN_RPM_STEP;
+  return (uint16_t)(a + (b - a) * f + 0.5f);
+}
+
+uint8_t CoolingController::update(uint32_t nowMs, float slopeCps, float rateCps, float tempC) {
+  float dt = lastMs_ ? (nowMs - lastMs_) / 1000.0f : 0.0f;
+  lastMs_ = nowMs;
+
+  float want = -slopeCps;                      // requested cooling, °C/s
+  float dT = tempC - model_.ambientC;
+  if (want <= 0.0f || dT < 1.0f) {
+    integ_ = 0.0f;
+    duty_ = 0;
+    return duty_;
+  }
+
+  // Feed-forward: duty whose loss gives the wanted rate at this temperature
+  float u = model_.fanLossCoef > 0.0f ? (want / dT - model_.lossCoef) / model_.fanLossCoef : 1.0f;
+  float ff = (u <= 0.0f) ? 0.0f : model_.minSpinPct + u * (100.0f - model_.minSpinPct);
+
+  // PI on the rate error, positive when the plate cools slower than asked
+  float err = want + rateCps;
+  integ_ = constrain(integ_ + KI * err * dt, -I_MAX, I_MAX);
+  float cmd = ff + KP * err + integ_;
+  if ((cmd >= 100.0f && err > 0.0f) || (cmd <= 0.0f && err < 0.0f)) integ_ -= KI * err * dt;
+  cmd = constrain(cmd, 0.0f, 100.0f);
+
+  if (cmd < model_.minSpinPct) cmd = (cmd >= model_.minSpinPct / 2.0f) ? model_.minSpinPct : 0.0f;
+  duty_ = (uint8_t)(cmd + 0.5f);
+  return duty_;
+}
+
+// ---- Persistence ----
+struct __attribute__((packed)) FanModelFile {
+  char     magic[4];       // "FANM"
+  uint8_t  version;
+  float    lossCoef, fanLossCoef, ambientC;
+  uint8_t  minSpinPct;
+  uint16_t rpmAt[FAN_RPM_POINTS];   // since version 2
+  uint16_t crc;            // CRC-16 over everything above
+};
+
+static const char* FAN_MODEL_PATH = "/fan.mdl";
+
+bool CoolingController::load() {
+  File f = LittleFS.open(FAN_MODEL_PATH, "r");
+  if (!f) return false;
+  FanModelFile m;
+  bool ok = f.read((uint8_t*)&m, sizeof(m)) == sizeof(m) && memcmp(m.magic, "FANM", 4) == 0 &&
+            m.version == 2 && Telemetry::crc16((const uint8_t*)&m, sizeof(m) - 2) == m.crc;
+  f.close();
+  if (!ok) { LOGE("FAN", "%s is invalid, keeping defaults", FAN_MODEL_PATH); return false; }
+  model_.lossCoef    = m.lossCoef;
+  model_.fanLossCoef = m.fanLossCoef;
+  model_.ambientC    = m.ambientC;
+  model_.minSpinPct  = m.minSpinPct;
+  memcpy(model_.rpmAt, m.rpmAt, sizeof(m.rpmAt));
+  LOGI("FAN", "Model loaded: loss %.4f + fan %.4f /s, spin floor %u%%, %u rpm at 100%%",
+       model_.lossCoef, model_.fanLossCoef, model_.minSpinPct, model_.rpmAt[FAN_RPM_POINTS - 1]);
+  return true;
+}
+
+bool CoolingController::save() const {
+  FanModelFile m;
+  memcpy(m.magic, "FANM", 4);
+  m.version     = 2;
+  m.lossCoef    = model_.lossCoef;
+  m.fanLossCoef = model_.fanLossCoef;
+  m.ambientC    = model_.ambientC;
+  m.minSpinPct  = model_.minSpinPct;
+  memcpy(m.rpmAt, model_.rpmAt, sizeof(m.rpmAt));
+  m.crc = Telemetry::crc16((const uint8_t*)&m, sizeof(m) - 2);
+  File f = LittleFS.open(FAN_MODEL_PATH, "w");
+  if (!f) { LOGE("FAN", "cannot write %s", FAN_MODEL_PATH); return false; }
+  f.write((const uint8_t*)&m, sizeof(m));
+  f.close();
+  return true;
+}
+
+// ---- Identification ----
+const uint8_t FanModelFit::STEP_DUTIES[FanModelFit::STEPS] = {0, 20, 40, 60, 80, 100};
+
+void FanModelFit::begin(uint32_t nowMs, float ambientC) {
+  ambientC_ = ambientC;
+  stepStartMs_ = nowMs;
+  step_ = 0;
+  startC_ = NAN;
+  for (uint8_t i = 0; i < STEPS; i++) { k_[i] = NAN; rpm_[i] = 0; }
+}
+
+uint8_t FanModelFit::update(uint32_t nowMs, float tempC, uint16_t rpm) {
+  if (done()) return 100;
+  uint32_t t = nowMs - stepStartMs_;
+
+  if (isnan(startC_) && t >= SETTLE_SECS * 1000UL) startC_ = tempC;
+  if (t >= STEP_SECS * 1000UL) {
+    float d0 = startC_ - ambientC_, d1 = tempC - ambientC_;
+    if (d0 > 5.0f && d1 > 5.0f && d1 < d0)
+      k_[step_] = logf(d0 / d1) / (STEP_SECS - SETTLE_SECS);
+    rpm_[step_] = rpm;             // settled for a whole step
+    LOGI("FAN", "Fit step %u%%: k=%.5f /s, %u rpm", STEP_DUTIES[step_], k_[step_], rpm);
+    step_++;
+    stepStartMs_ = nowMs;
+    startC_ = NAN;
+  }
+  return done() ? 100 : STEP_DUTIES[step_];
+}
+
+bool FanModelFit::result(FanModel& out) const {
+  if (!done() || isnan(k_[0])) return false;
+
+  float maxExtra = 0.0f;
+  for (uint8_t i = 1; i < STEPS; i++)
+    if (!isnan(k_[i])) maxExtra = max(maxExtra, k_[i] - k_[0]);
+  if (maxExtra <= 0.0f) return false;
+
+  // Line through the steps where the fan clearly does something
+  float n = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+  for (uint8_t i = 1; i < STEPS; i++) {
+    float extra = k_[i] - k_[0];
+    if (isnan(k_[i]) || extra < 0.1f * maxExtra) continue;
+    float x = STEP_DUTIES[i];
+    n++; sx += x; sy += extra; sxx += x * x; sxy += x * extra;
+  }
+  float den = n * sxx - sx * sx;
+  if (n < 2 || den <= 0.0f) return false;
+  float a = (n * sxy - sx * sy) / den;
+  float b = (sy - a * sx) / n;
+  if (a <= 0.0f) return false;
+
+  out.lossCoef    = k_[0];
+  out.fanLossCoef = a * 100.0f + b;
+  out.ambientC    = ambientC_;
+  out.minSpinPct  = (uint8_t)constrain(-b / a, 0.0f, 60.0f);
+  for (uint8_t i = 0; i < FAN_RPM_POINTS; i++) out.rpmAt[i] = 0;
+  for (uint8_t i = 0; i < STEPS; i++)
+    if (STEP_DUTIES[i] >= FAN_RPM_STEP && STEP_DUTIES[i] % FAN_RPM_STEP == 0)
+      out.rpmAt[STEP_DUTIES[i] / FAN_RPM_STEP - 1] = rpm_[i];
+  return true;
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <Arduino.h>
+
+// Fan plant: Newton cooling whose loss coefficient grows with fan duty.
+//   dT/dt = -(lossCoef + fanLossCoef * u) * (T - ambientC)
+//   u = (duty - minSpinPct) / (100 - minSpinPct), 0 below the spin floor
+// The cooling test identifies it (FanModelFit) and stores it in /fan.mdl,
+// together with the tach RPM measured at each RPM_STEP of duty.
+#define FAN_RPM_POINTS 5           // 20, 40, 60, 80, 100%
+#define FAN_RPM_STEP   20
+
+struct FanModel {
+  float    lossCoef;       // 1/s, fan off
+  float    fanLossCoef;    // 1/s added at 100% duty
+  float    ambientC;
+  uint8_t  minSpinPct;     // lowest duty that reliably spins the fan
+  uint16_t rpmAt[FAN_RPM_POINTS];  // 0 = not calibrated
+};
+
+extern const FanModel DEFAULT_FAN_MODEL;
+
+// Extra loss coefficient the fan adds at a duty (1/s)
+float fanLossAt(const FanModel& m, uint8_t dutyPct);
+// Calibrated RPM at a duty, interpolated; 0 if unknown
+uint16_t fanRpmAt(const FanModel& m, uint8_t dutyPct);
+
+// Tracks a requested cooling rate with the fan duty: the model inverse gives
+// the feed-forward duty, a PI term on the measured rate trims it. Commands
+// under the spin floor become the floor or off, never a stalling fan.
+class CoolingController {
+public:
+  void begin(const FanModel& m) { model_ = m; reset(); }
+  void reset() { integ_ = 0.0f; lastMs_ = 0; duty_ = 0; }
+  void setModel(const FanModel& m) { model_ = m; }
+  const FanModel& model() const { return model_; }
+
+  // slopeCps: setpoint slope (negative = cool), rateCps: measured plate
+  // rate, tempC: hottest plate. Returns fan duty 0..100.
+  uint8_t update(uint32_t nowMs, float slopeCps, float rateCps, float tempC);
+  uint8_t duty() const { return duty_; }
+
+  bool load();                          // /fan.mdl, false keeps the current model
+  bool save() const;
+
+private:
+  static constexpr float KP = 40.0f;    // % per °C/s of rate error
+  static constexpr float KI = 4.0f;     // % per °C of accumulated error
+  static constexpr float I_MAX = 30.0f;
+
+  FanModel model_ = DEFAULT_FAN_MODEL;
+  float    integ_ = 0.0f;
+  uint32_t lastMs_ = 0;
+  uint8_t  duty_ = 0;
+};
+
+// Identifies a FanModel during the cooling test: steps the fan through
+// STEP_DUTIES, measures the decay constant of each step from its
+// log-temperature drop, and fits extra loss vs duty with a line whose
+// zero crossing is the spin floor. The tach RPM at the end of each step
+// becomes the duty->RPM calibration.
+class FanModelFit {
+public:
+  static constexpr uint8_t  STEPS = 6;
+  static constexpr uint16_t STEP_SECS = 45;
+  static constexpr uint16_t SETTLE_SECS = 10;   // skipped after each duty change
+
+  void begin(uint32_t nowMs, float ambientC);
+  // Feed the hottest plate and the tach (0 if not fitted); returns the duty to apply
+  uint8_t update(uint32_t nowMs, float tempC, uint16_t rpm = 0);
+  bool done() const { return step_ >= STEPS; }
+  // Valid once done(); false if the plate was too close to ambient
+  bool result(FanModel& out) const;
+
+private:
+  static const uint8_t STEP_DUTIES[STEPS];
+
+  float    ambientC_ = 25.0f;
+  uint32_t stepStartMs_ = 0;
+  uint8_t  step_ = STEPS;
+  float    startC_ = NAN;
+  float    k_[STEPS];             // 1/s per step, NAN if unusable
+  uint16_t rpm_[STEPS];
+};
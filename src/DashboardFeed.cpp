@@ -0,0 +1,48 @@
+// DashboardFeed.cpp
+#include "DashboardFeed.h"
+#include <stdio.h>
+
+void SampleAverager::add(const DashSample& s) {
+  if (n_ == 0) {
+    sum_ = s;
+  } else {
+    sum_.tFront += s.tFront;      sum_.tBack += s.tBack;
+    sum_.dutyFront += s.dutyFront; sum_.dutyBack += s.dutyBack;
+    sum_.fanPct += s.fanPct;
+    sum_.tMs = s.tMs;  sum_.setpoint = s.setpoint;  sum_.mode = s.mode;
+    sum_.flags |= s.flags;
+  }
+  n_++;
+}
+
+void SampleAverager::add(const SampleAverager& o) {
+  if (o.n_ == 0) return;
+  if (n_ == 0) { *this = o; return; }
+  sum_.tFront += o.sum_.tFront;       sum_.tBack += o.sum_.tBack;
+  sum_.dutyFront += o.sum_.dutyFront; sum_.dutyBack += o.sum_.dutyBack;
+  sum_.fanPct += o.sum_.fanPct;
+  sum_.tMs = o.sum_.tMs;  sum_.setpoint = o.sum_.setpoint;  sum_.mode = o.sum_.mode;
+  sum_.flags |= o.sum_.flags;
+  n_ += o.n_;
+}
+
+DashSample SampleAverager::take() {
+  DashSample r = sum_;
+  if (n_ > 1) {
+    float k = 1.0f / n_;
+    r.tFront *= k;    r.tBack *= k;
+    r.dutyFront *= k; r.dutyBack *= k;
+    r.fanPct *= k;
+  }
+  n_ = 0;
+  return r;
+}
+
+size_t dashJson(const DashSample& s, uint16_t samples, char* out, size_t cap) {
+  int n = snprintf(out, cap,
+                   "{\"t\":%.1f,\"m\":%u,\"f\":%.1f,\"b\":%.1f,\"sp\":%.1f,"
+                   "\"df\":%.0f,\"db\":%.0f,\"fan\":%.0f,\"fl\":%u,\"n\":%u}",
+                   s.tMs / 1000.0, s.mode, s.tFront, s.tBack, s.setpoint,
+                   s.dutyFront, s.dutyBack, s.fanPct, s.flags, samples);
+  return (n > 0 && (size_t)n < cap) ? n : 0;
+}
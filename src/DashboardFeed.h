@@ -0,0 +1,35 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Dashboard telemetry, kept free of Arduino like WsProtocol.
+// The control loop adds one sample per tick; the network side averages
+// each client's push interval into one message, so a slow client or a
+// low push rate never sees aliased single ticks.
+struct DashSample {
+  uint32_t tMs;
+  float    tFront, tBack;
+  float    setpoint;
+  float    dutyFront, dutyBack, fanPct;
+  uint8_t  mode;           // Mode
+  uint8_t  flags;          // TLM_* bits
+};
+
+// Temperatures and duties are averaged, time / setpoint / mode are the
+// latest, flags are OR-ed over the window
+class SampleAverager {
+public:
+  void add(const DashSample& s);
+  void add(const SampleAverager& other);     // merge another window
+  bool empty() const { return n_ == 0; }
+  uint16_t count() const { return n_; }
+  DashSample take();                         // the window's result, then starts over
+
+private:
+  DashSample sum_;
+  uint16_t   n_ = 0;
+};
+
+// {"t":..,"m":..,"f":..,"b":..,"sp":..,"df":..,"db":..,"fan":..,"fl":..,"n":..};
+// returns the length, 0 if cap is too small
+size_t dashJson(const DashSample& s, uint16_t samples, char* out, size_t cap);
@@ -0,0 +1,53 @@
+#pragma once
+
+// Dashboard page served by WebDashboard (-DREFLOW_WIFI), kept in flash.
+// Plain JS, no external files: the station's AP has no internet.
+// Mode names follow Types.h, flag bits Telemetry.h.
+static const char DASHBOARD_HTML[] = R"HTML(<!DOCTYPE html>
+<html><head><meta charset="utf-8"><meta name="viewport" content="width=device-width">
+<title>Reflow Station</title>
+<style>
+body{font-family:sans-serif;margin:12px;background:#111;color:#ddd}
+#temps span{display:inline-block;min-width:7em;font-size:1.6em}
+canvas{width:100%;height:300px;background:#000;border:1px solid #333}
+button,input,select{font-size:1em;margin:4px}
+.f{color:#f84}.b{color:#4bf}.s{color:#8f8}.warn{color:#f44}
+</style></head><body>
+<div id="temps"><span class="f" id="tf">--</span><span class="b" id="tb">--</span><span class="s" id="sp">--</span></div>
+<div id="state">connecting...</div>
+<canvas id="c" width="900" height="300"></canvas>
+<div>
+ Profile <input id="prof" type="number" min="0" value="0" style="width:4em">
+ <button onclick="send('start '+prof.value)">Start</button>
+ <button onclick="send('abort')">Abort</button>
+ Rate <select id="rate" onchange="send('rate '+this.value)">
+  <option value="200">5 Hz</option><option value="500" selected>2 Hz</option>
+  <option value="1000">1 Hz</option><option value="2000">0.5 Hz</option></select>
+ <span id="msg"></span>
+</div>
+<script>
+const MODES=["MENU","PROF_SETUP","PROFILE_RUN","CONST_SETUP","CONST_RUN","TEST_RUN","COOL_TEST","DIAG","FAULT","CHARACTERIZE"];
+const FLAGS=[[1,"fan"],[2,"cooling"],[4,"running"],[8,"SENSOR ERROR"],[16,"manual fan"],[32,"FAN STALL"],[64,"fan degraded"]];
+const pts=[],SPAN=600;let ws;
+function send(m){if(ws&&ws.readyState==1)ws.send(m);}
+function connect(){
+ ws=new WebSocket("ws://"+location.host+"/ws");
+ ws.onmessage=e=>{const d=JSON.parse(e.data);
+  if(d.ack||d.err){msg.textContent=d.ack?"ok: "+d.ack:"error: "+d.err;return;}
+  tf.textContent="F "+d.f.toFixed(1)+"°C";tb.textContent="B "+d.b.toFixed(1)+"°C";
+  sp.textContent="SP "+d.sp.toFixed(0)+"°C";
+  const fl=FLAGS.filter(x=>d.fl&x[0]).map(x=>x[1]).join(", ");
+  state.innerHTML=(MODES[d.m]||d.m)+" | duty "+d.df+"/"+d.db+"% fan "+d.fan+"% | "+
+   (d.fl&40?"<span class=warn>"+fl+"</span>":fl);
+  pts.push(d);while(pts.length&&d.t-pts[0].t>SPAN)pts.shift();draw();};
+ ws.onclose=()=>{state.textContent="disconnected, retrying...";setTimeout(connect,2000);};
+}
+function draw(){const g=c.getContext("2d"),W=c.width,H=c.height;g.clearRect(0,0,W,H);
+ if(!pts.length)return;const t1=pts[pts.length-1].t,X=t=>W-(t1-t)*W/SPAN,Y=v=>H-v*H/260;
+ g.strokeStyle="#333";for(let v=50;v<260;v+=50){g.beginPath();g.moveTo(0,Y(v));g.lineTo(W,Y(v));g.stroke();
+  g.fillStyle="#666";g.fillText(v,2,Y(v)-2);}
+ for(const[k,col]of[["sp","#8f8"],["f","#f84"],["b","#4bf"]]){g.strokeStyle=col;g.beginPath();
+  pts.forEach((p,i)=>i?g.lineTo(X(p.t),Y(p[k])):g.moveTo(X(p.t),Y(p[k])));g.stroke();}}
+connect();
+</script></body></html>
+)HTML";
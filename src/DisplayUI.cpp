@@ -7,7 +7,8 @@ bool DisplayUI::begin(uint8_t sda, uint8_t scl, uint8_t addr){
   d_.clearDisplay(); d_.display();
   return ok;
 }
-void DisplayUI::clear(){ d_.clearDisplay(); d_.display(); }
+void DisplayUI::clear(){ d_.clearDisplay(); flush_(); }
+void DisplayUI::flush_(){ if (outputEnabled_) d_.display(); }
 void DisplayUI::drawPlateIconsAt_(int x, int y, HeatState sel, bool blinkOn){
   d_.setCursor(x, y); d_.print("F"); x += 6;
   bool front = (sel==HEAT_FRONT||sel==HEAT_BOTH);
@@ -40,10 +41,24 @@ void DisplayUI::showProfileSetup(const Profile& prof, int plateCount) {
   d_.setCursor(0, 56);
   d_.print("Start  Long=Back");
   
-  d_.display();
+  flush_();
 }
 
-void DisplayUI::showConstantSetup(int targetTemp, int duration) {
+// m:ss, or h:mm:ss from an hour up
+static void printDuration(Print& p, int secs) {
+  char buf[24];
+  if (secs >= 3600) snprintf(buf, sizeof(buf), "%d:%02d:%02d", secs / 3600, secs / 60 % 60, secs % 60);
+  else              snprintf(buf, sizeof(buf), "%d:%02d", secs / 60, secs % 60);
+  p.print(buf);
+}
+
+static void printRamp(Print& p, float rampCps) {
+  if (rampCps <= 0.0f) { p.print("step"); return; }
+  p.print(rampCps, 1);
+  p.print("C/s");
+}
+
+void DisplayUI::showConstantSetup(int targetTemp, float rampCps, int duration, uint8_t field) {
   d_.clearDisplay();
   d_.setTextSize(1);
   d_.setTextColor(SSD1306_WHITE);
@@ -51,20 +66,26 @@ void DisplayUI::showConstantSetup(int targetTemp, int duration) {
   d_.setCursor(0, 0);
   d_.print("Constant Setup");
   
-  d_.setCursor(0, 24);
+  d_.setCursor(0, 18);
+  d_.print(field == 0 ? ">" : " ");
   d_.print("Setpoint: ");
   d_.print(targetTemp);
   d_.print("C");
   
-  d_.setCursor(0, 36);
-  d_.print("Duration: ");
-  d_.print(duration);
-  d_.print("s");
+  d_.setCursor(0, 30);
+  d_.print(field == 1 ? ">" : " ");
+  d_.print("Ramp:     ");
+  printRamp(d_, rampCps);
+  
+  d_.setCursor(0, 42);
+  d_.print(field == 2 ? ">" : " ");
+  d_.print("Hold:     ");
+  printDuration(d_, duration);
   
   d_.setCursor(0, 56);
-  d_.print("Start  Long=Back");
+  d_.print(field == 2 ? "Start  Long=Back" : "Next   Long=Back");
   
-  d_.display();
+  flush_();
 }
 
 void DisplayUI::showTest(int dutyCycle, float tF, float tB, HeatState heatSel) {
@@ -92,9 +113,9 @@ void DisplayUI::showTest(int dutyCycle, float tF, float tB, HeatState heatSel) {
   
  
   d_.setCursor(0, 56);
-  d_.print("Hold=CoolTest");
+  d_.print(dutyCycle >= 100 ? "Hold=Characterize" : "Hold=CoolTest");
   
-  d_.display();
+  flush_();
 }
 
 void DisplayUI::showCoolTest(float tF, float tB) {
@@ -118,12 +139,88 @@ void DisplayUI::showCoolTest(float tF, float tB) {
   d_.setCursor(0, 50);
   d_.print("Check Serial");
   
-  d_.display();
+  flush_();
+}
+
+void DisplayUI::showCharacterize(const char* plate, const char* phase, int dutyPct, int phaseSecs,
+                                 float tF, float tB) {
+  d_.clearDisplay();
+  d_.setTextSize(1);
+  d_.setTextColor(SSD1306_WHITE);
+
+  d_.setCursor(0, 0);
+  d_.print("Characterize");
+
+  char buf[24];
+  d_.setCursor(0, 14);
+  snprintf(buf, sizeof(buf), "%s %s", plate, phase);
+  d_.print(buf);
+  d_.setCursor(0, 26);
+  snprintf(buf, sizeof(buf), "Duty:%3d%%  %4ds", dutyPct, phaseSecs);
+  d_.print(buf);
+
+  d_.setCursor(0, 38);
+  snprintf(buf, sizeof(buf), "F:%3dC  B:%3dC", (int)tF, (int)tB);
+  d_.print(buf);
+
+  d_.setCursor(0, 54);
+  d_.print("Click=Abort");
+  flush_();
+}
+
+void DisplayUI::showFault(bool cleared, float tF, float tB, const char* reason) {
+  d_.clearDisplay();
+  d_.setTextSize(2);
+  d_.setTextColor(SSD1306_WHITE);
+  d_.setCursor(0, 0);
+  d_.print("FAULT");
+
+  d_.setTextSize(1);
+  d_.setCursor(0, 20);
+  d_.print(reason);
+  d_.setCursor(0, 32);
+  d_.print("F:");
+  d_.print((int)tF);
+  d_.print("C  B:");
+  d_.print((int)tB);
+  d_.print("C");
+
+  d_.setCursor(0, 52);
+  d_.print(cleared ? "Press to continue" : "Heaters off");
+  flush_();
 }
 
+#ifdef LOOP_PROFILING
+void DisplayUI::showDiagnostics(const LoopProfiler& prof, uint8_t viewMode) {
+  static const char* shortNames[STAGE_COUNT] = { "sens", "enc", "ctrl", "disp", "log", "loop" };
+  d_.clearDisplay();
+  d_.setTextSize(1);
+  d_.setTextColor(SSD1306_WHITE);
+
+  d_.setCursor(0, 0);
+  d_.print("Diag ");
+  d_.print(modeName(viewMode));
+
+  char buf[24];
+  d_.setCursor(0, 9);
+  d_.print("us    avg  p99  max");
+  for (uint8_t st = 0; st < STAGE_COUNT; st++) {
+    ProfStage s = (ProfStage)st;
+    unsigned long avg = min<uint32_t>(prof.avgUs(viewMode, s), 99999);
+    unsigned long p99 = min<uint32_t>(prof.percentileUs(viewMode, s, 0.99f), 99999);
+    unsigned long mx  = min<uint32_t>(prof.stats(viewMode, s).maxUs, 99999);
+    snprintf(buf, sizeof(buf), "%-4s%5lu%5lu%6lu", shortNames[st], avg, p99, mx);
+    d_.setCursor(0, 18 + st * 8);
+    d_.print(buf);
+  }
+  flush_();
+}
+#endif
+
 
 //Menu Selection 
-void DisplayUI::showMenu(int index, float tFrontC, float tBackC, HeatState sel, bool fanMode, bool fanState){
+void DisplayUI::showMenu(int index, float tFrontC, float tBackC, HeatState sel, bool fanMode, bool fanState,
+                         int fanRpm, bool fanAlarm){
   static const char* items[] = { "Plates", "Profile", "Constant", "Test" };
 
   d_.clearDisplay();
@@ -165,10 +262,18 @@ for (int i = 0; i < 4; ++i) {
   snprintf(buf, sizeof(buf), "B:%3dC", (int)tBackC);
   d_.print(buf);
 
-  d_.setCursor(74, 56);  // Add this line
-  d_.print(fanMode ? (fanState ? "Fan:ON" : "Fan:OFF") : "Auto");  // Add this line
+  d_.setCursor(74, 56);
+  if (fanRpm < 0) {
+    d_.print(fanMode ? (fanState ? "Fan:ON" : "Fan:OFF") : "Auto");
+  } else if (fanAlarm && fanRpm == 0) {
+    d_.print("Fan STALL");
+  } else {
+    // 9 columns fit right of the menu: short label + rpm
+    snprintf(buf, sizeof(buf), "%s %d%s", fanMode ? (fanState ? "ON" : "OFF") : "Auto", fanRpm, fanAlarm ? "!" : "");
+    d_.print(buf);
+  }
 
-  d_.display();
+  flush_();
 }
 
 // ADD THESE NEW METHODS TO YOUR EXISTING DisplayUI.cpp FILE:
@@ -187,7 +292,7 @@ void DisplayUI::setupProfileDisplay(const Profile& prof, int durationSec) {
   // Draw the condensed profile outline
   drawCondensedProfileOutline_(prof);
   
-  d_.display();
+  flush_();
 }
 
 void DisplayUI::drawCondensedProfileOutline_(const Profile& prof) {
@@ -264,7 +369,8 @@ void DisplayUI::plotTemperature(float avgTemp, int currentSec) {
 
 void DisplayUI::showProfileRun(const Profile& prof, float sp, float tF, float tB, 
                                int dutyF, int dutyB, int elapsed, int remaining, 
-                               bool done, bool aborted) {
+                               bool done, bool aborted,
+                               ProfilePhase phase, int holdSec) {
   if (done || aborted) {
     d_.clearDisplay();
     d_.setTextSize(1);
@@ -273,7 +379,7 @@ void DisplayUI::showProfileRun(const Profile& prof, float sp, float tF, float tB
     d_.print(done ? "COMPLETE" : "ABORTED");
     d_.setCursor(17, 45);
     d_.print("Press to continue");
-    d_.display();
+    flush_();
     return;
   }
   
@@ -302,6 +408,16 @@ void DisplayUI::showProfileRun(const Profile& prof, float sp, float tF, float tB
   d_.print("C Avg:");
   d_.print((int)avgTemp);
   d_.print("C");
+
+  // Phase, or how long we've been holding for the plates
+  static const char* phaseNames[PHASE_COUNT] = { "PRE", "SOAK", "RFLW", "COOL" };
+  d_.setCursor(102, 43);
+  if (holdSec >= 0) {
+    d_.print("H");
+    d_.print(holdSec);
+  } else if (phase < PHASE_COUNT) {
+    d_.print(phaseNames[phase]);
+  }
   
   // Line 2: Front plate
   d_.setCursor(0, 52);
@@ -319,17 +435,22 @@ void DisplayUI::showProfileRun(const Profile& prof, float sp, float tF, float tB
   d_.print(dutyB);
   d_.print("%");
   
-  d_.display();
+  flush_();
 }
 
-void DisplayUI::showRun(float spC, float tFrontC, float tBackC, int dutyFrontPct, int dutyBackPct, Mode mode){
+void DisplayUI::showConstantRun(float spC, int targetC, float tFrontC, float tBackC, int dutyFrontPct, int dutyBackPct,
+                                float rampCps, bool holding, int remainingSec){
   d_.clearDisplay(); d_.setTextColor(SSD1306_WHITE); d_.setTextSize(1);
-  d_.setCursor(0,0); d_.print(mode==PROFILE_RUN?"Profile":"Constant");
-  d_.setCursor(80,0); d_.print("Set Point:"); d_.print((int)spC); d_.print("C");
-  d_.setCursor(0,18); d_.print("Front: "); d_.print((int)tFrontC); d_.print("C  "); d_.print(dutyFrontPct); d_.print("%");
-  d_.setCursor(0,32); d_.print("Back : "); d_.print((int)tBackC);  d_.print("C  "); d_.print(dutyBackPct);  d_.print("%");
-  int barW=100, fW=constrain(map(dutyFrontPct,0,100,0,barW),0,barW), bW=constrain(map(dutyBackPct,0,100,0,barW),0,barW);
-  d_.drawRect(0,46,barW,6,SSD1306_WHITE); d_.fillRect(1,47,max(0,fW-2),4,SSD1306_WHITE);
-  d_.drawRect(0,56,barW,6,SSD1306_WHITE); d_.fillRect(1,57,max(0,bW-2),4,SSD1306_WHITE);
-  d_.display();
+  d_.setCursor(0,0); d_.print("Constant "); d_.print(targetC); d_.print("C");
+  d_.setCursor(86,0); d_.print("SP:"); d_.print((int)spC);
+  d_.setCursor(0,14); d_.print("Front: "); d_.print((int)tFrontC); d_.print("C  "); d_.print(dutyFrontPct); d_.print("%");
+  d_.setCursor(0,26); d_.print("Back : "); d_.print((int)tBackC);  d_.print("C  "); d_.print(dutyBackPct);  d_.print("%");
+  d_.setCursor(0,40);
+  if (holding)                  { d_.print("Left "); printDuration(d_, remainingSec); d_.print("  (turn)"); }
+  else if ((int)spC < targetC)  { d_.print("Ramp "); printRamp(d_, rampCps); }
+  else                          { d_.print("Reaching, hold "); printDuration(d_, remainingSec); }
+  int barW=60, fW=constrain(map(dutyFrontPct,0,100,0,barW),0,barW), bW=constrain(map(dutyBackPct,0,100,0,barW),0,barW);
+  d_.drawRect(0,54,barW,6,SSD1306_WHITE);  d_.fillRect(1,55,max(0,fW-2),4,SSD1306_WHITE);
+  d_.drawRect(66,54,barW,6,SSD1306_WHITE); d_.fillRect(67,55,max(0,bW-2),4,SSD1306_WHITE);
+  flush_();
 }
@@ -5,6 +5,8 @@
 #include <Wire.h>
 #include "Types.h"
 #include "Profiles.h"  // <-- ADD THIS LINE - you're using Profile struct but not including it
+#include "LoopProfiler.h"
+#include "OledFramebuffer.h"
 
 // Minimal OLED UI for menu + run screens.
 // You can extend with your profile graph later.
@@ -14,29 +16,52 @@ public:
   bool begin(uint8_t sda, uint8_t scl, uint8_t addr = 0x3C);
 
   // Simple menu: highlight selected index, show current temps.
-  void showMenu(int index, float tFrontC, float tBackC, HeatState sel, bool fanMode, bool fanState);
-  // Generic run screen used for both Constant and Profile modes.
-  // Shows Set Point, temps, and heater duties.
-  void showRun(float spC, float tFrontC, float tBackC, int dutyFrontPct, int dutyBackPct, Mode mode);
+  // fanRpm < 0 hides the tach reading; fanAlarm marks a degraded or stalled fan.
+  void showMenu(int index, float tFrontC, float tBackC, HeatState sel, bool fanMode, bool fanState,
+                int fanRpm = -1, bool fanAlarm = false);
+  // Constant run: target and ramped setpoint, temps, duties, then the ramp,
+  // the wait for the plates, or (holding) the time left, which the encoder edits.
+  void showConstantRun(float spC, int targetC, float tFrontC, float tBackC, int dutyFrontPct, int dutyBackPct,
+                       float rampCps, bool holding, int remainingSec);
 
    // ADD THESE NEW METHODS:
   void setupProfileDisplay(const Profile& prof, int durationSec);
+  // elapsed is profile time (x of the graph), remaining the expected wall
+  // time to finish. holdSec >= 0 shows a running hold instead of the phase.
   void showProfileRun(const Profile& prof, float sp, float tF, float tB, 
                       int dutyF, int dutyB, int elapsed, int remaining, 
-                      bool done, bool aborted);
+                      bool done, bool aborted,
+                      ProfilePhase phase = PHASE_PREHEAT, int holdSec = -1);
   void plotTemperature(float avgTemp, int currentSec);
 
   // Add these to your DisplayUI.h public section:
 void showProfileSetup(const Profile& prof, int plateCount);
-void showConstantSetup(int targetTemp, int duration);
+// field: 0 setpoint, 1 ramp, 2 duration (the one the encoder edits)
+void showConstantSetup(int targetTemp, float rampCps, int duration, uint8_t field);
 void showTest(int dutyCycle, float tF, float tB, HeatState heatSel);
 void showCoolTest(float tF, float tB);
+  // Plant characterization: phase of the current plate, duty, seconds in phase
+  void showCharacterize(const char* plate, const char* phase, int dutyPct, int phaseSecs, float tF, float tB);
+  // Sensor or fan fault: heaters are off until it clears
+  void showFault(bool cleared, float tF, float tB, const char* reason = "Sensor error");
+#ifdef LOOP_PROFILING
+  // Loop timing for one Mode: avg/p99/max per stage in µs
+  void showDiagnostics(const LoopProfiler& prof, uint8_t viewMode);
+#endif
 
   // Optional helper to clear screen.
   void clear();
 
+  // Draw into the buffer only, skip the I2C push (replay / benchmarks)
+  void setOutputEnabled(bool on) { outputEnabled_ = on; }
+
+  // The frame being drawn into, with draw counts (capture / benchmarks)
+  OledFramebuffer& frame() { return d_; }
+
 private:
-  Adafruit_SSD1306 d_{128, 64, &Wire, -1};
+  OledFramebuffer d_{128, 64, &Wire, -1};
+  bool outputEnabled_ = true;
+  void flush_();
   void drawPlateIconsAt_(int x, int y, HeatState sel, bool blinkOn);
   
   // ADD THESE NEW PRIVATE MEMBERS:
@@ -1,10 +1,11 @@
 #include "FanController.h"
+#include "Log.h"
 
 #ifndef ESP_ARDUINO_VERSION_MAJOR
   #define ESP_ARDUINO_VERSION_MAJOR 2
 #endif
 
-bool FanController::begin(uint8_t pin, bool activeLow, uint32_t pwmHz, uint8_t pwmResBits){
+bool FanController::begin(uint8_t pin, bool activeLow, uint32_t pwmHz, uint8_t pwmResBits, uint8_t ledcChannel){
   pin_       = pin;
   activeLow_ = activeLow;
   freq_      = pwmHz;
@@ -22,7 +23,7 @@ bool FanController::begin(uint8_t pin, bool activeLow, uint32_t pwmHz, uint8_t p
   usePinAPI_ = true;
 #else
   // Core 2.x: channel API
-  channel_ = 6; // pick a dedicated channel to avoid clashes
+  channel_ = ledcChannel;
   if (ledcSetup(channel_, freq_, resBits_) == 0) {
     pinMode(pin_, OUTPUT);
     digitalWrite(pin_, activeLow_ ? HIGH : LOW); // OFF level at fan
@@ -65,12 +66,12 @@ void FanController::coolDown(float currentTemp, float setpoint, float tolerance)
   if (currentTemp > setpoint + tolerance) {
     if (lastRaw_ == 0) {
       setDutyPct(100);
-      Serial.println(F("[FAN] Cooling ON"));
+      LOGI("FAN", "Cooling ON");
     }
   } else if (currentTemp <= setpoint) {
     if (lastRaw_ > 0) {
       set(false);
-      Serial.println(F("[FAN] Cooling complete"));
+      LOGI("FAN", "Cooling complete");
     }
   }
 }
@@ -79,11 +80,11 @@ void FanController::hysteresis(float maxTempC, float onC, float offC, uint8_t du
   if (onC < offC) onC = offC;
   if (lastRaw_ == 0 && maxTempC >= onC) {
     setDutyPct(dutyPctOn);
-    Serial.println(F("[FAN] ON"));
+    LOGI("FAN", "ON");
   }
   if (lastRaw_ > 0 && maxTempC <= offC) {
     set(false);
-    Serial.println(F("[FAN] OFF"));
+    LOGI("FAN", "OFF");
   }
 }
 
@@ -10,7 +10,9 @@ class FanController {
 public:
   // Initialize PWM on 'pin'.
   // activeLow=true means LOW duty = ON at the fan input (typical).
-  bool begin(uint8_t pin, bool activeLow = true, uint32_t pwmHz = 25000, uint8_t pwmResBits = 8);
+  // ledcChannel is only used on core 2.x (tone() takes channel 0).
+  bool begin(uint8_t pin, bool activeLow = true, uint32_t pwmHz = 25000, uint8_t pwmResBits = 8,
+             uint8_t ledcChannel = 6);
 
   // Simple controls
   void set(bool on);                 // 0% or 100%
@@ -22,6 +24,7 @@ public:
   void selfTest(uint16_t msOn = 1500);
 
   bool isOn() const { return lastRaw_ > 0; }
+  uint8_t dutyPct() const { return maxRaw_ ? (uint8_t)((lastRaw_ * 100 + maxRaw_ / 2) / maxRaw_) : 0; }
 
 private:
   void apply_();
@@ -0,0 +1,69 @@
+// FanTach.cpp
+#include "FanTach.h"
+#include "Log.h"
+
+FanTach* FanTach::instance_ = nullptr;
+
+void FanTach::begin(int8_t pin, uint8_t pulsesPerRev) {
+  ppr_ = pulsesPerRev ? pulsesPerRev : 2;
+  wired_ = pin >= 0;
+  if (!wired_) return;
+  instance_ = this;
+  pinMode(pin, INPUT_PULLUP);          // opto output is open collector
+  attachInterrupt(digitalPinToInterrupt(pin), tachISR, FALLING);
+}
+
+void IRAM_ATTR FanTach::tachISR() {
+  if (instance_) instance_->onEdge(micros());
+}
+
+void IRAM_ATTR FanTach::onEdge(uint32_t us) {
+  if (edges_ && us - lastEdgeUs_ < MIN_EDGE_US) return;   // contact bounce / PWM crosstalk
+  lastEdgeUs_ = us;
+  edges_ = edges_ + 1;
+}
+
+// True once `cond` has held for `ms`; `since` tracks when it last was false
+static bool heldFor_(bool cond, uint32_t nowMs, uint32_t& since, uint32_t ms) {
+  if (!cond) { since = nowMs; return false; }
+  return nowMs - since >= ms;
+}
+
+void FanTach::update(uint32_t nowMs, uint8_t dutyPct, uint16_t expectedRpm) {
+  uint32_t edges = edges_;
+  if (!winStartMs_) {
+    winStartMs_ = nowMs;
+    winEdges_ = edges;
+  } else if (nowMs - winStartMs_ >= WINDOW_MS) {
+    uint32_t r = (edges - winEdges_) * 60000UL / (ppr_ * (nowMs - winStartMs_));
+    rpm_ = r > 0xFFFF ? 0xFFFF : (uint16_t)r;
+    winStartMs_ = nowMs;
+    winEdges_ = edges;
+  }
+
+  bool driven = dutyPct > spinFloorPct_;
+  if (driven && !driven_) drivenSinceMs_ = nowMs;
+  driven_ = driven;
+  bool spunUp = driven && nowMs - drivenSinceMs_ >= SPINUP_MS;
+
+  bool stall = heldFor_(spunUp && rpm_ == 0, nowMs, stopSinceMs_, STALL_MS);
+  bool slow  = heldFor_(spunUp && expectedRpm && rpm_ < DEGRADE_FRAC * expectedRpm,
+                        nowMs, slowSinceMs_, DEGRADE_MS);
+
+  Health h = !present() ? TACH_NONE : stall ? TACH_STALLED : slow ? TACH_DEGRADED : TACH_OK;
+  if (h == health_) return;
+  if (h == TACH_STALLED || h == TACH_DEGRADED)
+    LOGW("FAN", "Tach: %s (%u rpm at %u%%, expected %u)", healthName(h), rpm_, dutyPct, expectedRpm);
+  else
+    LOGI("FAN", "Tach: %s (%u rpm)", healthName(h), rpm_);
+  health_ = h;
+}
+
+const char* FanTach::healthName(Health h) {
+  switch (h) {
+    case TACH_OK:       return "ok";
+    case TACH_DEGRADED: return "degraded";
+    case TACH_STALLED:  return "stalled";
+    default:            return "none";
+  }
+}
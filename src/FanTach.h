@@ -0,0 +1,60 @@
+#pragma once
+#include <Arduino.h>
+
+// Fan tacho input (open-collector tach through the 6N137 opto, falling
+// edges, 2 pulses per revolution on PC fans).
+// The ISR only timestamps and counts edges; update() turns the count into
+// RPM once per WINDOW_MS and judges the fan against its duty:
+//   STALLED   driven above the spin floor for SPINUP_MS, no pulses for STALL_MS
+//   DEGRADED  below DEGRADE_FRAC of the calibrated RPM for DEGRADE_MS
+// Whether a tach is fitted comes from the board (begin() with a pin), not
+// from pulses: a wired tach that never pulses is a stalled fan. Without a
+// pin the health stays TACH_NONE and nothing is judged.
+// onEdge() takes the timestamp, so synthetic pulse trains can drive it.
+class FanTach {
+public:
+  enum Health : uint8_t { TACH_NONE, TACH_OK, TACH_DEGRADED, TACH_STALLED };
+
+  static constexpr uint16_t WINDOW_MS    = 1000;
+  static constexpr uint16_t MIN_EDGE_US  = 2000;  // glitch filter, ~15000 rpm at 2 ppr
+  static constexpr uint16_t SPINUP_MS    = 3000;
+  static constexpr uint16_t STALL_MS     = 2000;
+  static constexpr uint16_t DEGRADE_MS   = 5000;
+  static constexpr float    DEGRADE_FRAC = 0.6f;
+
+  // pin < 0 leaves the tach off
+  void begin(int8_t pin, uint8_t pulsesPerRev = 2);
+  void setSpinFloor(uint8_t pct) { spinFloorPct_ = pct; }
+
+  void onEdge(uint32_t us);
+  // Once per loop; expectedRpm 0 = uncalibrated, no degraded check
+  void update(uint32_t nowMs, uint8_t dutyPct, uint16_t expectedRpm = 0);
+
+  uint16_t rpm() const { return rpm_; }
+  Health   health() const { return health_; }
+  bool     present() const { return wired_; }
+  bool     pulsed() const { return edges_ != 0; }   // any edge since begin()
+  bool     stalled() const { return health_ == TACH_STALLED; }
+  static const char* healthName(Health h);
+
+private:
+  static void IRAM_ATTR tachISR();
+  static FanTach* instance_;
+
+  bool     wired_ = false;
+  uint8_t  ppr_ = 2;
+  uint8_t  spinFloorPct_ = 20;
+
+  volatile uint32_t edges_ = 0;   // written by the ISR only
+  uint32_t lastEdgeUs_ = 0;
+
+  uint32_t winStartMs_ = 0;
+  uint32_t winEdges_ = 0;
+  uint16_t rpm_ = 0;
+
+  bool     driven_ = false;
+  uint32_t drivenSinceMs_ = 0;
+  uint32_t stopSinceMs_ = 0;      // rpm 0 while driven
+  uint32_t slowSinceMs_ = 0;      // under the degraded threshold
+  Health   health_ = TACH_NONE;
+};
@@ -0,0 +1,85 @@
+#pragma once
+#include <Arduino.h>
+
+// Sliding-window Hampel filter for raw ADC samples.
+// Keeps the last N samples both in arrival order (ring) and sorted, so the
+// median is O(1) and each new sample costs one O(N) shift. A sample further
+// than k * 1.4826 * MAD from the window median is replaced by the median.
+// Fixed memory: MAXN sets the storage, the active window is set at runtime.
+template <uint8_t MAXN>
+class HampelFilter {
+  static_assert(MAXN >= 3 && (MAXN & 1), "window storage must be odd and >= 3");
+public:
+  // window is clamped to [3, MAXN] and forced odd. k = 0 gives a plain median.
+  void configure(uint8_t window, float k = 3.0f) {
+    if (window < 3) window = 3;
+    if (window > MAXN) window = MAXN;
+    if (!(window & 1)) window--;
+    n_ = window; k_ = k;
+    reset();
+  }
+
+  void reset() { count_ = 0; head_ = 0; replaced_ = 0; }
+
+  uint8_t  window()   const { return n_; }
+  uint32_t replaced() const { return replaced_; }   // outliers rejected so far
+
+  uint16_t filter(uint16_t x) {
+    // Warm-up: fill the window, pass samples through unchanged
+    if (count_ < n_) {
+      ring_[count_] = x;
+      insertSorted_(x, count_);
+      count_++;
+      return x;
+    }
+
+    // Drop the oldest sample, add the new one
+    uint16_t old = ring_[head_];
+    ring_[head_] = x;
+    head_ = (head_ + 1 == n_) ? 0 : head_ + 1;
+    removeSorted_(old);
+    insertSorted_(x, n_ - 1);
+
+    uint16_t med = sorted_[n_ / 2];
+    if (k_ <= 0.0f) return med;
+
+    float dev = (x > med) ? float(x - med) : float(med - x);
+    float limit = k_ * 1.4826f * mad_(med);
+    if (dev > limit && dev > 1.0f) { replaced_++; return med; }
+    return x;
+  }
+
+private:
+  uint16_t ring_[MAXN];
+  uint16_t sorted_[MAXN];
+  uint8_t  n_ = MAXN, count_ = 0, head_ = 0;
+  float    k_ = 3.0f;
+  uint32_t replaced_ = 0;
+
+  // len = number of valid entries before insertion
+  void insertSorted_(uint16_t x, uint8_t len) {
+    int i = len;
+    while (i > 0 && sorted_[i - 1] > x) { sorted_[i] = sorted_[i - 1]; i--; }
+    sorted_[i] = x;
+  }
+
+  void removeSorted_(uint16_t x) {
+    uint8_t i = 0;
+    while (i < n_ - 1 && sorted_[i] != x) i++;
+    for (; i < n_ - 1; i++) sorted_[i] = sorted_[i + 1];
+  }
+
+  // Median absolute deviation: the deviations to the left and right of the
+  // median are each already sorted, so merge outwards and stop halfway.
+  uint16_t mad_(uint16_t med) const {
+    int mid = n_ / 2;
+    int l = mid - 1, r = mid + 1;
+    uint16_t d = 0;
+    for (int taken = 1; taken <= mid; taken++) {
+      uint16_t dl = (l >= 0) ? uint16_t(med - sorted_[l]) : 0xFFFF;
+      uint16_t dr = (r < n_) ? uint16_t(sorted_[r] - med) : 0xFFFF;
+      if (dl <= dr) { d = dl; l--; } else { d = dr; r++; }
+    }
+    return d;
+  }
+};
@@ -1,5 +1,7 @@
 // HeaterController.cpp
 #include "HeaterController.h"
+#include "Clock.h"
+#include "Log.h"
 
 void HeaterController::begin(uint8_t ssrFrontPin, uint8_t ssrBackPin, unsigned long windowMs) {
     pinFront_ = ssrFrontPin;
@@ -13,10 +15,10 @@ void HeaterController::begin(uint8_t ssrFrontPin, uint8_t ssrBackPin, unsigned l
     drivePin(pinBack_, false);
     
     // Initialize timing
-    windowStartFront_ = millis();
-    windowStartBack_ = millis();
-    lastTimeFront_ = millis();
-    lastTimeBack_ = millis();
+    windowStartFront_ = clockMs();
+    windowStartBack_ = clockMs();
+    lastTimeFront_ = clockMs();
+    lastTimeBack_ = clockMs();
     lastDebugTime_ = 0;
     
     // Initialize PID state
@@ -40,8 +42,8 @@ void HeaterController::reset() {
     errorPrevBack_ = 0.0f;
     
     // Reset timing
-    lastTimeFront_ = millis();
-    lastTimeBack_ = millis();
+    lastTimeFront_ = clockMs();
+    lastTimeBack_ = clockMs();
     
     // Turn off outputs
     dutyFront_ = 0;
@@ -51,7 +53,7 @@ void HeaterController::reset() {
     
     lastError_ = 0.0f;
     
-    Serial.println("HeaterController: Reset - All outputs OFF, PID states cleared");
+    LOGD("HEAT", "Reset - All outputs OFF, PID states cleared");
 }
 
 void HeaterController::setGains(const PIDGains& gains) {
@@ -61,26 +63,18 @@ void HeaterController::setGains(const PIDGains& gains) {
     errorIntegralFront_ = 0.0f;
     errorIntegralBack_ = 0.0f;
     
-    Serial.printf("HeaterController: PID gains updated - P:%.2f I:%.2f D:%.2f IMax:%.1f\n",
-                  gains_.P, gains_.I, gains_.D, gains_.iMax);
+    LOGI("HEAT", "PID gains updated - P:%.2f I:%.2f D:%.2f IMax:%.1f",
+         gains_.P, gains_.I, gains_.D, gains_.iMax);
 }
 
 void HeaterController::control(HeatState selection, float setpoint, float tempFront, float tempBack) {
-    unsigned long now = millis();
+    unsigned long now = clockMs();
     
     // Front heater control
     if (selection == HEAT_FRONT || selection == HEAT_BOTH) {
         dutyFront_ = calculatePID(setpoint, tempFront, errorIntegralFront_, 
                                   errorPrevFront_, lastTimeFront_);
-        
-        // Fixed window timing - don't let windows drift
-        if (now - windowStartFront_ >= windowMs_) {
-            windowStartFront_ += windowMs_;  // Maintain exact timing
-        }
-        
-        unsigned long onTime = (dutyFront_ * windowMs_) / 100;
-        bool outputOn = (now - windowStartFront_) < onTime;
-        drivePin(pinFront_, outputOn);
+        driveWindow(pinFront_, dutyFront_, windowStartFront_, now);
         
     } else {
         dutyFront_ = 0;
@@ -92,14 +86,7 @@ void HeaterController::control(HeatState selection, float setpoint, float tempFr
     if (selection == HEAT_BACK || selection == HEAT_BOTH) {
         dutyBack_ = calculatePID(setpoint, tempBack, errorIntegralBack_, 
                                  errorPrevBack_, lastTimeBack_);
-        
-        if (now - windowStartBack_ >= windowMs_) {
-            windowStartBack_ += windowMs_;  // Fixed timing
-        }
-        
-        unsigned long onTime = (dutyBack_ * windowMs_) / 100;
-        bool outputOn = (now - windowStartBack_) < onTime;
-        drivePin(pinBack_, outputOn);
+        driveWindow(pinBack_, dutyBack_, windowStartBack_, now);
         
     } else {
         dutyBack_ = 0;
@@ -110,14 +97,33 @@ void HeaterController::control(HeatState selection, float setpoint, float tempFr
     // Debug every 2 seconds
     static unsigned long lastDebug = 0;
     if (now - lastDebug > 2000) {
-        Serial.printf("SP:%.1f F:%.1f(%.0f%%) B:%.1f(%.0f%%)\n", 
-                      setpoint, tempFront, dutyFront_, tempBack, dutyBack_);
+        LOGI("PID", "SP:%.1f F:%.1f(%d%%) B:%.1f(%d%%)",
+             setpoint, tempFront, dutyFront_, tempBack, dutyBack_);
         lastDebug = now;
     }
 }
+void HeaterController::drive(int dutyFrontPct, int dutyBackPct) {
+    unsigned long now = clockMs();
+    dutyFront_ = constrain(dutyFrontPct, 0, maxOutputPct_);
+    dutyBack_ = constrain(dutyBackPct, 0, maxOutputPct_);
+    driveWindow(pinFront_, dutyFront_, windowStartFront_, now);
+    driveWindow(pinBack_, dutyBack_, windowStartBack_, now);
+}
+
+void HeaterController::driveWindow(uint8_t pin, int dutyPct, unsigned long& windowStart, unsigned long now) {
+    // Fixed window timing - don't let windows drift
+    if (now - windowStart >= windowMs_) {
+        windowStart += windowMs_;  // Maintain exact timing
+    }
+    
+    unsigned long onTime = (dutyPct * windowMs_) / 100;
+    bool outputOn = (now - windowStart) < onTime;
+    drivePin(pin, outputOn);
+}
+
 int HeaterController::calculatePID(float setpoint, float processValue, 
                                   float& errorIntegral, float& errorPrev, unsigned long& lastTime) {
-    unsigned long now = millis();
+    unsigned long now = clockMs();
     float deltaTime = (now - lastTime) / 1000.0f;
     
     // Prevent division by zero and handle timer rollover
@@ -160,11 +166,15 @@ int HeaterController::calculatePID(float setpoint, float processValue,
 }
 
 void HeaterController::drivePin(uint8_t pin, bool state) {
+#if defined(REFLOW_REPLAY) || defined(REFLOW_BENCH)
+    // Recorded data and benchmarks must never switch the real SSRs
+    state = false;
+#endif
     digitalWrite(pin, state ? HIGH : LOW);
 }
 
 void HeaterController::printDebugInfo(float setpoint, float tempFront, float tempBack, HeatState selection) {
-    unsigned long now = millis();
+    unsigned long now = clockMs();
     
     // Limit debug output to once per second
     if (now - lastDebugTime_ < 1000) {
@@ -172,18 +182,6 @@ void HeaterController::printDebugInfo(float setpoint, float tempFront, float tem
     }
     lastDebugTime_ = now;
     
-    Serial.printf("PID: SP=%.1f°C", setpoint);
-    
-    if (selection == HEAT_FRONT || selection == HEAT_BOTH) {
-        Serial.printf(" F=%.1f°C(%.0f%%)", tempFront, dutyFront_);
-    }
-    
-    if (selection == HEAT_BACK || selection == HEAT_BOTH) {
-        Serial.printf(" B=%.1f°C(%.0f%%)", tempBack, dutyBack_);
-    }
-    
-    Serial.printf(" Err=%.1f°C", lastError_);
-    
     const char* modeStr;
     switch (selection) {
         case HEAT_OFF:   modeStr = "OFF"; break;
@@ -192,5 +190,6 @@ void HeaterController::printDebugInfo(float setpoint, float tempFront, float tem
         case HEAT_BOTH:  modeStr = "BOTH"; break;
         default:         modeStr = "UNKNOWN"; break;
     }
-    Serial.printf(" Mode=%s\n", modeStr);
+    LOGD("PID", "SP=%.1f°C F=%.1f°C(%d%%) B=%.1f°C(%d%%) Err=%.1f°C Mode=%s",
+         setpoint, tempFront, dutyFront_, tempBack, dutyBack_, lastError_, modeStr);
 }
@@ -8,7 +8,10 @@ public:
     void begin(uint8_t ssrFrontPin, uint8_t ssrBackPin, unsigned long windowMs = 1000);
     void reset();
     void setGains(const PIDGains& gains);
+    const PIDGains& gains() const { return gains_; }
     void control(HeatState selection, float setpoint, float tempFront, float tempBack);
+    // Open loop: fixed duties through the same SSR windows (characterization)
+    void drive(int dutyFrontPct, int dutyBackPct);
     
     // Status reporting
     int dutyFrontPct() const { return dutyFront_; }
@@ -52,6 +55,7 @@ private:
     
     // Internal methods
     void drivePin(uint8_t pin, bool state);
+    void driveWindow(uint8_t pin, int dutyPct, unsigned long& windowStart, unsigned long now);
     int calculatePID(float setpoint, float processValue, 
                     float& errorIntegral, float& errorPrev, unsigned long& lastTime);
     void printDebugInfo(float setpoint, float tempFront, float tempBack, HeatState selection);
@@ -0,0 +1,106 @@
+// Log.cpp
+#include "Log.h"
+#include <stdarg.h>
+
+Logger logger;
+
+void Logger::begin(HardwareSerial& out, uint8_t taskPriority) {
+  out_ = &out;
+  // Core 0 keeps the drain off the control loop's core (loop runs on 1)
+  xTaskCreatePinnedToCore(task_, "log", 2048, this, taskPriority, nullptr, 0);
+}
+
+void Logger::task_(void* arg) {
+  Logger* self = static_cast<Logger*>(arg);
+  for (;;) {
+    self->drain();
+    vTaskDelay(pdMS_TO_TICKS(5));
+  }
+}
+
+void Logger::setRateLimit(const char* tag, uint16_t intervalMs) {
+  TagLimit* l = findLimit_(tag);
+  if (!l) {
+    if (limitCount_ >= MAX_TAGS) return;
+    l = &limits_[limitCount_++];
+    l->tag = tag;
+  }
+  l->intervalMs = intervalMs;
+}
+
+Logger::TagLimit* Logger::findLimit_(const char* tag) {
+  for (uint8_t i = 0; i < limitCount_; i++) {
+    if (limits_[i].tag == tag || strcmp(limits_[i].tag, tag) == 0) return &limits_[i];
+  }
+  return nullptr;
+}
+
+// Whole lines only: a line that does not fit is dropped, never truncated
+bool Logger::push_(const char* s, uint16_t n) {
+  uint16_t head = head_.load(std::memory_order_relaxed);
+  uint16_t tail = tail_.load(std::memory_order_acquire);
+  uint16_t used = (uint16_t)(head - tail) & (RING_SIZE - 1);
+  if (n >= RING_SIZE - 1 - used) return false;
+
+  for (uint16_t i = 0; i < n; i++) ring_[(head + i) & (RING_SIZE - 1)] = s[i];
+  head_.store((head + n) & (RING_SIZE - 1), std::memory_order_release);
+  return true;
+}
+
+void Logger::log(LogLevel lvl, const char* tag, const char* fmt, ...) {
+  if (lvl < level_) return;
+
+  uint16_t held = 0;
+  TagLimit* l = findLimit_(tag);
+  if (l) {
+    uint32_t now = millis();
+    if (l->lastMs && now - l->lastMs < l->intervalMs) {
+      l->held++; suppressed_++;
+      return;
+    }
+    l->lastMs = now ? now : 1;
+    held = l->held;
+    l->held = 0;
+  }
+
+  char line[LINE_MAX];
+  int n = (lvl >= LOG_WARN)
+        ? snprintf(line, sizeof(line), "[%s] %s: ", tag, lvl == LOG_ERROR ? "ERROR" : "WARN")
+        : snprintf(line, sizeof(line), "[%s] ", tag);
+  va_list ap;
+  va_start(ap, fmt);
+  n += vsnprintf(line + n, sizeof(line) - n, fmt, ap);
+  va_end(ap);
+  if (n > LINE_MAX - 16) n = LINE_MAX - 16;
+  if (held) n += snprintf(line + n, sizeof(line) - n, " (+%u held)", held);
+  line[n++] = '\n';
+
+  if (!push_(line, n)) dropped_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Logger::drain() {
+  if (!out_) return;
+
+  uint16_t tail = tail_.load(std::memory_order_relaxed);
+  uint16_t head = head_.load(std::memory_order_acquire);
+  while (tail != head) {
+    int room = out_->availableForWrite();
+    if (room <= 0) return;
+    uint16_t chunk = (head > tail) ? head - tail : RING_SIZE - tail;   // contiguous
+    if (chunk > room) chunk = room;
+    out_->write((const uint8_t*)&ring_[tail], chunk);
+    tail = (tail + chunk) & (RING_SIZE - 1);
+    tail_.store(tail, std::memory_order_release);
+  }
+
+  // Ring is empty here, so the report never lands mid-line
+  uint32_t d = dropped();
+  if (d != droppedReported_) {
+    char msg[40];
+    int n = snprintf(msg, sizeof(msg), "[LOG] %lu dropped\n", (unsigned long)(d - droppedReported_));
+    if (out_->availableForWrite() >= n) {
+      out_->write((const uint8_t*)msg, n);
+      droppedReported_ = d;
+    }
+  }
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+enum LogLevel : uint8_t { LOG_DEBUG, LOG_INFO, LOG_WARN, LOG_ERROR, LOG_OFF };
+
+// Non-blocking logger for the control loop.
+// log() formats into a lock-free single-producer ring and returns; a
+// low-priority task drains the ring to the UART, writing only what the TX
+// buffer can take. When the ring is full the message is dropped and
+// counted. Tags can be rate limited: messages inside the interval are
+// counted and the next one that gets through reports how many were held.
+// Producer side is the loop task only.
+class Logger {
+public:
+  // Start the drain task. Without it, call drain() from the loop.
+  void begin(HardwareSerial& out, uint8_t taskPriority = 1);
+
+  void setLevel(LogLevel lvl) { level_ = lvl; }
+  void setRateLimit(const char* tag, uint16_t intervalMs);
+
+  void log(LogLevel lvl, const char* tag, const char* fmt, ...) __attribute__((format(printf, 4, 5)));
+
+  // Queue pre-built bytes (e.g. telemetry frames) in stream order; all or nothing
+  bool writeRaw(const void* data, uint16_t n) { return push_((const char*)data, n); }
+
+  // Move queued bytes to the output without blocking
+  void drain();
+
+  uint32_t dropped()    const { return dropped_.load(std::memory_order_relaxed); }
+  uint32_t suppressed() const { return suppressed_; }
+
+private:
+  static constexpr uint16_t RING_SIZE = 2048;   // power of two
+  static constexpr uint8_t  MAX_TAGS  = 12;
+  static constexpr uint8_t  LINE_MAX  = 128;
+
+  struct TagLimit {
+    const char* tag;
+    uint16_t    intervalMs;
+    uint32_t    lastMs;
+    uint16_t    held;
+  };
+
+  HardwareSerial*       out_ = nullptr;
+  LogLevel              level_ = LOG_INFO;
+  char                  ring_[RING_SIZE];
+  std::atomic<uint16_t> head_{0};   // written by producer
+  std::atomic<uint16_t> tail_{0};   // written by drain
+  std::atomic<uint32_t> dropped_{0};
+  uint32_t              droppedReported_ = 0;
+  uint32_t              suppressed_ = 0;
+  TagLimit              limits_[MAX_TAGS] = {};
+  uint8_t               limitCount_ = 0;
+
+  TagLimit* findLimit_(const char* tag);
+  bool push_(const char* s, uint16_t n);
+  static void task_(void* arg);
+};
+
+extern Logger logger;
+
+#define LOGD(tag, ...) logger.log(LOG_DEBUG, tag, __VA_ARGS__)
+#define LOGI(tag, ...) logger.log(LOG_INFO,  tag, __VA_ARGS__)
+#define LOGW(tag, ...) logger.log(LOG_WARN,  tag, __VA_ARGS__)
+#define LOGE(tag, ...) logger.log(LOG_ERROR, tag, __VA_ARGS__)
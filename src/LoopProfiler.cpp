@@ -0,0 +1,76 @@
+// LoopProfiler.cpp
+#include "LoopProfiler.h"
+#include "Log.h"
+
+#ifdef LOOP_PROFILING
+LoopProfiler loopProfiler;
+#endif
+
+const char* LoopProfiler::stageName(ProfStage s) {
+  static const char* names[STAGE_COUNT] = { "sensors", "encoder", "control", "display", "logging", "loop" };
+  return s < STAGE_COUNT ? names[s] : "?";
+}
+
+// octave = floor(log2(us)), split in two halves
+uint8_t LoopProfiler::bucketOf_(uint32_t us) {
+  if (us < 2) return 0;
+  uint8_t oct = 31 - __builtin_clz(us);
+  uint8_t b = oct * 2 + ((us >> (oct - 1)) & 1);
+  return b < BUCKETS ? b : BUCKETS - 1;
+}
+
+uint32_t LoopProfiler::bucketTop_(uint8_t b) {
+  uint8_t oct = b / 2;
+  if (oct == 0) return 1;
+  uint32_t half = 1u << (oct - 1);
+  return (1u << oct) + (b & 1) * half + half - 1;
+}
+
+void LoopProfiler::record(ProfStage stage, uint32_t us) {
+  Stats& s = stats_[mode_][stage];
+  if (!s.count || us < s.minUs) s.minUs = us;
+  if (us > s.maxUs) s.maxUs = us;
+  s.count++;
+  s.sumUs += us;
+
+  uint16_t& h = s.hist[bucketOf_(us)];
+  if (h == 0xFFFF) {
+    // Halve the histogram rather than saturate; keeps percentiles valid
+    for (uint8_t i = 0; i < BUCKETS; i++) s.hist[i] >>= 1;
+  }
+  h++;
+}
+
+uint32_t LoopProfiler::avgUs(uint8_t mode, ProfStage stage) const {
+  const Stats& s = stats_[mode][stage];
+  return s.count ? (uint32_t)(s.sumUs / s.count) : 0;
+}
+
+uint32_t LoopProfiler::percentileUs(uint8_t mode, ProfStage stage, float p) const {
+  const Stats& s = stats_[mode][stage];
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < BUCKETS; i++) total += s.hist[i];
+  if (!total) return 0;
+
+  uint32_t want = (uint32_t)(total * p + 0.5f), acc = 0;
+  for (uint8_t i = 0; i < BUCKETS; i++) {
+    acc += s.hist[i];
+    if (acc >= want) return min(bucketTop_(i), s.maxUs);
+  }
+  return s.maxUs;
+}
+
+#ifdef LOOP_PROFILING
+void LoopProfiler::dump() const {
+  LOGI("PROF", "mode,stage,count,min_us,avg_us,p99_us,max_us");
+  for (uint8_t m = 0; m < MODE_COUNT; m++) {
+    for (uint8_t st = 0; st < STAGE_COUNT; st++) {
+      const Stats& s = stats_[m][st];
+      if (!s.count) continue;
+      LOGI("PROF", "%s,%s,%lu,%lu,%lu,%lu,%lu", modeName(m), stageName((ProfStage)st),
+           (unsigned long)s.count, (unsigned long)s.minUs, (unsigned long)avgUs(m, (ProfStage)st),
+           (unsigned long)percentileUs(m, (ProfStage)st, 0.99f), (unsigned long)s.maxUs);
+    }
+  }
+}
+#endif
@@ -0,0 +1,68 @@
+#pragma once
+#include <Arduino.h>
+#include "Types.h"
+
+// Per-stage loop() timing, bucketed by Mode.
+// Build with -DLOOP_PROFILING to enable. Without it PROF_STAGE() and
+// PROF_MODE() expand to nothing, and the global profiler (~6 KB of
+// counters), dump() and the Diag screen are not built.
+enum ProfStage : uint8_t { STAGE_SENSORS, STAGE_ENCODER, STAGE_CONTROL, STAGE_DISPLAY, STAGE_LOGGING, STAGE_LOOP, STAGE_COUNT };
+
+class LoopProfiler {
+public:
+  // Two buckets per power of two, 1 µs .. ~1 s
+  static constexpr uint8_t BUCKETS = 40;
+
+  struct Stats {
+    uint32_t count;
+    uint32_t minUs, maxUs;
+    uint64_t sumUs;
+    uint16_t hist[BUCKETS];
+  };
+
+  void setMode(uint8_t mode) { mode_ = mode < MODE_COUNT ? mode : 0; }
+  void record(ProfStage stage, uint32_t us);
+  void reset() { memset(stats_, 0, sizeof(stats_)); }
+
+  const Stats& stats(uint8_t mode, ProfStage stage) const { return stats_[mode][stage]; }
+  uint32_t avgUs(uint8_t mode, ProfStage stage) const;
+  uint32_t percentileUs(uint8_t mode, ProfStage stage, float p) const;
+
+#ifdef LOOP_PROFILING
+  // One line per stage for every mode that has samples
+  void dump() const;
+#endif
+
+  static const char* stageName(ProfStage s);
+
+  // RAII timer around a stage, cycle-counter based
+  class Scope {
+  public:
+    Scope(LoopProfiler& p, ProfStage s) : p_(p), s_(s), start_(ESP.getCycleCount()) {}
+    ~Scope() { p_.record(s_, (ESP.getCycleCount() - start_) / cyclesPerUs_()); }
+  private:
+    LoopProfiler& p_;
+    ProfStage     s_;
+    uint32_t      start_;
+  };
+
+private:
+  Stats   stats_[MODE_COUNT][STAGE_COUNT] = {};
+  uint8_t mode_ = 0;
+
+  static uint8_t  bucketOf_(uint32_t us);
+  static uint32_t bucketTop_(uint8_t b);
+  static uint32_t cyclesPerUs_() { static uint32_t c = getCpuFrequencyMhz(); return c; }
+};
+
+#ifdef LOOP_PROFILING
+extern LoopProfiler loopProfiler;
+
+#define PROF_CAT2_(a, b) a##b
+#define PROF_CAT_(a, b)  PROF_CAT2_(a, b)
+#define PROF_STAGE(stage) LoopProfiler::Scope PROF_CAT_(profScope_, __LINE__)(loopProfiler, stage)
+#define PROF_MODE(mode)   loopProfiler.setMode(mode)
+#else
+#define PROF_STAGE(stage) do {} while (0)
+#define PROF_MODE(mode)   do {} while (0)
+#endif
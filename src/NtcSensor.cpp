@@ -0,0 +1,45 @@
+#include "NtcSensor.h"
+
+bool NtcSensor::begin() {
+  pinMode(pin_, INPUT);
+  // 3.3V range (needed because at high temp the node approaches Vref)
+  analogSetPinAttenuation(pin_, ADC_11db);
+  analogReadResolution(12); // 0..4095
+  return true;
+}
+
+/**
+ * Vnode = Vref * (Rseries / (Rseries + Rntc))
+ * => Rntc = Rseries * (Vref - Vnode) / Vnode
+ */
+float NtcSensor::adcToTemp(float adc) const {
+  // ADC → Voltage
+  float v = (adc / p_.adcMax) * p_.vref;
+  // Avoid divide-by-zero / log(<=0)
+  if (v < 0.0005f) v = 0.0005f;
+  if (v > p_.vref - 0.0005f) v = p_.vref - 0.0005f;
+
+  // Compute NTC resistance for pull-DOWN wiring (series resistor to GND)
+  float rntc = p_.seriesOhm * (p_.vref - v) / v;
+
+  // Beta equation
+  float invT = (1.0f / (p_.nominalC + 273.15f))
+             + (log(rntc / p_.nominalOhm) / p_.beta);
+  return (1.0f / invT) - 273.15f;
+}
+
+// The ADC is fast enough to take the whole burst each loop
+bool NtcSensor::poll(uint32_t) {
+  // SSR switching puts single-sample spikes on the ADC; reject them
+  // before they reach the mean
+  float sum = 0;
+  for (int i = 0; i < 32; i++) {
+    sum += spike_.filter(analogRead(pin_));
+    delayMicroseconds(80);
+  }
+  float adc = sum / 32.0f;
+  raw_ = (uint16_t)(adc + 0.5f);
+
+  accept_(adcToTemp(adc));   // holds last good on nonsense
+  return true;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "TempSensor.h"
+#include "HampelFilter.h"
+
+// Divider and thermistor constants; the board descriptor (Boards.h) picks them
+struct NtcParams {
+  float seriesOhm;      // fixed resistor, NTC side to 3V3, this one to GND
+  float nominalOhm;     // NTC at nominalC
+  float nominalC;
+  float beta;
+  float adcMax;         // full-scale code
+  float vref;           // measured ADC reference (e.g. 3.285 V)
+};
+
+// 100k/3950 with 6.8k to GND, 12-bit ADC
+static constexpr NtcParams NTC_100K_3950_6K8 = {6800.0f, 100000.0f, 25.0f, 3950.0f, 4095.0f, 3.30f};
+
+// NTC in a divider on an ESP32 ADC pin:
+// 3V3 ── NTC ──●── Rseries ── GND, ADC at ●
+class NtcSensor : public TempSensor {
+public:
+  static constexpr uint8_t DEFAULT_SPIKE_WINDOW = 7;
+
+  NtcSensor(uint8_t pin = 255, const NtcParams& p = NTC_100K_3950_6K8) : pin_(pin), p_(p) {
+    spike_.configure(DEFAULT_SPIKE_WINDOW);
+  }
+  void setPin(uint8_t pin, const NtcParams& p) { pin_ = pin; p_ = p; }
+
+  bool begin() override;
+  bool poll(uint32_t nowMs) override;
+  const char* name() const override { return "NTC"; }
+
+  // Spike rejection on raw ADC samples (window 3..15, odd; k = 0 → median).
+  // Survives begin(), so it can be set before or after.
+  void setSpikeFilter(uint8_t window, float k = 3.0f) { spike_.configure(window, k); }
+  uint8_t  spikeWindow() const { return spike_.window(); }
+  uint32_t spikesRejected() const { return spike_.replaced(); }
+
+  float adcToTemp(float adc) const;
+
+private:
+  uint8_t   pin_;
+  NtcParams p_;
+  HampelFilter<15> spike_;
+};
@@ -0,0 +1,90 @@
+// OledFramebuffer.cpp
+#include "OledFramebuffer.h"
+
+bool OledFramebuffer::pixel(int16_t x, int16_t y) const {
+  if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT) return false;
+  const uint8_t* buf = const_cast<OledFramebuffer*>(this)->getBuffer();
+  return buf[x + (y / 8) * WIDTH] & (1 << (y & 7));
+}
+
+uint32_t OledFramebuffer::crc32() const {
+  // CRC-32 over the frame in row-major pixel order, so it matches the PBM
+  uint32_t crc = 0xFFFFFFFF;
+  for (int16_t y = 0; y < HEIGHT; y++) {
+    for (int16_t x = 0; x < WIDTH; x += 8) {
+      uint8_t b = 0;
+      for (uint8_t i = 0; i < 8; i++) b = (b << 1) | (pixel(x + i, y) ? 1 : 0);
+      crc ^= b;
+      for (uint8_t k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+void OledFramebuffer::writePbm(Print& out) const {
+  char row[PBM_MAX_W + 2];
+  out.printf("P1\n%d %d\n", WIDTH, HEIGHT);
+  for (int16_t y = 0; y < HEIGHT; y++) {
+    int16_t x = 0;
+    for (; x < WIDTH && x < PBM_MAX_W; x++) row[x] = pixel(x, y) ? '1' : '0';
+    row[x++] = '\n';
+    row[x] = 0;
+    out.print(row);
+  }
+}
+
+void OledFramebuffer::drawPixel(int16_t x, int16_t y, uint16_t c) {
+  Nest n(*this);
+  stats_.pixels++;
+  Adafruit_SSD1306::drawPixel(x, y, c);
+}
+
+void OledFramebuffer::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) {
+  Nest n(*this);
+  if (w > 0) stats_.pixels += w;
+  Adafruit_SSD1306::drawFastHLine(x, y, w, c);
+}
+
+void OledFramebuffer::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) {
+  Nest n(*this);
+  if (h > 0) stats_.pixels += h;
+  Adafruit_SSD1306::drawFastVLine(x, y, h, c);
+}
+
+void OledFramebuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+  Nest n(*this);
+  Adafruit_SSD1306::fillRect(x, y, w, h, c);
+}
+
+void OledFramebuffer::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+  Nest n(*this);
+  Adafruit_SSD1306::drawRect(x, y, w, h, c);
+}
+
+void OledFramebuffer::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t c) {
+  Nest n(*this);
+  Adafruit_SSD1306::drawLine(x0, y0, x1, y1, c);
+}
+
+void OledFramebuffer::fillScreen(uint16_t c) {
+  Nest n(*this);
+  Adafruit_SSD1306::fillScreen(c);
+}
+
+size_t OledFramebuffer::write(uint8_t ch) {
+  Nest n(*this);
+  if (ch != '\n' && ch != '\r') stats_.glyphs++;
+  return Adafruit_SSD1306::write(ch);
+}
+
+void OledFramebuffer::clearDisplay() {
+  Nest n(*this);
+  stats_.pixels += (uint32_t)WIDTH * HEIGHT;
+  Adafruit_SSD1306::clearDisplay();
+}
+
+void OledFramebuffer::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                                   int16_t x2, int16_t y2, uint16_t c) {
+  Nest n(*this);
+  Adafruit_SSD1306::fillTriangle(x0, y0, x1, y1, x2, y2, c);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+
+// 128x64 1-bpp SSD1306 frame that counts what gets drawn into it.
+// DisplayUI draws through this, so every screen's cost (primitives, text
+// glyphs, pixel writes incl. overdraw) can be read back after rendering,
+// and the frame itself dumped as a PBM or reduced to a CRC.
+// Nested GFX calls (fillRect -> drawFastVLine ...) count as one primitive.
+class OledFramebuffer : public Adafruit_SSD1306 {
+public:
+  struct Stats {
+    uint32_t primitives;  // top-level draw calls, clears included
+    uint32_t glyphs;      // characters printed
+    uint32_t pixels;      // pixel writes, clears count the whole frame
+  };
+
+  OledFramebuffer(uint8_t w, uint8_t h, TwoWire* wire, int8_t rst)
+    : Adafruit_SSD1306(w, h, wire, rst) {}
+
+  const Stats& stats() const { return stats_; }
+  void resetStats() { stats_ = Stats{}; }
+
+  // Pixels are read back from the SSD1306 page buffer (bit = row % 8)
+  bool pixel(int16_t x, int16_t y) const;
+  uint32_t crc32() const;
+  // Plain (P1) PBM, one text row per pixel row
+  void writePbm(Print& out) const;
+
+  // Counted overrides of the GFX virtuals
+  void drawPixel(int16_t x, int16_t y, uint16_t c) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) override;
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) override;
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t c) override;
+  void fillScreen(uint16_t c) override;
+  size_t write(uint8_t ch) override;
+  using Print::write;
+
+  // Non-virtual in the libraries; hidden here so calls through this type count
+  void clearDisplay();
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    int16_t x2, int16_t y2, uint16_t c);
+
+private:
+  static constexpr int16_t PBM_MAX_W = 128;
+  Stats   stats_ = {};
+  uint8_t depth_ = 0;
+
+  // Counts a primitive only for the outermost call
+  struct Nest {
+    OledFramebuffer& f;
+    explicit Nest(OledFramebuffer& fb) : f(fb) { if (f.depth_++ == 0) f.stats_.primitives++; }
+    ~Nest() { f.depth_--; }
+  };
+};
@@ -0,0 +1,248 @@
+// PlantCharacterizer.cpp
+#include "PlantCharacterizer.h"
+#include "Telemetry.h"
+#include "Log.h"
+#include <LittleFS.h>
+
+static const float BAND_TOP_C[PLANT_BANDS] = {100.0f, 160.0f, 250.0f};
+static const char* BAND_NAMES[PLANT_BANDS + 1] = {"<100", "100-160", "160-250", "all"};
+static const char* PLATE_NAMES[2] = {"front", "back"};
+static const uint16_t MIN_FIT_SAMPLES = 30;
+static const float    MIN_BAND_R2 = 0.8f;        // weaker band fits fall back to the whole range
+static const float    MIN_ALL_R2  = 0.5f;
+static const uint8_t  FAN_SPINUP_SECS = 5;
+
+uint8_t plantBand(float tempC) {
+  for (uint8_t b = 0; b < PLANT_BANDS - 1; b++)
+    if (tempC < BAND_TOP_C[b]) return b;
+  return PLANT_BANDS - 1;
+}
+
+static bool usable_(const FopdtFit& f, uint8_t band) {
+  return f.r2 >= (band == PLANT_ALL ? MIN_ALL_R2 : MIN_BAND_R2) && f.heatGain > 0.0f && f.lossCoef > 0.0f;
+}
+
+PlantParams plantParamsFor(const PlantModel& m, uint8_t plate, uint8_t band, const PlantParams& fallback) {
+  const FopdtFit* f = &m.fit[plate][band];
+  if (!usable_(*f, band)) f = &m.fit[plate][PLANT_ALL];
+  if (!usable_(*f, PLANT_ALL)) return fallback;
+  // the sensor lag filter needs a non-zero time constant
+  return PlantParams{f->heatGain, f->lossCoef, max(f->deadSecs, 1.0f), m.ambientC};
+}
+
+// ---- Least squares ----
+void PlantCharacterizer::Sums::add(float x1, float x2, float y) {
+  s11 += x1 * x1; s12 += x1 * x2; s22 += x2 * x2;
+  s1y += x1 * y;  s2y += x2 * y;  syy += y * y;  sy += y;
+  n++;
+}
+
+bool PlantCharacterizer::Sums::solve(float& a, float& b, float& r2) const {
+  float det = s11 * s22 - s12 * s12;
+  if (n < MIN_FIT_SAMPLES || det <= 1e-6f * s11 * s22) return false;
+  a = (s1y * s22 - s2y * s12) / det;
+  b = (s2y * s11 - s1y * s12) / det;
+  float sse = syy - 2.0f * (a * s1y + b * s2y) + a * a * s11 + 2.0f * a * b * s12 + b * b * s22;
+  float sst = syy - sy * sy / n;
+  r2 = sst > 0.0f ? 1.0f - sse / sst : 0.0f;
+  return true;
+}
+
+// ---- Sequence ----
+const uint8_t PlantCharacterizer::STEP_DUTIES[STEP_COUNT] = {30, 60, 90};
+
+void PlantCharacterizer::begin(uint32_t nowMs, float ambientC) {
+  ambientC_ = ambientC;
+  plate_ = 0;
+  step_ = 0;
+  head_ = 0;
+  filled_ = 0;
+  lastSampleMs_ = nowMs;
+  memset(heat_, 0, sizeof(heat_));
+  memset(fanSums_, 0, sizeof(fanSums_));
+  memset(couple_, 0, sizeof(couple_));
+  enter_(PH_COOLDOWN, nowMs);
+}
+
+void PlantCharacterizer::enter_(Phase p, uint32_t nowMs) {
+  phase_ = p;
+  phaseStartMs_ = nowMs;
+  duty_ = (p == PH_STEP) ? STEP_DUTIES[step_] : 0;
+  fan_  = (p == PH_COOLDOWN || p == PH_FAN || p == PH_ABORTED) ? 100 : 0;
+  if (p == PH_STEP)
+    LOGI("CHAR", "%s plate: step %u%%", PLATE_NAMES[plate_], duty_);
+  else if (plate_ < 2)
+    LOGI("CHAR", "%s plate: %s", PLATE_NAMES[plate_], phaseName(p));
+  else
+    LOGI("CHAR", "%s", phaseName(p));
+}
+
+void PlantCharacterizer::update(uint32_t nowMs, float tF, float tB) {
+  if (done()) return;
+  float hot = max(tF, tB);
+  if (isnan(tF) || isnan(tB) || hot >= ABORT_C) {
+    LOGE("CHAR", "Plates out of range (F:%.1f B:%.1f)", tF, tB);
+    enter_(PH_ABORTED, nowMs);
+    return;
+  }
+
+  if (nowMs - lastSampleMs_ >= 1000) {
+    lastSampleMs_ = nowMs;
+    sample_(nowMs, tF, tB);
+  }
+
+  float tp = plate_ ? tB : tF;
+  uint32_t secs = phaseSecs(nowMs);
+  switch (phase_) {
+    case PH_COOLDOWN:
+      if (hot < START_C)              enter_(PH_SETTLE, nowMs);
+      else if (secs >= TIMEOUT_SECS)  enter_(PH_ABORTED, nowMs);
+      break;
+    case PH_SETTLE:
+      if (secs >= SETTLE_SECS) { step_ = 0; enter_(PH_STEP, nowMs); }
+      break;
+    case PH_STEP:
+      if (tp >= TOP_C || (secs >= STEP_SECS && step_ + 1 >= STEP_COUNT)) enter_(PH_NATURAL, nowMs);
+      else if (secs >= STEP_SECS) { step_++; enter_(PH_STEP, nowMs); }
+      break;
+    case PH_NATURAL:
+      if (secs >= NATURAL_SECS) enter_(PH_FAN, nowMs);
+      break;
+    case PH_FAN:
+      if (hot < START_C) {
+        if (++plate_ >= 2) enter_(PH_DONE, nowMs);
+        else               enter_(PH_SETTLE, nowMs);
+      } else if (secs >= TIMEOUT_SECS) {
+        enter_(PH_ABORTED, nowMs);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void PlantCharacterizer::sample_(uint32_t nowMs, float tF, float tB) {
+  head_ = (head_ + 1) % HIST;
+  temp_[0][head_] = tF;
+  temp_[1][head_] = tB;
+  dutyHist_[head_] = duty_;          // duty applied over the second that ends here
+  if (filled_ < HIST) filled_++;
+  if (filled_ < 3 || plate_ > 1) return;
+
+  auto back = [this](uint8_t n) { return (uint8_t)((head_ + HIST - n) % HIST); };
+  uint8_t p = plate_, q = 1 - plate_;
+  uint8_t mid = back(1);
+  // Centred rate at the middle sample
+  float rateP = (temp_[p][head_] - temp_[p][back(2)]) / 2.0f;
+  float rateQ = (temp_[q][head_] - temp_[q][back(2)]) / 2.0f;
+  float tp = temp_[p][mid], tq = temp_[q][mid];
+
+  if (phase_ == PH_STEP || phase_ == PH_NATURAL) {
+    uint8_t band = plantBand(tp);
+    for (uint8_t d = 0; d <= MAX_DEAD_S && d < filled_; d++) {
+      float u = dutyHist_[back(d)] / 100.0f;
+      heat_[p][band][d].add(u, -(tp - ambientC_), rateP);
+      heat_[p][PLANT_ALL][d].add(u, -(tp - ambientC_), rateP);
+    }
+    couple_[q].add(-(tq - ambientC_), tp - tq, rateQ);
+  } else if (phase_ == PH_FAN && phaseSecs(nowMs) >= FAN_SPINUP_SECS) {
+    fanSums_[p].add(-(tp - ambientC_), 0.0f, rateP);
+  }
+}
+
+// ---- Results ----
+bool PlantCharacterizer::result(PlantModel& out) const {
+  memset(&out, 0, sizeof(out));
+  out.ambientC = ambientC_;
+
+  for (uint8_t p = 0; p < 2; p++) {
+    for (uint8_t b = 0; b <= PLANT_ALL; b++) {
+      FopdtFit& f = out.fit[p][b];
+      for (uint8_t d = 0; d <= MAX_DEAD_S; d++) {
+        float g, k, r2;
+        if (!heat_[p][b][d].solve(g, k, r2) || r2 <= f.r2) continue;
+        f.heatGain = g;
+        f.lossCoef = k;
+        f.deadSecs = d;
+        f.r2 = r2;
+        f.samples = heat_[p][b][d].n;
+      }
+    }
+
+    const Sums& s = fanSums_[p];
+    if (s.n >= MIN_FIT_SAMPLES && s.s11 > 0.0f)
+      out.fanLossCoef[p] = max(s.s1y / s.s11 - out.fit[p][PLANT_ALL].lossCoef, 0.0f);
+
+    float k, c, r2;
+    if (couple_[p].solve(k, c, r2)) out.couplingCoef[p] = c;
+  }
+  return usable_(out.fit[0][PLANT_ALL], PLANT_ALL) && usable_(out.fit[1][PLANT_ALL], PLANT_ALL);
+}
+
+void PlantCharacterizer::report(const PlantModel& m) {
+  LOGI("CHAR", "=== PLANT MODEL (ambient %.1f C) ===", m.ambientC);
+  LOGI("CHAR", "plate,band,gain_Cps,loss_ps,K_C,tau_s,dead_s,r2,n,used");
+  for (uint8_t p = 0; p < 2; p++) {
+    for (uint8_t b = 0; b <= PLANT_ALL; b++) {
+      const FopdtFit& f = m.fit[p][b];
+      float k = f.lossCoef > 0.0f ? f.lossCoef : NAN;
+      LOGI("CHAR", "%s,%s,%.3f,%.5f,%.0f,%.0f,%.0f,%.3f,%u,%s", PLATE_NAMES[p], BAND_NAMES[b],
+           f.heatGain, f.lossCoef, f.heatGain / k, 1.0f / k, f.deadSecs, f.r2, f.samples,
+           usable_(f, b) ? "yes" : "no");
+    }
+  }
+  for (uint8_t p = 0; p < 2; p++)
+    LOGI("CHAR", "%s: fan adds %.4f /s, coupling %.5f /s per C from the %s plate",
+         PLATE_NAMES[p], m.fanLossCoef[p], m.couplingCoef[p], PLATE_NAMES[1 - p]);
+}
+
+const char* PlantCharacterizer::phaseName(Phase p) {
+  switch (p) {
+    case PH_COOLDOWN: return "cool-down";
+    case PH_SETTLE:   return "settle";
+    case PH_STEP:     return "step";
+    case PH_NATURAL:  return "natural cooling";
+    case PH_FAN:      return "fan cooling";
+    case PH_DONE:     return "done";
+    default:          return "aborted";
+  }
+}
+
+// ---- Persistence ----
+struct __attribute__((packed)) PlantModelFile {
+  char       magic[4];     // "PLNT"
+  uint8_t    version;
+  PlantModel model;
+  uint16_t   crc;          // CRC-16 over everything above
+};
+
+static const char* PLANT_MODEL_PATH = "/plant.mdl";
+
+bool PlantCharacterizer::load(PlantModel& m) {
+  File f = LittleFS.open(PLANT_MODEL_PATH, "r");
+  if (!f) return false;
+  PlantModelFile pf;
+  bool ok = f.read((uint8_t*)&pf, sizeof(pf)) == sizeof(pf) && memcmp(pf.magic, "PLNT", 4) == 0 &&
+            pf.version == 1 && Telemetry::crc16((const uint8_t*)&pf, sizeof(pf) - 2) == pf.crc;
+  f.close();
+  if (!ok) { LOGE("CHAR", "%s is invalid, keeping the default plant", PLANT_MODEL_PATH); return false; }
+  m = pf.model;
+  LOGI("CHAR", "Plant model loaded: front %.2f C/s loss %.4f, back %.2f C/s loss %.4f",
+       m.fit[0][PLANT_ALL].heatGain, m.fit[0][PLANT_ALL].lossCoef,
+       m.fit[1][PLANT_ALL].heatGain, m.fit[1][PLANT_ALL].lossCoef);
+  return true;
+}
+
+bool PlantCharacterizer::save(const PlantModel& m) {
+  PlantModelFile pf;
+  memset(&pf, 0, sizeof(pf));     // padding inside PlantModel is covered by the CRC
+  memcpy(pf.magic, "PLNT", 4);
+  pf.version = 1;
+  memcpy(&pf.model, &m, sizeof(m));
+  pf.crc = Telemetry::crc16((const uint8_t*)&pf, sizeof(pf) - 2);
+  File f = LittleFS.open(PLANT_MODEL_PATH, "w");
+  if (!f) { LOGE("CHAR", "cannot write %s", PLANT_MODEL_PATH); return false; }
+  f.write((const uint8_t*)&pf, sizeof(pf));
+  f.close();
+  return true;
+}
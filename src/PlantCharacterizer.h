@@ -0,0 +1,108 @@
+#pragma once
+#include <Arduino.h>
+#include "PlateEstimator.h"
+
+// Plate model measured by the characterization run, stored in /plant.mdl.
+// Each plate gets a first-order-plus-dead-time fit
+//   dT/dt = heatGain * u(t - deadSecs) - lossCoef * (T - ambientC)
+// per temperature band and one over the whole range (PLANT_ALL). In FOPDT
+// terms the static gain is heatGain/lossCoef (°C rise at 100%) and the time
+// constant 1/lossCoef. The estimator takes deadSecs as its sensorTau.
+#define PLANT_BANDS 3              // up to 100, 160, 250 °C
+#define PLANT_ALL   PLANT_BANDS
+
+struct FopdtFit {
+  float    heatGain;       // °C/s at 100% duty
+  float    lossCoef;       // 1/s
+  float    deadSecs;
+  float    r2;             // of the rate regression, 0 = no fit
+  uint16_t samples;
+};
+
+struct PlantModel {
+  float    ambientC;
+  FopdtFit fit[2][PLANT_BANDS + 1];   // [front, back][band]
+  float    fanLossCoef[2];            // 1/s added by the fan at 100%
+  float    couplingCoef[2];           // 1/s per °C the other plate is hotter
+};
+
+uint8_t plantBand(float tempC);
+// Band fit if it is usable, else the whole-range fit, else `fallback`
+PlantParams plantParamsFor(const PlantModel& m, uint8_t plate, uint8_t band, const PlantParams& fallback);
+
+// Unattended characterization. Per plate: cool both plates below START_C
+// with the fan, settle with the fan off, step the plate through
+// STEP_DUTIES (STEP_SECS each, or until TOP_C), coast with everything off
+// (natural cooling), then cool with the fan at 100%.
+// Samples are taken at 1 Hz. The driven plate's heating rate is regressed
+// on its delayed duty and its rise over ambient, once per candidate dead
+// time, per band; the delay with the best R² wins. The unheated
+// plate gives the cross-coupling, the fan phase the fan's extra loss.
+class PlantCharacterizer {
+public:
+  enum Phase : uint8_t { PH_COOLDOWN, PH_SETTLE, PH_STEP, PH_NATURAL, PH_FAN, PH_DONE, PH_ABORTED };
+
+  static constexpr uint8_t  STEP_COUNT   = 3;
+  static constexpr uint16_t STEP_SECS    = 150;
+  static constexpr uint16_t SETTLE_SECS  = 30;
+  static constexpr uint16_t NATURAL_SECS = 180;
+  static constexpr uint16_t TIMEOUT_SECS = 1800;   // any cool-down
+  static constexpr float    START_C      = 50.0f;
+  static constexpr float    TOP_C        = 220.0f;
+  static constexpr float    ABORT_C      = 250.0f;
+  static constexpr uint8_t  MAX_DEAD_S   = 15;
+
+  void begin(uint32_t nowMs, float ambientC);
+  // Call every loop with the plate temps, then apply dutyFront/Back and fanPct
+  void update(uint32_t nowMs, float tF, float tB);
+
+  uint8_t dutyFront() const { return plate_ == 0 ? duty_ : 0; }
+  uint8_t dutyBack()  const { return plate_ == 1 ? duty_ : 0; }
+  uint8_t fanPct()    const { return fan_; }
+
+  Phase    phase() const { return phase_; }
+  uint8_t  plate() const { return plate_; }
+  uint32_t phaseSecs(uint32_t nowMs) const { return (nowMs - phaseStartMs_) / 1000; }
+  bool     done() const { return phase_ >= PH_DONE; }
+  static const char* phaseName(Phase p);
+
+  // Fits the collected data; false if either plate has no whole-range fit
+  bool result(PlantModel& out) const;
+  static void report(const PlantModel& m);   // summary table on the log
+
+  static bool load(PlantModel& m);
+  static bool save(const PlantModel& m);
+
+private:
+  static const uint8_t STEP_DUTIES[STEP_COUNT];
+  static constexpr uint8_t HIST = MAX_DEAD_S + 3;
+
+  // Least-squares sums for y = a*x1 + b*x2
+  struct Sums {
+    float s11, s12, s22, s1y, s2y, syy, sy;
+    uint16_t n;
+    void add(float x1, float x2, float y);
+    bool solve(float& a, float& b, float& r2) const;
+  };
+
+  void enter_(Phase p, uint32_t nowMs);
+  void sample_(uint32_t nowMs, float tF, float tB);
+
+  float    ambientC_ = 25.0f;
+  Phase    phase_ = PH_DONE;
+  uint8_t  plate_ = 0;
+  uint8_t  step_ = 0;
+  uint8_t  duty_ = 0;
+  uint8_t  fan_ = 0;
+  uint32_t phaseStartMs_ = 0;
+  uint32_t lastSampleMs_ = 0;
+
+  float    temp_[2][HIST];        // ring of 1 Hz samples
+  uint8_t  dutyHist_[HIST];       // driven plate's duty per sample
+  uint8_t  head_ = 0;
+  uint8_t  filled_ = 0;
+
+  Sums heat_[2][PLANT_BANDS + 1][MAX_DEAD_S + 1];
+  Sums fanSums_[2];               // x1 = -(T - ambient), x2 unused
+  Sums couple_[2];                // unheated plate: x1 = -(T - ambient), x2 = other - T
+};
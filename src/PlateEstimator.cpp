@@ -0,0 +1,60 @@
+// PlateEstimator.cpp
+#include "PlateEstimator.h"
+
+void PlateEstimator::begin(const PlantParams& p, float initialC){
+  p_ = p;
+  x_[0] = initialC; x_[1] = initialC; x_[2] = 0.0f;
+  memset(P_, 0, sizeof(P_));
+  P_[0][0] = 4.0f; P_[1][1] = 1.0f; P_[2][2] = 0.25f;
+  rate_ = 0.0f;
+  init_ = true;
+}
+
+void PlateEstimator::update(float measC, int dutyPct, float dtSec){
+  if (!init_) { begin(p_, measC); return; }
+  if (!isfinite(measC)) return;
+
+  // Keep the Euler step stable for the sensor lag state
+  if (dtSec <= 0.0f) dtSec = 0.001f;
+  if (dtSec > 1.0f)  dtSec = 1.0f;
+
+  const float u  = constrain(dutyPct, 0, 100) / 100.0f;
+  const float b  = p_.lossCoef;
+  const float ks = dtSec / p_.sensorTau;
+
+  // --- Predict ---
+  float Tp = x_[0], Ts = x_[1], d = x_[2];
+  x_[0] = Tp + dtSec * (p_.heatGain * u - b * (Tp - p_.ambientC) + d);
+  x_[1] = Ts + ks * (Tp - Ts);
+  // x_[2] is a random walk
+
+  const float F[3][3] = {
+    {1.0f - b * dtSec, 0.0f,      dtSec},
+    {ks,               1.0f - ks, 0.0f },
+    {0.0f,             0.0f,      1.0f }
+  };
+
+  // P = F P F' + Q
+  float FP[3][3];
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      FP[i][j] = F[i][0]*P_[0][j] + F[i][1]*P_[1][j] + F[i][2]*P_[2][j];
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      P_[i][j] = FP[i][0]*F[j][0] + FP[i][1]*F[j][1] + FP[i][2]*F[j][2];
+  P_[0][0] += qT_ * dtSec;
+  P_[2][2] += qD_ * dtSec;
+
+  // --- Correct (measurement is the sensor state only) ---
+  float S = P_[1][1] + r_;
+  float K[3] = { P_[0][1] / S, P_[1][1] / S, P_[2][1] / S };
+  float y = measC - x_[1];
+  for (int i = 0; i < 3; i++) x_[i] += K[i] * y;
+
+  float P1[3] = { P_[1][0], P_[1][1], P_[1][2] };
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      P_[i][j] -= K[i] * P1[j];
+
+  rate_ = p_.heatGain * u - b * (x_[0] - p_.ambientC) + x_[2];
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <Arduino.h>
+
+// First-order plate model used by the estimator:
+//   dTplate/dt  = heatGain*u - lossCoef*(Tplate - ambient) + d
+//   dTsensor/dt = (Tplate - Tsensor) / sensorTau
+// u is heater duty 0..1, d an unmodelled heating-rate bias.
+struct PlantParams {
+  float heatGain;   // °C/s at 100% duty (plate cold)
+  float lossCoef;   // 1/s, natural loss towards ambient
+  float sensorTau;  // s, thermistor lag behind the plate surface
+  float ambientC;   // °C
+};
+
+// Kalman observer fusing the thermistor reading with the known heater duty.
+// State: [plate surface temp, sensor temp, heating-rate bias].
+// Only the sensor temp is measured; the plate temp leads it by ~sensorTau.
+class PlateEstimator {
+public:
+  void begin(const PlantParams& p, float initialC);
+  void setParams(const PlantParams& p) { p_ = p; }
+  const PlantParams& params() const { return p_; }
+
+  // dutyPct 0..100 applied over the last dtSec, measC = latest thermistor °C
+  void update(float measC, int dutyPct, float dtSec);
+
+  float tempC()    const { return x_[0]; }  // estimated plate surface
+  float rateCps()  const { return rate_; }  // estimated heating rate, °C/s
+  float sensorC()  const { return x_[1]; }
+  bool  ready()    const { return init_; }
+
+  // Noise tuning (process: per second, measurement: °C²)
+  void setNoise(float qPlate, float qBias, float rMeas) { qT_ = qPlate; qD_ = qBias; r_ = rMeas; }
+
+private:
+  PlantParams p_ = {2.0f, 0.0017f, 4.0f, 25.0f};
+  float x_[3] = {25.0f, 25.0f, 0.0f};
+  float P_[3][3] = {};
+  float rate_ = 0.0f;
+  float qT_ = 0.05f, qD_ = 0.002f, r_ = 0.25f;
+  bool  init_ = false;
+};
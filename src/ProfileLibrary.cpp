@@ -0,0 +1,145 @@
+// ProfileLibrary.cpp
+#include "ProfileLibrary.h"
+#include "Telemetry.h"
+#include "Log.h"
+#include <LittleFS.h>
+
+ProfileLibrary profileLib;
+
+static_assert(sizeof(ProfileEntry) == 8, "ProfileEntry is stored as-is in the library file");
+
+static const char* reportName_ = "";
+
+static void report_(bool error, uint8_t slot, const char* msg) {
+  if (slot == 0xFF) {
+    if (error) LOGE("PROF", "%s: %s", reportName_, msg);
+    else       LOGW("PROF", "%s: %s", reportName_, msg);
+  } else {
+    if (error) LOGE("PROF", "%s slot %u: %s", reportName_, slot, msg);
+    else       LOGW("PROF", "%s slot %u: %s", reportName_, slot, msg);
+  }
+}
+
+static constexpr size_t RECORD_MAX = sizeof(LibRecord) + MAXPRSLOTS * sizeof(ProfileEntry) + 2;
+
+bool ProfileLibrary::begin(const char* path) {
+  fromFile_ = false;
+  count_ = 0;
+  loaded_ = -1;
+  snprintf(path_, sizeof(path_), "%s", path);
+
+  File f = LittleFS.open(path_, "r");
+  if (!f) { LOGI("PROF", "No %s, using %u built-in profiles", path_, PROFILE_COUNT); return false; }
+
+  LibHeader h;
+  if (f.read((uint8_t*)&h, sizeof(h)) != sizeof(h) || memcmp(h.magic, "RPLB", 4) != 0 ||
+      h.version != VERSION || h.count == 0) {
+    LOGE("PROF", "%s: bad header, using built-ins", path_);
+    return false;
+  }
+
+  // profile_pack.py never writes more than MAX_PROFILES, and the CRC
+  // covers the whole index: a larger count cannot be verified
+  if (h.count > MAX_PROFILES) {
+    LOGE("PROF", "%s: %u profiles, %u max - corrupt, using built-ins", path_, h.count, MAX_PROFILES);
+    return false;
+  }
+  LibIndexEntry idx[MAX_PROFILES];
+  uint8_t n = h.count;
+  if (f.read((uint8_t*)idx, n * sizeof(LibIndexEntry)) != n * sizeof(LibIndexEntry) ||
+      Telemetry::crc16((const uint8_t*)idx, n * sizeof(LibIndexEntry)) != h.indexCrc) {
+    LOGE("PROF", "%s: index CRC mismatch, using built-ins", path_);
+    return false;
+  }
+  f.close();
+
+  // Keep only records that verify now, so get() rarely has to fall back
+  LibRecord rec;
+  for (uint8_t i = 0; i < n; i++) {
+    Slot& s = index_[count_];
+    memcpy(s.name, idx[i].name, 16);
+    s.name[16] = 0;
+    s.offset = idx[i].offset;
+    s.length = idx[i].length;
+    if (!readRecord_(count_, rec, slots_)) {
+      LOGE("PROF", "Profile '%s' is corrupt, skipped", s.name);
+      continue;
+    }
+    Profile p = {s.name, rec.pidProfile, rec.slotCount, rec.coolingSlot,
+                 rec.profMinTemp, rec.profMaxTemp, rec.doneTemp, slots_, rec.flags};
+    reportName_ = s.name;
+    if (ProfileValidator::check(p, limits_, nullptr, nullptr).errors) {
+      ProfileValidator::check(p, limits_, nullptr, report_);   // log why
+      LOGE("PROF", "Profile '%s' cannot run, skipped", s.name);
+      continue;
+    }
+    count_++;
+  }
+  if (!count_) { LOGE("PROF", "%s: no usable profiles, using built-ins", path_); return false; }
+
+  fromFile_ = true;
+  LOGI("PROF", "Loaded index of %u profiles from %s", count_, path_);
+  return true;
+}
+
+const char* ProfileLibrary::name(uint8_t i) const {
+  if (!fromFile_) return i < PROFILE_COUNT ? PROFILES[i].name : "?";
+  return i < count_ ? index_[i].name : "?";
+}
+
+const Profile& ProfileLibrary::get(uint8_t i) {
+  if (i >= count()) i = 0;
+  if (loaded_ == i) return prof_;
+
+  if (fromFile_) {
+    LibRecord rec;
+    if (!readRecord_(i, rec, slots_)) {
+      LOGE("PROF", "Reading '%s' failed", index_[i].name);
+      // One inert slot, so screens that index slots[0] stay in bounds
+      static const ProfileEntry NO_SLOT = {1, 0, PHASE_PREHEAT, 0, 0};
+      unreadable_ = {index_[i].name, 0, 1, 1, 0, 1, 0, &NO_SLOT, 0};
+      check_ = {1, 0, 0, 0};
+      loaded_ = -1;                          // try the file again next time
+      return unreadable_;
+    }
+    prof_.name        = index_[i].name;
+    prof_.pidProfile  = rec.pidProfile;
+    prof_.slotCount   = rec.slotCount;
+    prof_.coolingSlot = rec.coolingSlot;
+    prof_.profMinTemp = rec.profMinTemp;
+    prof_.profMaxTemp = rec.profMaxTemp;
+    prof_.doneTemp    = rec.doneTemp;
+    prof_.flags       = rec.flags;
+  } else {
+    prof_ = PROFILES[i];
+    memcpy(slots_, PROFILES[i].slots, prof_.slotCount * sizeof(ProfileEntry));
+  }
+  prof_.slots = slots_;
+
+  reportName_ = prof_.name;
+  check_ = ProfileValidator::check(prof_, limits_, slots_, report_);
+  if (check_.stretched)
+    LOGI("PROF", "%s: %u ramps stretched, +%us", prof_.name, check_.stretched, check_.addedSecs);
+  loaded_ = i;
+  return prof_;
+}
+
+bool ProfileLibrary::readRecord_(uint8_t i, LibRecord& rec, ProfileEntry* slots) {
+  const Slot& s = index_[i];
+  if (s.length < sizeof(LibRecord) + sizeof(ProfileEntry) + 2 || s.length > RECORD_MAX) return false;
+
+  uint8_t buf[RECORD_MAX];
+  File f = LittleFS.open(path_, "r");
+  if (!f || !f.seek(s.offset) || f.read(buf, s.length) != s.length) return false;
+  f.close();
+
+  uint16_t crc;
+  memcpy(&crc, buf + s.length - 2, 2);
+  if (Telemetry::crc16(buf, s.length - 2) != crc) return false;
+
+  memcpy(&rec, buf, sizeof(rec));
+  if (rec.slotCount == 0 || rec.slotCount > MAXPRSLOTS ||
+      s.length != sizeof(LibRecord) + rec.slotCount * sizeof(ProfileEntry) + 2) return false;
+  memcpy(slots, buf + sizeof(LibRecord), rec.slotCount * sizeof(ProfileEntry));
+  return true;
+}
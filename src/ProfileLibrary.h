@@ -0,0 +1,84 @@
+#pragma once
+#include <Arduino.h>
+#include "Profiles.h"
+#include "ProfileValidator.h"
+
+// Reflow profiles stored in LittleFS (/profiles.bin), so new pastes need no
+// reflash. tools/profile_pack.py builds the file from JSON; upload it with
+// the rest of data/ (`pio run -t uploadfs`).
+//
+// File = LibHeader, LibIndexEntry[count], then one record per profile:
+//   LibRecord, ProfileEntry[slotCount], uint16 CRC-16/CCITT-FALSE over both.
+// The index holds names and offsets only. begin() checks it and every
+// record's CRC once and keeps just the index in RAM; get() reads one record
+// into a single buffer when the menu or a run needs that profile.
+// Without a valid file the built-in PROFILES are used.
+// Every profile is checked against the plate limits when it is loaded
+// (ProfileValidator); short heating ramps are stretched in the RAM copy.
+// File profiles with errors are dropped at begin(); get() checks again
+// against the current limits, and the station refuses to start a profile
+// whose lastCheck() has errors.
+struct __attribute__((packed)) LibHeader {
+  char     magic[4];       // "RPLB"
+  uint8_t  version;
+  uint8_t  count;
+  uint16_t indexCrc;       // CRC-16 over the index entries
+};
+
+struct __attribute__((packed)) LibIndexEntry {
+  char     name[16];       // NUL padded
+  uint32_t offset;         // record start in the file
+  uint16_t length;         // record bytes, CRC included
+};
+
+struct __attribute__((packed)) LibRecord {
+  uint8_t  pidProfile;
+  uint8_t  slotCount;
+  uint8_t  coolingSlot;
+  uint8_t  flags;          // PROF_* bits
+  int16_t  profMinTemp;
+  int16_t  profMaxTemp;
+  int16_t  doneTemp;
+};
+
+class ProfileLibrary {
+public:
+  static constexpr uint8_t VERSION      = 1;
+  static constexpr uint8_t MAX_PROFILES = 32;
+
+  bool begin(const char* path = "/profiles.bin");  // LittleFS already mounted
+  void setLimits(const PlateLimits& lim) { limits_ = lim; loaded_ = -1; }
+
+  uint8_t     count() const { return fromFile_ ? count_ : PROFILE_COUNT; }
+  const char* name(uint8_t i) const;
+  // Loads profile i (cached until another index or new limits). A record
+  // that fails to read comes back with its name and one inert slot, and
+  // lastCheck() counts it as an error.
+  const Profile& get(uint8_t i);
+  bool        fromFile() const { return fromFile_; }
+  // Validation of the profile get() returned last; errors != 0: do not run it
+  const ValidationResult& lastCheck() const { return check_; }
+
+private:
+  struct Slot {
+    char     name[17];
+    uint32_t offset;
+    uint16_t length;
+  };
+
+  char    path_[24];
+  bool    fromFile_ = false;
+  uint8_t count_ = 0;
+  Slot    index_[MAX_PROFILES];
+
+  PlateLimits      limits_ = DEFAULT_PLATE_LIMITS;
+  int16_t          loaded_ = -1;
+  Profile          prof_;
+  Profile          unreadable_;
+  ProfileEntry     slots_[MAXPRSLOTS];
+  ValidationResult check_ = {0, 0, 0, 0};
+
+  bool readRecord_(uint8_t i, LibRecord& rec, ProfileEntry* slots);
+};
+
+extern ProfileLibrary profileLib;
@@ -1,42 +1,181 @@
 // ProfileRunner.cpp
 #include "ProfileRunner.h"
+#include "Clock.h"
 
 void ProfileRunner::begin(const Profile& p){
   prof_ = &p;
-  startMs_ = millis();
+  startMs_ = clockMs();
   durnSec_ = p.slots[p.slotCount-1].slotSecs;
   coolingStartSec_ = (p.coolingSlot < p.slotCount) ? p.slots[p.coolingSlot].slotSecs : durnSec_;
+  holding_ = false;
+  holdTimeouts_ = 0;
+  holdsDone_ = 0;
+  heldMs_ = 0;
+  seg_ = 0;
+  sec_ = 0;
+  smooth_ = interp_ == INTERP_MONOTONE || (interp_ == INTERP_PROFILE && (p.flags & PROF_SMOOTH));
+  if (smooth_) buildCubic_();
+}
+
+// Fritsch-Carlson: start from averaged secants, zero the tangent at every
+// local extreme and flat run, then scale pairs with alpha^2 + beta^2 > 9 so
+// each ramp stays monotone. Knots are (0, profMinTemp) and the slot ends.
+void ProfileRunner::buildCubic_() {
+  const Profile& P = *prof_;
+  const uint8_t n = P.slotCount;               // ramps
+  float d[MAXPRSLOTS], m[MAXPRSLOTS + 1];
+
+  float y0 = P.profMinTemp;
+  uint16_t t0 = 0;
+  for (uint8_t k = 0; k < n; ++k) {
+    int h = (int)P.slots[k].slotSecs - t0;
+    d[k] = (h > 0) ? (P.slots[k].targetTempC - y0) / h : 0.0f;
+    y0 = P.slots[k].targetTempC; t0 = P.slots[k].slotSecs;
+  }
+  m[0] = d[0];
+  m[n] = d[n-1];
+  for (uint8_t k = 1; k < n; ++k)
+    m[k] = (d[k-1] * d[k] <= 0.0f) ? 0.0f : 0.5f * (d[k-1] + d[k]);
+  for (uint8_t k = 0; k < n; ++k) {
+    if (d[k] == 0.0f) { m[k] = m[k+1] = 0.0f; continue; }
+    float a = m[k] / d[k], b = m[k+1] / d[k];
+    float r = a*a + b*b;
+    if (r > 9.0f) {
+      float tau = 3.0f / sqrtf(r);
+      m[k] = tau * a * d[k];
+      m[k+1] = tau * b * d[k];
+    }
+  }
+
+  t0 = 0;
+  for (uint8_t k = 0; k < n; ++k) {
+    float h = P.slots[k].slotSecs - t0;
+    t0 = P.slots[k].slotSecs;
+    if (h <= 0.0f) { coef_[k][0] = coef_[k][1] = coef_[k][2] = 0.0f; continue; }
+    coef_[k][0] = m[k];
+    coef_[k][1] = (3.0f*d[k] - 2.0f*m[k] - m[k+1]) / h;
+    coef_[k][2] = (m[k] + m[k+1] - 2.0f*d[k]) / (h*h);
+  }
+}
+
+bool ProfileRunner::falling() const {
+  if (!prof_ || holding_) return false;
+  float from = seg_ ? prof_->slots[seg_-1].targetTempC : prof_->profMinTemp;
+  return prof_->slots[seg_].targetTempC < from;
+}
+
+float ProfileRunner::slopeCps() const {
+  if (!prof_ || holding_) return 0.0f;
+  uint16_t prevTime = seg_ ? prof_->slots[seg_-1].slotSecs : 0;
+  float    curT = seg_ ? prof_->slots[seg_-1].targetTempC : prof_->profMinTemp;
+  uint16_t dt = prof_->slots[seg_].slotSecs - prevTime;
+  if (dt == 0) return 0.0f;
+  if (smooth_) {
+    const float* c = coef_[seg_];
+    float s = float(sec_ - prevTime);
+    return c[0] + s * (2.0f * c[1] + 3.0f * s * c[2]);
+  }
+  return (prof_->slots[seg_].targetTempC - curT) / dt;
+}
+
+// The timeline only moves forward (holds pause it), so the ramp index is a cursor
+float ProfileRunner::setpointAt_(uint16_t sec) {
+  const Profile& P = *prof_;
+  // Time only moves forward in a run; callers that jump back get a rewind
+  while (seg_ && sec <= P.slots[seg_-1].slotSecs) --seg_;
+  while (seg_ + 1 < P.slotCount && sec > P.slots[seg_].slotSecs) ++seg_;
+  sec_ = sec;
+
+  uint16_t prevTime = seg_ ? P.slots[seg_-1].slotSecs : 0;
+  float    curT = seg_ ? P.slots[seg_-1].targetTempC : P.profMinTemp;
+  uint16_t t = P.slots[seg_].slotSecs;
+  float    y = P.slots[seg_].targetTempC;
+  uint16_t dt = (t - prevTime);
+  if (dt == 0) return y;
+
+  if (smooth_) {
+    const float* c = coef_[seg_];
+    float s = float(sec - prevTime);
+    return curT + s * (c[0] + s * (c[1] + s * c[2]));
+  }
+  float dy = (y - curT);
+  float frac = float(sec - prevTime) / float(dt);
+  return curT + frac * dy;
+}
+
+uint32_t ProfileRunner::profileMs_(uint32_t nowMs) const {
+  // While holding, the timeline stays at the slot end
+  return (holding_ ? holdStartMs_ : nowMs) - startMs_ - heldMs_;
 }
 
 uint16_t ProfileRunner::elapsedSec(uint32_t nowMs) const {
   if(!startMs_) return 0;
-  uint32_t s = (nowMs - startMs_)/1000U;
+  uint32_t s = profileMs_(nowMs)/1000U;
   return (s > durnSec_) ? durnSec_ : (uint16_t)s;
 }
 
-float ProfileRunner::update(uint32_t nowMs, bool& finished){
+uint16_t ProfileRunner::expectedFinishSec(uint32_t nowMs) const {
+  if(!startMs_) return durnSec_;
+  return (nowMs - startMs_)/1000U + (durnSec_ - elapsedSec(nowMs));
+}
+
+ProfilePhase ProfileRunner::phaseAt(uint16_t sec) const {
+  if(!prof_) return PHASE_PREHEAT;
+  uint8_t s = 0;
+  while (s + 1 < prof_->slotCount && sec > prof_->slots[s].slotSecs) ++s;
+  return (ProfilePhase)prof_->slots[s].phase;
+}
+
+ProfilePhase ProfileRunner::phase(uint32_t nowMs) const {
+  if (holding_) return (ProfilePhase)prof_->slots[holdSlot_].phase;
+  return phaseAt(elapsedSec(nowMs));
+}
+
+// Rising slot: the coolest plate must be up to target - tol.
+// Falling slot: the hottest plate must be down to target + tol.
+bool ProfileRunner::reached_(uint8_t slot, float loC, float hiC) const {
+  const ProfileEntry& e = prof_->slots[slot];
+  float prev = slot ? prof_->slots[slot-1].targetTempC : prof_->profMinTemp;
+  if (e.targetTempC >= prev) return loC >= e.targetTempC - e.holdTolC;
+  return hiC <= e.targetTempC + e.holdTolC;
+}
+
+float ProfileRunner::update(uint32_t nowMs, bool& finished, float loC, float hiC){
   finished = false;
   if(!prof_) return 25.0f;
-  uint16_t sec = elapsedSec(nowMs);
-  if (sec >= durnSec_) { finished = true; sec = durnSec_ - 1; }
-
-  // piecewise linear interpolation between slots
   const Profile& P = *prof_;
-  float curT = P.profMinTemp;
-  uint16_t prevTime = 0;
-
-  for (uint8_t s = 0; s < P.slotCount; ++s) {
-    uint16_t t = P.slots[s].slotSecs;
-    float    y = P.slots[s].targetTempC;
-    if (sec <= t) {
-      uint16_t dt = (t - prevTime);
-      if (dt == 0) return y;
-      float dy = (y - curT);
-      float frac = float(sec - prevTime) / float(dt);
-      return curT + frac * dy;
+
+  if (holding_) {
+    const ProfileEntry& e = P.slots[holdSlot_];
+    uint32_t held = nowMs - holdStartMs_;
+    bool timedOut = held >= e.holdMaxSecs * 1000UL;
+    if (!reached_(holdSlot_, loC, hiC) && !timedOut) return e.targetTempC;
+    if (timedOut) holdTimeouts_++;
+    heldMs_ += held;
+    holdsDone_ |= 1U << holdSlot_;
+    holding_ = false;
+  }
+
+  // Pause at the first slot end passed with a pending hold
+  if (!isnan(loC) && !isnan(hiC)) {
+    uint32_t pms = profileMs_(nowMs);
+    for (uint8_t s = 0; s < P.slotCount; ++s) {
+      uint32_t endMs = P.slots[s].slotSecs * 1000UL;
+      if (pms < endMs) break;
+      if (!P.slots[s].holdTolC || (holdsDone_ & (1U << s))) continue;
+      if (reached_(s, loC, hiC)) {                // plates already there
+        holdsDone_ |= 1U << s;
+        continue;
+      }
+      holding_ = true;
+      holdSlot_ = s;
+      holdStartMs_ = nowMs - (pms - endMs);       // resume exactly at the slot end
+      return P.slots[s].targetTempC;
     }
-    // advance segment
-    curT = y; prevTime = t;
   }
-  return curT; // last point
+
+  uint16_t sec = elapsedSec(nowMs);
+  if (sec >= durnSec_) { finished = true; sec = durnSec_ - 1; }
+
+  return setpointAt_(sec);
 }
@@ -3,17 +3,62 @@
 
 class ProfileRunner {
 public:
+  // Setpoint shape between slots. INTERP_PROFILE follows the PROF_SMOOTH
+  // flag; the others override it (A/B runs in the simulator).
+  // MONOTONE is a Fritsch-Carlson cubic through the slot targets: no
+  // corners and no overshoot between knots, so the peak is approached with
+  // the slope easing to zero instead of a kink the PID overshoots.
+  enum Interp : uint8_t { INTERP_PROFILE, INTERP_LINEAR, INTERP_MONOTONE };
+  void setInterp(Interp i) { interp_ = i; }
+  bool smooth() const { return smooth_; }
+  // The ramp being followed heads down (a cubic starts falling with zero slope)
+  bool falling() const;
+  // Setpoint slope at the last update(), °C/s (0 while holding)
+  float slopeCps() const;
+
   void begin(const Profile& p);
-  // returns current setpoint (°C) and whether finished
-  float update(uint32_t nowMs, bool& finished);
+  // returns current setpoint (°C) and whether finished.
+  // loC/hiC: lowest and highest active plate temps. Slots with a hold only
+  // pause the timeline when these are given (NAN = pure time base).
+  float update(uint32_t nowMs, bool& finished, float loC = NAN, float hiC = NAN);
+  // Profile time, i.e. wall time minus time spent holding
   uint16_t elapsedSec(uint32_t nowMs) const;
   uint16_t durationSec() const { return durnSec_; }
   uint16_t coolingStartSec() const { return coolingStartSec_; }
 
+  // Phase tag of the slot containing sec / of the current slot or hold
+  ProfilePhase phaseAt(uint16_t sec) const;
+  ProfilePhase phase(uint32_t nowMs) const;
+
+  bool     holding() const { return holding_; }
+  uint16_t holdSec(uint32_t nowMs) const { return holding_ ? (nowMs - holdStartMs_) / 1000U : 0; }
+  uint16_t heldSec() const { return heldMs_ / 1000U; }         // finished holds
+  uint8_t  holdTimeouts() const { return holdTimeouts_; }      // holds that hit holdMaxSecs
+  // Wall-clock seconds from start to the expected finish (future holds not included)
+  uint16_t expectedFinishSec(uint32_t nowMs) const;
+
 private:
   const Profile* prof_ = nullptr;
   uint32_t startMs_ = 0;
   uint16_t durnSec_ = 0;
   uint16_t coolingStartSec_ = 0;
-  // optional: cache ‘outline’ for display if you like later
+
+  bool     holding_ = false;
+  uint8_t  holdSlot_ = 0;
+  uint8_t  holdTimeouts_ = 0;
+  uint32_t holdsDone_ = 0;        // bit per slot (MAXPRSLOTS)
+  uint32_t holdStartMs_ = 0;
+  uint32_t heldMs_ = 0;
+
+  Interp   interp_ = INTERP_PROFILE;
+  bool     smooth_ = false;
+  uint8_t  seg_ = 0;              // slot whose ramp the timeline is in (moves both ways)
+  uint16_t sec_ = 0;              // timeline second of the last update()
+  // Cubic per slot ramp: y = y0 + s*(c[0] + s*(c[1] + s*c[2])), s = secs into the ramp
+  float    coef_[MAXPRSLOTS][3];
+
+  uint32_t profileMs_(uint32_t nowMs) const;
+  bool reached_(uint8_t slot, float loC, float hiC) const;
+  void buildCubic_();
+  float setpointAt_(uint16_t sec);
 };
@@ -0,0 +1,124 @@
+// ProfileValidator.cpp
+#include "ProfileValidator.h"
+#include <math.h>
+#include <stdio.h>
+
+const PlateLimits DEFAULT_PLATE_LIMITS = {
+  {2.0f, 0.0017f, 4.0f, 25.0f},   // front: same model as the estimator
+  {2.0f, 0.0017f, 4.0f, 25.0f},   // back
+  0.0055f,                        // fan: 200->120 C in ~2 min
+  90                              // runs cap the heaters at 90%
+};
+
+static float plateHeatSecs_(const PlantParams& p, uint8_t maxPct, float fromC, float toC) {
+  float g = p.heatGain * maxPct / 100.0f;
+  float k = p.lossCoef;
+  float rateAtTo = g - k * (toC - p.ambientC);
+  if (rateAtTo <= 0.0f) return NAN;               // steady state below target
+  if (k <= 0.0f) return (toC - fromC) / g;
+  return logf((g - k * (fromC - p.ambientC)) / rateAtTo) / k;
+}
+
+static float plateCoolSecs_(const PlantParams& p, float fanK, float fromC, float toC) {
+  float k = p.lossCoef + fanK;
+  if (toC <= p.ambientC || k <= 0.0f) return NAN;
+  return logf((fromC - p.ambientC) / (toC - p.ambientC)) / k;
+}
+
+// Slower of the two plates; fmaxf would drop a NAN, so check it first
+static float slower_(float a, float b) {
+  return (isnan(a) || isnan(b)) ? NAN : fmaxf(a, b);
+}
+
+float ProfileValidator::heatSecs(const PlateLimits& lim, float fromC, float toC) {
+  if (toC <= fromC) return 0.0f;
+  return slower_(plateHeatSecs_(lim.front, lim.maxOutputPct, fromC, toC),
+                 plateHeatSecs_(lim.back,  lim.maxOutputPct, fromC, toC));
+}
+
+float ProfileValidator::coolSecs(const PlateLimits& lim, float fromC, float toC) {
+  if (toC >= fromC) return 0.0f;
+  return slower_(plateCoolSecs_(lim.front, lim.fanLossCoef, fromC, toC),
+                 plateCoolSecs_(lim.back,  lim.fanLossCoef, fromC, toC));
+}
+
+ValidationResult ProfileValidator::check(const Profile& p, const PlateLimits& lim,
+                                         ProfileEntry* out, ReportFn report) {
+  ValidationResult r = {0, 0, 0, 0};
+  char msg[64];
+#define REPORT(err, slot, ...) do { \
+    if (err) r.errors++; else r.warnings++; \
+    if (report) { snprintf(msg, sizeof(msg), __VA_ARGS__); report(err, slot, msg); } \
+  } while (0)
+
+  if (p.slotCount == 0 || p.slotCount > MAXPRSLOTS) {
+    REPORT(true, 0xFF, "%u slots, expected 1..%u", p.slotCount, MAXPRSLOTS);
+    return r;
+  }
+  if (p.profMinTemp >= p.profMaxTemp || p.profMaxTemp > PLATE_MAX_C)
+    REPORT(true, 0xFF, "temp range %d..%d C invalid (plate max %d)", p.profMinTemp, p.profMaxTemp, PLATE_MAX_C);
+  if (p.coolingSlot > p.slotCount)
+    REPORT(false, 0xFF, "coolingSlot %u past the last slot", p.coolingSlot);
+  if (p.doneTemp < p.profMinTemp || p.doneTemp > p.profMaxTemp)
+    REPORT(false, 0xFF, "doneTemp %d C outside %d..%d", p.doneTemp, p.profMinTemp, p.profMaxTemp);
+
+  float ambient = fmaxf(lim.front.ambientC, lim.back.ambientC);
+  float prevC = fmaxf((float)p.profMinTemp, ambient);   // plates start at room temp
+  uint16_t prevT = 0;
+  uint32_t shift = 0;
+
+  for (uint8_t s = 0; s < p.slotCount; s++) {
+    ProfileEntry e = p.slots[s];                         // copy: out may alias
+    float y = e.targetTempC;
+
+    if (e.slotSecs <= prevT && (s || !e.slotSecs))
+      REPORT(true, s, "slot time %us not after %us", e.slotSecs, prevT);
+    if (y < p.profMinTemp || y > p.profMaxTemp)
+      REPORT(true, s, "target %.0f C outside %d..%d", y, p.profMinTemp, p.profMaxTemp);
+    if (e.phase >= PHASE_COUNT)
+      REPORT(true, s, "phase %u, expected 0..%u", e.phase, PHASE_COUNT - 1);
+    if (e.holdTolC > HOLD_TOL_MAX_C)
+      REPORT(true, s, "hold tolerance %u C above %u", e.holdTolC, HOLD_TOL_MAX_C);
+    if (e.holdTolC && (!e.holdMaxSecs || e.holdMaxSecs > HOLD_MAX_SECS))
+      REPORT(true, s, "hold limit %us, expected 1..%u", e.holdMaxSecs, HOLD_MAX_SECS);
+    if (s == p.coolingSlot && y >= prevC)
+      REPORT(false, s, "coolingSlot does not fall (%.0f -> %.0f C)", prevC, y);
+
+    float dt = (e.slotSecs > prevT) ? (float)(e.slotSecs - prevT) : 0.0f;
+    if (y > prevC) {
+      float need = heatSecs(lim, prevC, y);
+      if (isnan(need)) {
+        REPORT(true, s, "%.0f C is beyond what the plates reach", y);
+      } else if ((need *= HEAT_HEADROOM) > dt) {
+        uint16_t add = (uint16_t)ceilf(need - dt);
+        if (out) {
+          shift += add;
+          r.stretched++;
+          REPORT(false, s, "ramp to %.0f C stretched %us -> %us", y, (unsigned)dt, (unsigned)(dt + add));
+        } else {
+          REPORT(false, s, "ramp to %.0f C needs %us, has %us", y, (unsigned)ceilf(need), (unsigned)dt);
+        }
+      }
+    } else if (y < prevC) {
+      float need = coolSecs(lim, prevC, y);
+      if (isnan(need))
+        REPORT(false, s, "%.0f C is at or below ambient", y);
+      else if (need > dt)
+        REPORT(false, s, "cooling to %.0f C takes ~%us, has %us", y, (unsigned)ceilf(need), (unsigned)dt);
+    }
+
+    if (out) {
+      if (e.slotSecs + shift > 0xFFFF) {
+        REPORT(true, s, "stretched timeline exceeds 65535 s");
+        shift = 0;
+      }
+      out[s] = e;
+      out[s].slotSecs = e.slotSecs + shift;
+    }
+    prevT = e.slotSecs;
+    prevC = y;
+  }
+#undef REPORT
+  r.addedSecs = shift;
+  return r;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "Profiles.h"
+#include "PlateEstimator.h"
+
+// Checks that a profile is physically achievable before it runs.
+// Structure: slot count, strictly increasing slot times, coolingSlot in
+// range, targets inside profMinTemp..profMaxTemp and PLATE_MAX_C, phases
+// below PHASE_COUNT (the station posts EV_PHASE_PREHEAT + phase), and
+// holds of at most HOLD_TOL_MAX_C with a limit of 1..HOLD_MAX_SECS.
+// Rates: a rising slot needs at least the time the slower plate takes at
+// full output (heatGain * maxOutputPct minus loss towards ambient, plus
+// HEAT_HEADROOM for the PID), a falling slot the time to cool with the fan
+// (lossCoef + fanLossCoef, Newton cooling). Short heating slots can be
+// stretched, which delays every later slot; cooling only lags, so it warns.
+// tools/profile_pack.py runs the same checks on the host.
+#define PLATE_MAX_C   250
+#define HEAT_HEADROOM 1.10f
+#define HOLD_TOL_MAX_C 20
+#define HOLD_MAX_SECS  600
+
+struct PlateLimits {
+  PlantParams front, back;
+  float   fanLossCoef;     // 1/s added to lossCoef with the fan on
+  uint8_t maxOutputPct;    // heater cap during profile runs
+};
+
+// Defaults match the estimator model and the cooling times noted in Profiles.cpp
+extern const PlateLimits DEFAULT_PLATE_LIMITS;
+
+struct ValidationResult {
+  uint8_t  errors;         // profile must not run
+  uint8_t  warnings;
+  uint8_t  stretched;      // slots lengthened
+  uint16_t addedSecs;      // total timeline growth
+};
+
+class ProfileValidator {
+public:
+  // slot = offending slot or 0xFF for the whole profile
+  typedef void (*ReportFn)(bool error, uint8_t slot, const char* msg);
+
+  // Minimum seconds to ramp between two temps, NAN if out of reach
+  static float heatSecs(const PlateLimits& lim, float fromC, float toC);
+  static float coolSecs(const PlateLimits& lim, float fromC, float toC);
+
+  // With `out` (slotCount entries, may alias p.slots) short heating slots
+  // are stretched into it; without, they are reported as warnings.
+  static ValidationResult check(const Profile& p, const PlateLimits& lim,
+                                ProfileEntry* out = nullptr, ReportFn report = nullptr);
+};
@@ -1,8 +1,23 @@
 #pragma once
 #include <Arduino.h>
 
-struct ProfileEntry { uint16_t slotSecs; uint16_t targetTempC; };
-#define MAXPRSLOTS 10
+enum ProfilePhase : uint8_t { PHASE_PREHEAT, PHASE_SOAK, PHASE_REFLOW, PHASE_COOL, PHASE_COUNT };
+
+// One segment of a profile: ramp linearly to targetTempC by slotSecs.
+// holdTolC > 0 makes the timeline wait at the end of the slot until the
+// plates are within holdTolC of the target (or holdMaxSecs pass), so a
+// lagging plate still gets its full soak / peak.
+struct ProfileEntry {
+  uint16_t slotSecs;
+  uint16_t targetTempC;
+  uint8_t  phase;        // ProfilePhase
+  uint8_t  holdTolC;     // 0 = no hold
+  uint16_t holdMaxSecs;
+};
+#define MAXPRSLOTS 32   // ProfileRunner keeps one hold bit per slot
+
+// Profile.flags
+#define PROF_SMOOTH 0x01   // monotone cubic setpoint instead of straight ramps
 
 struct Profile {
   const char *name;
@@ -12,8 +27,10 @@ struct Profile {
   int         profMinTemp;
   int         profMaxTemp;
   int         doneTemp;
-  ProfileEntry slots[MAXPRSLOTS];
+  const ProfileEntry *slots;  // slotCount entries
+  uint8_t     flags;        // PROF_* bits
 };
 
+// Built-in profiles, used when no library is stored (see ProfileLibrary.h)
 extern const Profile PROFILES[];
 extern const uint8_t PROFILE_COUNT;
@@ -1,37 +1,84 @@
 // ReflowStation.cpp - PlatformIO Version with Integrated Profile Display
 #include <Arduino.h>
 #include "Types.h"
+#include "Boards.h"
+#include "Clock.h"
 #include "Profiles.h"
+#include "ProfileLibrary.h"
 #include "ProfileRunner.h"
+#include "ConstantRunner.h"
 #include "SensorManager.h"
+#include "ThermocoupleSensor.h"
+#include "ReplaySensor.h"
+#include "SimulatedSensor.h"
 #include "HeaterController.h"
 #include "FanController.h"
+#include "CoolingController.h"
+#include "FanTach.h"
+#include "PlantCharacterizer.h"
 #include "InputEncoder.h"
 #include "DisplayUI.h"
+#include "Log.h"
+#include "Telemetry.h"
+#include "RunRecorder.h"
+#include "LoopProfiler.h"
+#include "Station.h"
+#include "CommandParser.h"
+#include "SettingsStore.h"
+#ifdef REFLOW_BENCH
+#include "Bench.h"
+#endif
+#ifdef UI_CAPTURE
+#include "UiScenes.h"
+#endif
+#ifdef REFLOW_WIFI
+#include "WebDashboard.h"
+#endif
+#ifdef PLANT_SYSID
+#include "SysidPlant.h"          // tools/sysid.py --header src/SysidPlant.h
+#endif
 
-// ---- Hardware Pins ----
-#define THERM_FRONT 32
-#define THERM_BACK  33
-#define SSR_FRONT   18
-#define SSR_BACK    5
-#define FAN_PIN     19
-#define BUZZER_PIN  23
-#define ENC_A       34
-#define ENC_B       35
-#define ENC_BTN     25
-#define I2C_SDA     21
-#define I2C_SCL     22
+// ---- Hardware Pins (board descriptor, Boards.h) ----
+constexpr uint8_t THERM_FRONT = board.thermFront;
+constexpr uint8_t THERM_BACK  = board.thermBack;
+constexpr uint8_t SSR_FRONT   = board.ssrFront;
+constexpr uint8_t SSR_BACK    = board.ssrBack;
+constexpr uint8_t FAN_PIN     = board.fan;
+constexpr uint8_t TACH_PIN    = board.tach;    // 6N137 output, falling edges
+constexpr uint8_t BUZZER_PIN  = board.buzzer;
+constexpr uint8_t ENC_A       = board.encA;
+constexpr uint8_t ENC_B       = board.encB;
+constexpr uint8_t ENC_BTN     = board.encBtn;
+constexpr uint8_t I2C_SDA     = board.i2cSda;
+constexpr uint8_t I2C_SCL     = board.i2cScl;
+
+// Thermocouple amplifiers (build with -DSENSOR_MAX31855 or -DSENSOR_MAX6675)
+constexpr uint8_t TC_SCK      = board.tcSck;
+constexpr uint8_t TC_MISO     = board.tcMiso;
+constexpr uint8_t TC_CS_FRONT = board.tcCsFront;
+constexpr uint8_t TC_CS_BACK  = board.tcCsBack;
 
 // ---- Global Objects ----
 SensorManager sensors;
 HeaterController heater;
 FanController fan;
+CoolingController coolCtl;
+FanTach tach;
 ProfileRunner profRunner;
+ConstantRunner constRunner;
 InputEncoder encoder;
 DisplayUI ui;
 
+#if defined(SENSOR_MAX31855)
+ArduinoSpiBus tcBus(TC_SCK, TC_MISO);
+Max31855Sensor tcFront(tcBus, TC_CS_FRONT), tcBack(tcBus, TC_CS_BACK);
+#elif defined(SENSOR_MAX6675)
+ArduinoSpiBus tcBus(TC_SCK, TC_MISO);
+Max6675Sensor tcFront(tcBus, TC_CS_FRONT), tcBack(tcBus, TC_CS_BACK);
+#endif
+
 // ---- State Variables ----
-Mode currentMode = MENU;
+Mode currentMode = MENU;     // screen/telemetry view of the station state
 int menuIndex = 0;
 bool manualFanMode = false;
 bool manualFanState = false;
@@ -39,24 +86,88 @@ HeatState heatSelection = HEAT_BOTH;
 HeatState heatActive = HEAT_OFF;
 uint8_t selectedProfile = 0;
 int constTemp = 150;
-int constDuration = 300;
+int constDuration = 300;          // hold, counted from reaching constTemp
+const int MAX_HOLD_SECS = 36000;
+float constRampCps = 1.0f;        // setpoint ramp, 0 = step
+uint8_t constField = 0;           // CONST_SETUP: 0 setpoint, 1 ramp, 2 duration
 int testPct = 0;
-bool profileRunning = false;
-bool constRunning = false;
-bool profileDone = false;
-bool profileAborted = false;
+#ifdef LOOP_PROFILING
+uint8_t diagView = MENU;  // Mode whose timings the Diag screen shows
+#endif
+int encoderSteps = 0;     // steps carried by the EV_TURN being dispatched
+RunKind runKind = RUN_PROFILE;
+bool runAborted = false;  // how the last run reached DONE
 unsigned long runStartTime = 0;
+PIDGains g_remoteGains = {};
+bool g_remoteGainsSet = false;   // `gains` replaces the per-run defaults
+#if defined(SENSOR_MAX31855) || defined(SENSOR_MAX6675)
+float g_calOffset[2] = {0.0f, 0.0f};        // front, back (°C)
+#else
+float g_calOffset[2] = {-120.0f, -120.0f};  // until a room-temp trim or `cal`
+#endif
+
+// ---- Persistent Settings (NVS) ----
+// Bump SETTINGS_VERSION when a key changes meaning and handle the old
+// version in a migration hook passed to settings.begin()
+#define SETTINGS_VERSION 1
+const SettingDef STATION_SETTINGS[] = {
+    setting("profile",    selectedProfile),
+    setting("constTemp",  constTemp),
+    setting("constSecs",  constDuration),
+    setting("constRamp",  constRampCps),
+    SettingDef{"gains", SET_FLOAT, &g_remoteGains, sizeof(g_remoteGains)},
+    setting("gainsSet",   g_remoteGainsSet),
+    setting("cal",        g_calOffset),
+};
+
+// NVS gives back whatever bytes were stored: pull each value into the
+// range its encoder field or command accepts (a NaN float becomes 0)
+template <class T> void clampSetting(T& v, T lo, T hi, uint8_t& changed) {
+    T was = v;
+    v = v == v ? constrain(v, lo, hi) : constrain((T)0, lo, hi);
+    changed += !(was == v);
+}
+
+void clampSettings() {
+    uint8_t changed = 0;
+    clampSetting(constTemp, 0, 220, changed);
+    clampSetting(constDuration, 10, MAX_HOLD_SECS, changed);
+    clampSetting(constRampCps, 0.0f, 5.0f, changed);
+    clampSetting(g_remoteGains.P, 0.0f, 1000.0f, changed);
+    clampSetting(g_remoteGains.I, 0.0f, 100.0f, changed);
+    clampSetting(g_remoteGains.D, 0.0f, 10000.0f, changed);
+    clampSetting(g_remoteGains.iMax, 0.0f, 1000.0f, changed);
+    for (float& c : g_calOffset) clampSetting(c, -200.0f, 200.0f, changed);
+    if (changed) Serial.printf("Settings: %u saved value(s) out of range, clamped\n", changed);
+}
 
-// ---- Control State Variables ----
-float g_lastSetpoint = 0.0f;
-bool g_inCoolingMode = false;
-bool g_coolingResetDone = false;
+// ---- Profile Control State (reset on every profile start) ----
+struct ProfileControl {
+    float lastSetpoint;
+    bool  coolingMode;       // setpoint falling: heaters cut until the plate drops below it
+    bool  coolingResetDone;
+    bool  holding;           // ProfileRunner is waiting for the plates
+};
+ProfileControl g_profCtl = {};
 
 // ---- Cooling Test Variables ----
-bool g_testStarted = false;
 unsigned long g_lastLog = 0;
 float g_startTemp = 0;
 unsigned long g_testStart = 0;
+FanModelFit g_fanFit;        // cooling test: fan staircase -> FanModel
+
+// ---- Plant Characterization ----
+PlantCharacterizer g_plantChar;
+PlantModel plantModel;       // /plant.mdl, measured per plate and band
+bool plantModelValid = false;
+uint8_t g_plantBand[2] = {0xFF, 0xFF};   // band the estimator currently uses
+
+// ---- Station State Machine (states and events in Station.h) ----
+// Phase states and events line up with ProfilePhase
+static_assert(ST_SOAK - ST_PREHEAT == PHASE_SOAK && ST_COOL - ST_PREHEAT == PHASE_COOL, "phase states");
+static_assert(EV_PHASE_SOAK - EV_PHASE_PREHEAT == PHASE_SOAK && EV_PHASE_COOL - EV_PHASE_PREHEAT == PHASE_COOL, "phase events");
+
+StateMachine<ST_COUNT> fsm;
 
 // ---- Heat Selection Functions ----
 void nextHeatSelection() {
@@ -81,467 +192,1256 @@ void stopHeatAndReset() {
     heatSelection = HEAT_BOTH;
 }
 
-// ---- Mode Control Functions ----
-void startProfile() {
-    profRunner.begin(PROFILES[selectedProfile]);
-    ui.setupProfileDisplay(PROFILES[selectedProfile], profRunner.durationSec());
-    
-    currentMode = PROFILE_RUN;
-    profileRunning = true;
-    profileDone = false;
-    profileAborted = false;
-    runStartTime = millis();
-    
-    // Reset cooling state variables
-    g_lastSetpoint = 0.0f;
-    g_inCoolingMode = false;
-    g_coolingResetDone = false;
-    
-    startHeatFromSelection();
+// ---- Run Status (telemetry + recorder) ----
+float currentSetpoint() {
+    if (fsm.in(ST_PROFILE))           return g_profCtl.lastSetpoint;
+    if (fsm.in(ST_CONST))             return constRunner.setpoint();
+    if (fsm.in(ST_TEST))              return testPct * 2.0f;
+    return 0.0f;
+}
+
+uint8_t statusFlags() {
+    return (fan.isOn() ? TLM_FAN_ON : 0)
+         | (g_profCtl.coolingMode ? TLM_COOLING : 0)
+         | (fsm.in(ST_RUN) ? TLM_RUNNING : 0)
+         | (sensors.sensorFault() ? TLM_SENSOR_ERR : 0)
+         | (manualFanMode ? TLM_MANUAL_FAN : 0)
+         | (tach.stalled() ? TLM_FAN_STALL : 0)
+         | (tach.health() == FanTach::TACH_DEGRADED ? TLM_FAN_DEGRADED : 0);
+}
+
+void sendTelemetry(uint16_t loopUs) {
+    TelemetryFrame f;
+    f.mode       = currentMode;
+    f.rawFront   = sensors.rawFront();
+    f.rawBack    = sensors.rawBack();
+    f.tFrontCc   = (int16_t)(sensors.tempFront() * 100.0f);
+    f.tBackCc    = (int16_t)(sensors.tempBack() * 100.0f);
+    f.setpointCc = (int16_t)(currentSetpoint() * 100.0f);
+    f.dutyFront  = heater.dutyFrontPct();
+    f.dutyBack   = heater.dutyBackPct();
+    f.fanPct     = fan.dutyPct();
+    f.flags      = statusFlags();
+    f.loopUs     = loopUs;
+    telemetry.send(f, clockMs());
+#ifdef REFLOW_WIFI
+    dashboard.publish(f, clockMs());
+#endif
+}
+
+void startRecording(RunKind kind, const char* name) {
+    RunHeader h = {};
+    h.kind = kind;
+    h.periodMs = 1000;
+    strncpy(h.name, name, sizeof(h.name) - 1);   // h is zeroed: always terminated
+    h.constTempC = constTemp;
+    h.gains = heater.gains();
+    h.calOffsetF = sensors.frontOffset();  h.calScaleF = sensors.frontScale();
+    h.calOffsetB = sensors.backOffset();   h.calScaleB = sensors.backScale();
+    recorder.startRun(h);
+}
+
+void recordSample() {
+    recorder.sample(clockMs(), sensors.tempFront(), sensors.tempBack(), currentSetpoint(),
+                    heater.dutyFrontPct(), heater.dutyBackPct(), fan.dutyPct(), statusFlags());
+}
+
+// ---- Plant model ----
+// Plate model for the estimator and the profile checks: the measured plant
+// when there is one, and the fan from the cooling test
+void applyPlantModel() {
+    if (plantModelValid) {
+        PlantParams defF = sensors.plantFront(), defB = sensors.plantBack();
+        sensors.setPlantParams(plantParamsFor(plantModel, 0, PLANT_ALL, defF),
+                               plantParamsFor(plantModel, 1, PLANT_ALL, defB));
+    }
+    g_plantBand[0] = g_plantBand[1] = 0xFF;
+    PlateLimits limits = DEFAULT_PLATE_LIMITS;   // ramp checks use the estimator's plate model
+    limits.front = sensors.plantFront();
+    limits.back  = sensors.plantBack();
+    limits.fanLossCoef = coolCtl.model().fanLossCoef;
+    profileLib.setLimits(limits);
+}
+
+// The estimator follows the fit of the band each plate is in
+void schedulePlant() {
+    if (!plantModelValid) return;
+    uint8_t f = plantBand(sensors.tempFront()), b = plantBand(sensors.tempBack());
+    if (f == g_plantBand[0] && b == g_plantBand[1]) return;
+    g_plantBand[0] = f;
+    g_plantBand[1] = b;
+    sensors.setPlantParams(plantParamsFor(plantModel, 0, f, sensors.plantFront()),
+                           plantParamsFor(plantModel, 1, b, sensors.plantBack()));
+}
+
+// ---- Idle: menu, heater test, cooling test, diagnostics ----
+void menuTurn() {
+    menuIndex += encoderSteps;
+    if (menuIndex < 0) menuIndex = 4;
+    if (menuIndex > 4) menuIndex = 0;
+}
+
+void menuClick() {
+    switch (menuIndex) {
+        case 0:
+            nextHeatSelection();
+            tone(BUZZER_PIN, 1500, 60);
+            break;
+        case 1:
+            fsm.post(EV_GO_PROFILE);
+            break;
+        case 2:
+            fsm.post(EV_GO_CONST);
+            break;
+        case 3:
+            if (!manualFanMode) {
+                manualFanMode = true;
+                manualFanState = false;
+                fan.set(false);
+            } else {
+                manualFanState = !manualFanState;
+                fan.set(manualFanState);
+            }
+            tone(BUZZER_PIN, 1500, 60);
+            break;
+        case 4:
+            fsm.post(EV_GO_TEST);
+            break;
+    }
+}
+
+void refuseNoHeaters() {
+    tone(BUZZER_PIN, 800, 200);
+}
+
+void testEnter() {
+    testPct = 0;
     manualFanMode = false;
-    
-    PIDGains gains = {3.0f, 0.13f, 8.0f, 150.0f};
-    heater.setGains(gains);
+    heater.setMaxOutput(90);
+    fan.set(false);
+}
+
+void testTurn() {
+    testPct += encoderSteps * 5;
+    if (testPct < 0) testPct = 0;
+    if (testPct > 100) testPct = 100;
+}
+
+void testTick() {
+    // Use manual control by bypassing PID and directly setting a constant setpoint
+    float manualSetpoint = (float)testPct * 2.0f;  // Convert 0-100% to 0-200°C range
+    heater.control(heatSelection, manualSetpoint, sensors.tempFront(), sensors.tempBack());
+}
+
+void testStop() {
     heater.reset();
     fan.set(false);
-    
-    Serial.print("Started profile: ");
-    Serial.println(PROFILES[selectedProfile].name);
+    tone(BUZZER_PIN, 1200, 80);
 }
 
-void startConstant() {
-    currentMode = CONST_RUN;
-    constRunning = true;
-    profileDone = false;
-    profileAborted = false;
-    runStartTime = millis();
-    
-    startHeatFromSelection();
-    manualFanMode = false;
-    
-    PIDGains gains = {10.0f, 0.1f, 100.0f, 150.0f};
+void coolTestEnter() {
+    g_lastLog = 0;
+    g_startTemp = 0;
+    g_testStart = 0;
+    LOGI("COOL", "=== STARTING COOLING TEST ===");
+    tone(BUZZER_PIN, 1500, 200);
+}
+
+void coolTestHeatEnter() {
+    heater.setMaxOutput(90);
+    PIDGains gains = {6.0f, 0.15f, 8.0f, 150.0f};
     heater.setGains(gains);
+}
+
+void coolTestHeatTick() {
+    heater.control(HEAT_BOTH, 200.0f, sensors.tempFront(), sensors.tempBack());
+    if (max(sensors.tempFront(), sensors.tempBack()) >= 200.0f) fsm.post(EV_AT_TEMP);
+}
+
+void coolTestCoolEnter() {
+    g_startTemp = max(sensors.tempFront(), sensors.tempBack());
+    g_testStart = clockMs();
+    g_lastLog = clockMs();
+
     heater.reset();
+    g_fanFit.begin(g_testStart, coolCtl.model().ambientC);
+    fan.setDutyPct(g_fanFit.update(g_testStart, g_startTemp));
+
+    LOGI("COOL", "Fan steps of %us identify the fan model, then 100%%", FanModelFit::STEP_SECS);
+    LOGI("COOL", "Time,Temp,Rate");
+    LOGI("COOL", "0,%.1f,0.0", g_startTemp);
+}
+
+void coolTestCoolTick() {
+    float maxTemp = max(sensors.tempFront(), sensors.tempBack());
+    unsigned long elapsed = clockMs() - g_testStart;
+
+    if (!g_fanFit.done()) {
+        fan.setDutyPct(g_fanFit.update(clockMs(), maxTemp, tach.rpm()));
+        FanModel m = coolCtl.model();
+        if (g_fanFit.done() && g_fanFit.result(m)) {
+            coolCtl.setModel(m);
+            coolCtl.save();
+            tach.setSpinFloor(m.minSpinPct);
+            applyPlantModel();
+            LOGI("COOL", "Fan model: loss %.4f + fan %.4f /s, spin floor %u%%, %u rpm at 100%% (saved)",
+                 m.lossCoef, m.fanLossCoef, m.minSpinPct, m.rpmAt[FAN_RPM_POINTS - 1]);
+        } else if (g_fanFit.done()) {
+            LOGW("COOL", "Fan model fit failed, keeping the old one");
+        }
+    }
+
+    if (clockMs() - g_lastLog >= 30000) {
+        float elapsedMin = elapsed / 60000.0f;
+        float tempDrop = g_startTemp - maxTemp;
+        float ratePerMin = tempDrop / elapsedMin;
+
+        LOGI("COOL", "%lu,%.1f,%.1f", elapsed / 1000, maxTemp, ratePerMin);
+
+        g_lastLog = clockMs();
+    }
+
+    if (maxTemp < 40.0f) {
+        float totalMin = elapsed / 60000.0f;
+        float avgRate = (g_startTemp - maxTemp) / totalMin;
+
+        LOGI("COOL", "Avg: %.1f C/min | Time: %.1f min", avgRate, totalMin);
+        fsm.post(EV_COOLED);
+    }
+}
+
+void coolTestDone() {
     fan.set(false);
-    
-    Serial.print("Started constant: ");
-    Serial.print(constTemp);
-    Serial.println("C");
+    tone(BUZZER_PIN, 600, 1000);
 }
 
-void returnToMenu() {
-    profileDone = false;
-    profileAborted = false;
-    profileRunning = false;
-    constRunning = false;
-    currentMode = MENU;
+// ---- Plant characterization (Test at 100%, hold) ----
+bool testAtFull() {
+    return testPct >= 100;
+}
+
+void charEnter() {
+    float cold = min(sensors.tempFront(), sensors.tempBack());
+    float ambient = cold < 35.0f ? cold : coolCtl.model().ambientC;
     heater.reset();
+    heater.setMaxOutput(90);
     manualFanMode = false;
-    fan.set(true);
-    stopHeatAndReset();
-    
-    // Reset global state variables
-    g_lastSetpoint = 0.0f;
-    g_inCoolingMode = false;
-    g_coolingResetDone = false;
+    g_plantChar.begin(clockMs(), ambient);
+    startRecording(RUN_CHARACTERIZE, "Characterize");
+    LOGI("CHAR", "=== PLANT CHARACTERIZATION (ambient %.1f C) ===", ambient);
+    tone(BUZZER_PIN, 1500, 200);
 }
 
-void handleButtonPress() {
-    switch (currentMode) {
-        case MENU:
-            switch (menuIndex) {
-                case 0:
-                    nextHeatSelection();
-                    tone(BUZZER_PIN, 1500, 60);
-                    break;
-                case 1:
-                    if (!hasHeatersSelected()) {
-                        tone(BUZZER_PIN, 800, 200);
-                        break;
-                    }
-                    currentMode = PROF_SETUP;
-                    break;
-                case 2:
-                    if (!hasHeatersSelected()) {
-                        tone(BUZZER_PIN, 800, 200);
-                        break;
-                    }
-                    currentMode = CONST_SETUP;
-                    break;
-                case 3:
-                    if (!manualFanMode) {
-                        manualFanMode = true;
-                        manualFanState = false;
-                        fan.set(false);
-                        tone(BUZZER_PIN, 1500, 60);
-                    } else {
-                        manualFanState = !manualFanState;
-                        fan.set(manualFanState);
-                        tone(BUZZER_PIN, 1500, 60);
-                    }
-                    break;
-                case 4:
-                    currentMode = TEST_RUN;
-                    testPct = 0;
-                    manualFanMode = false;
-                    fan.set(false);
-                    break;
-            }
-            break;
-            
-        case PROF_SETUP:
-            startProfile();
-            break;
-            
-        case CONST_SETUP:
-            startConstant();
-            break;
-            
-        case PROFILE_RUN:
-            if (profileDone || profileAborted) {
-                returnToMenu();
-            } else {
-                profileAborted = true;
-                tone(BUZZER_PIN, 1200, 80);
-            }
-            break;
-            
-        case CONST_RUN:
-            if (profileDone || profileAborted) {
-                returnToMenu();
-            } else {
-                profileAborted = true;
-                tone(BUZZER_PIN, 1200, 80);
-            }
+void charTick() {
+    g_plantChar.update(clockMs(), sensors.tempFront(), sensors.tempBack());
+    heater.drive(g_plantChar.dutyFront(), g_plantChar.dutyBack());
+    fan.setDutyPct(g_plantChar.fanPct());
+    recordSample();
+    if (g_plantChar.done()) fsm.post(EV_FINISHED);
+}
+
+void charExit() {
+    heater.reset();
+    recorder.endRun();
+    // Hot plates keep the fan; the menu turns it off below 35C
+    if (max(sensors.tempFront(), sensors.tempBack()) < 40.0f) fan.set(false);
+    else fan.set(true);
+}
+
+void charDone() {
+    PlantModel m;
+    if (g_plantChar.phase() == PlantCharacterizer::PH_DONE && g_plantChar.result(m)) {
+        PlantCharacterizer::report(m);
+        plantModel = m;
+        plantModelValid = true;
+        PlantCharacterizer::save(m);
+        applyPlantModel();
+        tone(BUZZER_PIN, 600, 1000);
+    } else {
+        LOGW("CHAR", "No usable plant model, keeping the old one");
+        tone(BUZZER_PIN, 400, 1000);
+    }
+}
+
+void charStop() {
+    LOGW("CHAR", "Aborted in %s", PlantCharacterizer::phaseName(g_plantChar.phase()));
+    tone(BUZZER_PIN, 1200, 80);
+}
+
+#ifdef LOOP_PROFILING
+void diagEnter() {
+    diagView = MENU;
+    tone(BUZZER_PIN, 1500, 60);
+}
+
+void diagTurn() {
+    diagView = (diagView + MODE_COUNT + encoderSteps % MODE_COUNT) % MODE_COUNT;
+}
+
+void diagClick() {
+    loopProfiler.dump();
+    tone(BUZZER_PIN, 1500, 60);
+}
+#endif
+
+// ---- Setup screens ----
+void profSetupTurn() {
+    int p = (int)selectedProfile + encoderSteps;
+    if (p < 0) p = profileLib.count() - 1;
+    if (p >= profileLib.count()) p = 0;
+    selectedProfile = p;
+}
+
+// Hold time steps: 10 s up to 10 min, then whole minutes
+int durationStep(int secs, int steps) {
+    int step = (secs < 600 || (secs == 600 && steps < 0)) ? 10 : 60;
+    return constrain(secs + steps * step, 10, MAX_HOLD_SECS);
+}
+
+void constSetupEnter() {
+    constField = 0;
+}
+
+void constSetupTurn() {
+    switch (constField) {
+        case 0:
+            constTemp = constrain(constTemp + encoderSteps, 0, 220);
             break;
-            
-        case TEST_RUN:
-            heater.reset();
-            fan.set(false);
-            currentMode = MENU;
-            tone(BUZZER_PIN, 1200, 80);
+        case 1:
+            constRampCps = constrain(roundf(constRampCps * 10.0f + encoderSteps) / 10.0f, 0.0f, 5.0f);
             break;
-            
         default:
+            constDuration = durationStep(constDuration, encoderSteps);
             break;
     }
 }
 
-void handleLongPress() {
-    if (currentMode == TEST_RUN) {
-        currentMode = COOL_TEST;
-        // Reset cooling test variables
-        g_testStarted = false;
-        g_lastLog = 0;
-        g_startTemp = 0;
-        g_testStart = 0;
-        Serial.println("=== STARTING COOLING TEST ===");
-        tone(BUZZER_PIN, 1500, 200);
+bool constFieldsDone() {
+    return constField >= 2;
+}
+
+void constSetupNext() {
+    constField++;
+}
+
+// ---- Runs ----
+void runEnter() {
+    runStartTime = clockMs();
+    runAborted = false;
+    startHeatFromSelection();
+    manualFanMode = false;
+    heater.setMaxOutput(90);
+    fan.set(false);
+    coolCtl.reset();
+}
+
+void runExit() {
+    recorder.endRun();
+    heater.reset();
+}
+
+void markAborted() {
+    runAborted = true;
+}
+
+// The limits can tighten after boot (applyPlantModel): check the selected
+// profile against the current ones each time it is started
+bool profileRunnable() {
+    const Profile& prof = profileLib.get(selectedProfile);
+    if (!profileLib.lastCheck().errors) return true;
+    LOGE("RUN", "%s cannot run: %u error(s) against the plate limits", prof.name, profileLib.lastCheck().errors);
+    tone(BUZZER_PIN, 400, 300);
+    return false;
+}
+
+void profileEnter() {
+    runKind = RUN_PROFILE;
+    const Profile& prof = profileLib.get(selectedProfile);
+    profRunner.begin(prof);
+    ui.setupProfileDisplay(prof, profRunner.durationSec());
+    g_profCtl = ProfileControl{};
+
+    PIDGains gains = {3.0f, 0.13f, 8.0f, 150.0f};
+    heater.setGains(g_remoteGainsSet ? g_remoteGains : gains);
+    heater.reset();
+
+    LOGI("RUN", "Started profile: %s (%u slots)", prof.name, prof.slotCount);
+    startRecording(RUN_PROFILE, prof.name);
+}
+
+void phaseEnter() {
+    LOGI("RUN", "Phase: %s", fsm.stateName(fsm.state()));
+}
+
+// Lowest / highest plate estimate among the heaters in use
+void activePlateRange(float& lo, float& hi) {
+    float f = sensors.estFront(), b = sensors.estBack();
+    if (heatActive == HEAT_FRONT)     { lo = hi = f; }
+    else if (heatActive == HEAT_BACK) { lo = hi = b; }
+    else                              { lo = min(f, b); hi = max(f, b); }
+}
+
+void profileTick() {
+    uint32_t now = clockMs();
+    float lo, hi;
+    activePlateRange(lo, hi);
+
+    bool finished = false;
+    float setpoint = profRunner.update(now, finished, lo, hi);
+    int elapsed = profRunner.elapsedSec(now);
+    int remaining = profRunner.expectedFinishSec(now) - (now - runStartTime) / 1000;
+
+    if (profRunner.holding() != g_profCtl.holding) {
+        g_profCtl.holding = profRunner.holding();
+        if (g_profCtl.holding) LOGI("RUN", "Holding at %.0fC for plates (%.1f..%.1f)", setpoint, lo, hi);
+        else LOGI("RUN", "Hold released, %us held in total%s", profRunner.heldSec(),
+                  profRunner.holdTimeouts() ? " (timed out)" : "");
+    }
+
+    if (finished) {
+        recordSample();
+        fsm.post(EV_FINISHED);
         return;
     }
-    
+
+    ProfilePhase phase = profRunner.phase(now);
+    if (fsm.state() != ST_PREHEAT + phase) fsm.post(EV_PHASE_PREHEAT + phase);
+
+    float maxTemp = max(sensors.tempFront(), sensors.tempBack());
+
+    // Detect cooling mode entry. A smooth setpoint leaves the peak with zero
+    // slope, so ask the runner instead of waiting for a visible drop.
+    bool falling = profRunner.smooth() ? profRunner.falling() : (setpoint < g_profCtl.lastSetpoint - 0.5f);
+    if (falling) {
+        if (!g_profCtl.coolingMode) {
+            g_profCtl.coolingMode = true;
+            g_profCtl.coolingResetDone = false;
+            LOGI("CONTROL", "Entering cooling mode");
+        }
+    }
+
+    // Exit cooling mode when temp drops sufficiently
+    if (g_profCtl.coolingMode && maxTemp < setpoint - 3.0f) {
+        g_profCtl.coolingMode = false;
+        LOGI("CONTROL", "Exiting cooling mode");
+    }
+
+    g_profCtl.lastSetpoint = setpoint;
+
+    uint16_t coolingStart = profRunner.coolingStartSec();
+    bool inCoolingPhase = (elapsed >= coolingStart);
+
+    // Heater control
+    if (g_profCtl.coolingMode && !g_profCtl.coolingResetDone) {
+        heater.reset();
+        heater.setMaxOutput(0);
+        g_profCtl.coolingResetDone = true;
+        LOGI("CONTROL", "Heaters disabled for cooling");
+    } else if (!g_profCtl.coolingMode) {
+        g_profCtl.coolingResetDone = false;
+
+        if (maxTemp > setpoint - 5.0f && !inCoolingPhase) {
+            heater.setMaxOutput(50);
+        } else {
+            heater.setMaxOutput(90);
+        }
+
+        heater.control(heatActive, setpoint, sensors.estFront(), sensors.estBack());
+    }
+
+    // Fan control: while cooling, the duty follows the setpoint's slope
+    if (!manualFanMode) {
+        if (g_profCtl.coolingMode || inCoolingPhase) {
+            float rate = (sensors.estFront() >= sensors.estBack()) ? sensors.rateFront() : sensors.rateBack();
+            uint8_t duty = coolCtl.update(now, profRunner.slopeCps(), rate, maxTemp);
+            // Hot plates keep at least the spin floor (the >80C rule below)
+            if (maxTemp >= 80.0f && duty < coolCtl.model().minSpinPct) duty = coolCtl.model().minSpinPct;
+            if (duty != fan.dutyPct()) LOGD("FAN", "Rate control %u%% (want %.2f C/s, have %.2f)",
+                                            duty, -profRunner.slopeCps(), -rate);
+            fan.setDutyPct(duty);
+        } else if (maxTemp < 50.0f && fan.isOn()) {
+            fan.set(false);
+            LOGI("FAN", "Cool enough - fan off");
+        }
+    }
+
+    // Safety override
+    if (maxTemp >= 80.0f && !fan.isOn() && !manualFanMode) {
+        fan.set(true);
+        LOGI("FAN", "Safety override (>80C)");
+    }
+
+    // Update profile display with condensed graph + data
+    ui.showProfileRun(profileLib.get(selectedProfile), setpoint,
+                      sensors.tempFront(), sensors.tempBack(),
+                      heater.dutyFrontPct(), heater.dutyBackPct(),
+                      elapsed, remaining, false, false,
+                      phase, profRunner.holding() ? (int)profRunner.holdSec(now) : -1);
+}
+
+void constEnter() {
+    runKind = RUN_CONSTANT;
+    PIDGains gains = {10.0f, 0.1f, 100.0f, 150.0f};
+    heater.setGains(g_remoteGainsSet ? g_remoteGains : gains);
+    heater.reset();
+
+    float lo, hi;
+    activePlateRange(lo, hi);
+    constRunner.begin(constTemp, constRampCps, constDuration, lo, clockMs());
+    LOGI("RUN", "Started constant: %dC, ramp %.1f C/s from %.0fC, hold %ds", constTemp, constRampCps, lo, constDuration);
+    startRecording(RUN_CONSTANT, "Constant");
+}
+
+void constTick() {
+    uint32_t now = clockMs();
+    float lo, hi;
+    activePlateRange(lo, hi);
+
+    bool wasTiming = constRunner.timing();
+    bool finished = false;
+    float setpoint = constRunner.update(now, finished, lo, hi);
+    if (constRunner.timing() && !wasTiming) {
+        if (constRunner.reachTimedOut())
+            LOGW("RUN", "Plates still at %.1f..%.1fC, timing the hold anyway", lo, hi);
+        else
+            LOGI("RUN", "At %.0fC after %us, holding %us", constRunner.targetC(), constRunner.reachSec(),
+                 constRunner.remainingSec(now));
+    }
+
+    if (finished) {
+        recordSample();
+        fsm.post(EV_FINISHED);
+        return;
+    }
+
+    heater.control(heatActive, setpoint, sensors.estFront(), sensors.estBack());
+
+    ui.showConstantRun(setpoint, constTemp, sensors.tempFront(), sensors.tempBack(),
+                       heater.dutyFrontPct(), heater.dutyBackPct(), constRampCps,
+                       constRunner.timing(), constRunner.remainingSec(now));
+}
+
+// Turning during the run edits the time left
+void constRunTurn() {
+    uint32_t now = clockMs();
+    int left = durationStep(constRunner.remainingSec(now), encoderSteps);
+    // Held time counts toward the hold, so the total is what gets capped
+    constRunner.setHoldSec(min(constRunner.heldSec(now) + left, MAX_HOLD_SECS));
+    constDuration = constRunner.holdSec();
+}
+
+// ---- Done / Fault ----
+void doneEnter() {
+    if (runAborted) {
+        tone(BUZZER_PIN, 1200, 80);
+    } else {
+        fan.set(true);
+        tone(BUZZER_PIN, 600, 2000);
+    }
+    ui.showProfileRun(profileLib.get(selectedProfile), 0, 0, 0, 0, 0, 0, 0, !runAborted, runAborted);
+}
+
+void returnToMenu() {
+    heater.reset();
+    manualFanMode = false;
+    fan.set(true);
+    stopHeatAndReset();
+}
+
+void longPressReset() {
     heater.reset();
     fan.set(false);
     manualFanMode = false;
-    profileRunning = false;
-    constRunning = false;
-    currentMode = MENU;
     stopHeatAndReset();
     tone(BUZZER_PIN, 1200, 80);
 }
 
+// A stalled fan only matters while the plates need it
+bool fanFault() {
+    return tach.stalled() && max(sensors.tempFront(), sensors.tempBack()) >= 80.0f;
+}
+
+const char* g_faultReason = "";
+
+void faultEnter() {
+    heater.reset();
+    fan.set(true);
+    g_faultReason = sensors.sensorFault() ? "Sensor error" : "Fan stalled";
+    LOGE("RUN", "%s (F:%.1f B:%.1f, fan %u rpm) - heaters off", g_faultReason,
+         sensors.tempFront(), sensors.tempBack(), tach.rpm());
+    tone(BUZZER_PIN, 400, 1000);
+}
+
+bool faultCleared() {
+    return !sensors.sensorFault() && !fanFault();
+}
+
+// ---- State / Transition Tables ----
+const FsmState STATION_STATES[ST_COUNT] = {
+    // name          parent          entry               exit
+    {"idle",         FSM_NONE,       nullptr,            nullptr},
+    {"menu",         ST_IDLE,        nullptr,            nullptr},
+    {"test",         ST_IDLE,        testEnter,          nullptr},
+    {"cool_test",    ST_IDLE,        coolTestEnter,      nullptr},
+    {"ct_heat",      ST_COOL_TEST,   coolTestHeatEnter,  nullptr},
+    {"ct_cool",      ST_COOL_TEST,   coolTestCoolEnter,  nullptr},
+    {"characterize", ST_IDLE,        charEnter,          charExit},
+#ifdef LOOP_PROFILING
+    {"diag",         ST_IDLE,        diagEnter,          nullptr},
+#endif
+    {"setup",        FSM_NONE,       nullptr,            nullptr},
+    {"prof_setup",   ST_SETUP,       nullptr,            nullptr},
+    {"const_setup",  ST_SETUP,       constSetupEnter,    nullptr},
+    {"run",          FSM_NONE,       runEnter,           runExit},
+    {"profile",      ST_RUN,         profileEnter,       nullptr},
+    {"preheat",      ST_PROFILE,     phaseEnter,         nullptr},
+    {"soak",         ST_PROFILE,     phaseEnter,         nullptr},
+    {"reflow",       ST_PROFILE,     phaseEnter,         nullptr},
+    {"cool",         ST_PROFILE,     phaseEnter,         nullptr},
+    {"constant",     ST_RUN,         constEnter,         nullptr},
+    {"done",         FSM_NONE,       doneEnter,          nullptr},
+    {"fault",        FSM_NONE,       faultEnter,         nullptr},
+};
+
+// Child rows are tried before their parents'; first passing guard wins
+const FsmTransition STATION_ROWS[] = {
+    // from            event             to               guard               action
+    {ST_MENU,          EV_TURN,          FSM_INTERNAL,    nullptr,            menuTurn},
+    {ST_MENU,          EV_CLICK,         FSM_INTERNAL,    nullptr,            menuClick},
+#ifdef LOOP_PROFILING
+    {ST_MENU,          EV_LONG,          ST_DIAG,         nullptr,            nullptr},
+#endif
+    {ST_MENU,          EV_GO_PROFILE,    ST_PROF_SETUP,   hasHeatersSelected, nullptr},
+    {ST_MENU,          EV_GO_PROFILE,    FSM_INTERNAL,    nullptr,            refuseNoHeaters},
+    {ST_MENU,          EV_GO_CONST,      ST_CONST_SETUP,  hasHeatersSelected, nullptr},
+    {ST_MENU,          EV_GO_CONST,      FSM_INTERNAL,    nullptr,            refuseNoHeaters},
+    {ST_MENU,          EV_GO_TEST,       ST_TEST,         nullptr,            nullptr},
+
+    {ST_TEST,          EV_TICK,          FSM_INTERNAL,    nullptr,            testTick},
+    {ST_TEST,          EV_TURN,          FSM_INTERNAL,    nullptr,            testTurn},
+    {ST_TEST,          EV_CLICK,         ST_MENU,         nullptr,            testStop},
+    {ST_TEST,          EV_LONG,          ST_CHAR,         testAtFull,         nullptr},
+    {ST_TEST,          EV_LONG,          ST_CT_HEAT,      nullptr,            nullptr},
+    {ST_TEST,          EV_ABORT,         ST_MENU,         nullptr,            testStop},
+    {ST_TEST,          EV_FAULT,         ST_FAULT,        nullptr,            nullptr},
+
+    {ST_CT_HEAT,       EV_TICK,          FSM_INTERNAL,    nullptr,            coolTestHeatTick},
+    {ST_CT_HEAT,       EV_AT_TEMP,       ST_CT_COOL,      nullptr,            nullptr},
+    {ST_CT_COOL,       EV_TICK,          FSM_INTERNAL,    nullptr,            coolTestCoolTick},
+    {ST_CT_COOL,       EV_COOLED,        ST_MENU,         nullptr,            coolTestDone},
+    {ST_COOL_TEST,     EV_FAULT,         ST_FAULT,        nullptr,            nullptr},
+
+    {ST_CHAR,          EV_TICK,          FSM_INTERNAL,    nullptr,            charTick},
+    {ST_CHAR,          EV_FINISHED,      ST_MENU,         nullptr,            charDone},
+    {ST_CHAR,          EV_CLICK,         ST_MENU,         nullptr,            charStop},
+    {ST_CHAR,          EV_LONG,          ST_MENU,         nullptr,            charStop},
+    {ST_CHAR,          EV_ABORT,         ST_MENU,         nullptr,            charStop},
+    {ST_CHAR,          EV_FAULT,         ST_FAULT,        nullptr,            nullptr},
+
+#ifdef LOOP_PROFILING
+    {ST_DIAG,          EV_TURN,          FSM_INTERNAL,    nullptr,            diagTurn},
+    {ST_DIAG,          EV_CLICK,         FSM_INTERNAL,    nullptr,            diagClick},
+#endif
+    {ST_IDLE,          EV_LONG,          ST_MENU,         nullptr,            longPressReset},
+    {ST_IDLE,          EV_ABORT,         ST_MENU,         nullptr,            longPressReset},
+
+    {ST_PROF_SETUP,    EV_TURN,          FSM_INTERNAL,    nullptr,            profSetupTurn},
+    {ST_PROF_SETUP,    EV_CLICK,         ST_PREHEAT,      profileRunnable,    nullptr},
+    {ST_CONST_SETUP,   EV_TURN,          FSM_INTERNAL,    nullptr,            constSetupTurn},
+    {ST_CONST_SETUP,   EV_CLICK,         ST_CONST,        constFieldsDone,    nullptr},
+    {ST_CONST_SETUP,   EV_CLICK,         FSM_INTERNAL,    nullptr,            constSetupNext},
+    {ST_SETUP,         EV_LONG,          ST_MENU,         nullptr,            longPressReset},
+    {ST_SETUP,         EV_ABORT,         ST_MENU,         nullptr,            longPressReset},
+
+    {ST_PROFILE,       EV_TICK,          FSM_INTERNAL,    nullptr,            profileTick},
+    {ST_PROFILE,       EV_PHASE_PREHEAT, ST_PREHEAT,      nullptr,            nullptr},
+    {ST_PROFILE,       EV_PHASE_SOAK,    ST_SOAK,         nullptr,            nullptr},
+    {ST_PROFILE,       EV_PHASE_REFLOW,  ST_REFLOW,       nullptr,            nullptr},
+    {ST_PROFILE,       EV_PHASE_COOL,    ST_COOL,         nullptr,            nullptr},
+    {ST_CONST,         EV_TICK,          FSM_INTERNAL,    nullptr,            constTick},
+    {ST_CONST,         EV_TURN,          FSM_INTERNAL,    nullptr,            constRunTurn},
+    {ST_RUN,           EV_FINISHED,      ST_DONE,         nullptr,            nullptr},
+    {ST_RUN,           EV_CLICK,         ST_DONE,         nullptr,            markAborted},
+    {ST_RUN,           EV_LONG,          ST_MENU,         nullptr,            longPressReset},
+    {ST_RUN,           EV_ABORT,         ST_DONE,         nullptr,            markAborted},
+    {ST_RUN,           EV_FAULT,         ST_FAULT,        nullptr,            nullptr},
+
+    {ST_DONE,          EV_CLICK,         ST_MENU,         nullptr,            returnToMenu},
+    {ST_DONE,          EV_LONG,          ST_MENU,         nullptr,            longPressReset},
+    {ST_DONE,          EV_ABORT,         ST_MENU,         nullptr,            returnToMenu},
+    {ST_FAULT,         EV_CLICK,         ST_MENU,         faultCleared,       returnToMenu},
+    {ST_FAULT,         EV_LONG,          ST_MENU,         faultCleared,       longPressReset},
+};
+
+// Screen / telemetry Mode for each state (DONE keeps the mode of its run)
+const Mode STATE_MODE[ST_COUNT] = {
+    MENU, MENU, TEST_RUN, COOL_TEST, COOL_TEST, COOL_TEST, CHARACTERIZE,
+#ifdef LOOP_PROFILING
+    DIAG,
+#endif
+    PROF_SETUP, PROF_SETUP, CONST_SETUP,
+    PROFILE_RUN, PROFILE_RUN, PROFILE_RUN, PROFILE_RUN, PROFILE_RUN, PROFILE_RUN, CONST_RUN,
+    PROFILE_RUN, FAULT
+};
+
+void onStateChange(uint8_t from, uint8_t event, uint8_t to) {
+    if (to == ST_DONE) currentMode = (runKind == RUN_CONSTANT) ? CONST_RUN : PROFILE_RUN;
+    else               currentMode = STATE_MODE[to];
+    LOGD("FSM", "%s -> %s (ev %u)", fsm.stateName(from), fsm.stateName(to), event);
+}
+
+void stationBegin() {
+    fsm.setTrace(onStateChange);
+    fsm.begin(STATION_STATES, ST_COUNT, STATION_ROWS,
+              sizeof(STATION_ROWS) / sizeof(STATION_ROWS[0]), ST_MENU);
+    currentMode = MENU;
+}
+
 // ---- Input Handling ----
 void handleEncoder() {
     InputEvents events = encoder.poll();
-    
+
     if (events.steps != 0) {
-        switch (currentMode) {
-            case MENU:
-                menuIndex += events.steps;
-                if (menuIndex < 0) menuIndex = 4;
-                if (menuIndex > 4) menuIndex = 0;
-                break;
-                
-            case PROF_SETUP:
-                selectedProfile += events.steps;
-                if ((int)selectedProfile < 0) selectedProfile = PROFILE_COUNT - 1;
-                if (selectedProfile >= PROFILE_COUNT) selectedProfile = 0;
-                break;
-                
-            case CONST_SETUP:
-                constTemp += events.steps;
-                if (constTemp < 0) constTemp = 0;
-                if (constTemp > 220) constTemp = 220;
-                break;
-                
-            case TEST_RUN:
-                testPct += events.steps * 5;
-                if (testPct < 0) testPct = 0;
-                if (testPct > 100) testPct = 100;
-                break;
-                
-            default:
-                break;
-        }
+        encoderSteps = events.steps;
+        fsm.dispatch(EV_TURN);
     }
-    
+
     if (events.click) {
-        handleButtonPress();
+        fsm.dispatch(EV_CLICK);
     }
-    
+
     if (events.longPress) {
-        handleLongPress();
+        fsm.dispatch(EV_LONG);
     }
 }
 
-// ---- Cooling Test ----
-void runCoolingTest() {
-    if (!g_testStarted) {
-        heater.setMaxOutput(90);
-        PIDGains gains = {6.0f, 0.15f, 8.0f, 150.0f};
-        heater.setGains(gains);
-        
-        float maxTemp = max(sensors.tempFront(), sensors.tempBack());
-        heater.control(HEAT_BOTH, 200.0f, sensors.tempFront(), sensors.tempBack());
-        
-        if (maxTemp >= 200.0f) {
-            g_testStarted = true;
-            g_startTemp = maxTemp;
-            g_testStart = millis();
-            g_lastLog = millis();
-            
-            heater.reset();
-            fan.set(true);
-            
-            Serial.println("\nTime,Temp,Rate");
-            Serial.print("0,");
-            Serial.print(g_startTemp, 1);
-            Serial.println(",0.0");
-        }
-    } else {
-        float maxTemp = max(sensors.tempFront(), sensors.tempBack());
-        unsigned long elapsed = millis() - g_testStart;
-        
-        if (millis() - g_lastLog >= 30000) {
-            float elapsedMin = elapsed / 60000.0f;
-            float tempDrop = g_startTemp - maxTemp;
-            float ratePerMin = tempDrop / elapsedMin;
-            
-            Serial.print(elapsed / 1000);
-            Serial.print(",");
-            Serial.print(maxTemp, 1);
-            Serial.print(",");
-            Serial.println(ratePerMin, 1);
-            
-            g_lastLog = millis();
-        }
-        
-        if (maxTemp < 40.0f) {
-            float totalMin = elapsed / 60000.0f;
-            float avgRate = (g_startTemp - maxTemp) / totalMin;
-            
-            Serial.print("\nAvg: ");
-            Serial.print(avgRate, 1);
-            Serial.print(" C/min | Time: ");
-            Serial.print(totalMin, 1);
-            Serial.println(" min");
-            
-            fan.set(false);
-            g_testStarted = false;
-            currentMode = MENU;
-            tone(BUZZER_PIN, 600, 1000);
-        }
+// ---- Remote Commands (Serial) ----
+// Commands raise the same events as the encoder, so they can do what the
+// knob can and nothing more; `abort` and `start` answer with the new state.
+const char* HEAT_NAMES[] = {"off", "both", "front", "back"};
+
+// Menu-like states only: not while heating, testing or characterizing
+bool cmdIdle() {
+    uint8_t s = fsm.state();
+#ifdef LOOP_PROFILING
+    if (s == ST_DIAG) return true;
+#endif
+    if (s == ST_MENU || s == ST_DONE || fsm.in(ST_SETUP)) return true;
+    commands.err("busy in %s (abort first)", fsm.stateName(fsm.state()));
+    return false;
+}
+
+void cmdStatus(uint8_t, char**) {
+    commands.ok("state=%s mode=%s tF=%.1f tB=%.1f sp=%.1f duty=%d/%d fan=%u heat=%s profile=%u const=%d/%d t=%lu%s",
+                fsm.stateName(fsm.state()), modeName(currentMode), sensors.tempFront(), sensors.tempBack(),
+                currentSetpoint(), heater.dutyFrontPct(), heater.dutyBackPct(), fan.dutyPct(),
+                HEAT_NAMES[fsm.in(ST_RUN) ? heatActive : heatSelection], selectedProfile, constTemp, constDuration,
+                fsm.in(ST_RUN) ? (unsigned long)(clockMs() - runStartTime) / 1000 : 0UL,
+                fsm.state() == ST_FAULT ? " fault" : "");
+}
+
+void cmdProfiles(uint8_t, char**) {
+    for (uint8_t i = 0; i < profileLib.count(); i++) commands.info("%u %s", i, profileLib.name(i));
+    commands.ok("%u profiles%s", profileLib.count(), profileLib.fromFile() ? "" : " (built-in)");
+}
+
+bool selectProfile(const char* arg) {
+    long p;
+    if (!CommandParser::toInt(arg, 0, profileLib.count() - 1, p)) {
+        commands.err("profile 0..%d", profileLib.count() - 1);
+        return false;
     }
+    selectedProfile = p;
+    return true;
 }
 
-// ---- Main Control ----
-void runControl() {
-    if (profileRunning && !profileAborted) {
-        int currentSecond = (millis() - runStartTime) / 1000;
-        
-        bool finished = false;
-        float setpoint = profRunner.update(millis(), finished);
-        int elapsed = profRunner.elapsedSec(millis());
-        int remaining = profRunner.durationSec() - elapsed;
-        
-        if (finished) {
-            profileDone = true;
-            profileRunning = false;
-            heater.reset();
-            fan.set(true);
-            tone(BUZZER_PIN, 600, 2000);
-        } else {
-            float maxTemp = max(sensors.tempFront(), sensors.tempBack());
-            
-            // Detect cooling mode entry
-            if (setpoint < g_lastSetpoint - 0.5f) {
-                if (!g_inCoolingMode) {
-                    g_inCoolingMode = true;
-                    g_coolingResetDone = false;
-                    Serial.println("[CONTROL] Entering cooling mode");
-                }
-            }
-            
-            // Exit cooling mode when temp drops sufficiently
-            if (g_inCoolingMode && maxTemp < setpoint - 3.0f) {
-                g_inCoolingMode = false;
-                Serial.println("[CONTROL] Exiting cooling mode");
-            }
-            
-            g_lastSetpoint = setpoint;
-            
-            uint16_t coolingStart = profRunner.coolingStartSec();
-            bool inCoolingPhase = (currentSecond >= coolingStart);
-            
-            // Heater control
-            if (g_inCoolingMode && !g_coolingResetDone) {
-                heater.reset();
-                heater.setMaxOutput(0);
-                g_coolingResetDone = true;
-                Serial.println("[CONTROL] Heaters disabled for cooling");
-            } else if (!g_inCoolingMode) {
-                g_coolingResetDone = false;
-                
-                if (maxTemp > setpoint - 5.0f && !inCoolingPhase) {
-                    heater.setMaxOutput(50);
-                } else {
-                    heater.setMaxOutput(90);
-                }
-                
-                heater.control(heatActive, setpoint, sensors.tempFront(), sensors.tempBack());
-            }
-            
-        // Fan control
-if (!manualFanMode) {
-    if ((g_inCoolingMode && maxTemp > 80.0f) || (inCoolingPhase && maxTemp > setpoint + 2.0f)) {
-        fan.set(true);
-        Serial.println("[FAN] Cooling activated");
-    } else if (g_inCoolingMode && maxTemp > 60.0f) {
-        fan.set(true);
-        Serial.println("[FAN] Cooling mode - fan on");
-    } else if (maxTemp < 50.0f) {
-        fan.set(false);
-        Serial.println("[FAN] Cool enough - fan off");
+void cmdProfile(uint8_t, char** argv) {
+    if (cmdIdle() && selectProfile(argv[1])) commands.ok("%u %s", selectedProfile, profileLib.name(selectedProfile));
+}
+
+void cmdHeat(uint8_t, char** argv) {
+    if (!cmdIdle()) return;
+    for (uint8_t h = HEAT_BOTH; h <= HEAT_BACK; h++) {
+        if (strcmp(argv[1], HEAT_NAMES[h]) == 0) { heatSelection = (HeatState)h; commands.ok("%s", argv[1]); return; }
     }
+    commands.err("heat both|front|back");
 }
-            
-            // Safety override
-            if (maxTemp >= 80.0f && !fan.isOn() && !manualFanMode) {
-                fan.set(true);
-                Serial.println("[FAN] Safety override (>80C)");
-            }
+
+// Walk MENU -> setup screen -> run, as the clicks would
+bool startRun(uint8_t goEvent, uint8_t setupState, uint8_t runState) {
+    if (fsm.state() != ST_MENU && fsm.state() != setupState) fsm.dispatch(EV_ABORT);
+    if (fsm.state() == ST_MENU) fsm.dispatch(goEvent);
+    for (uint8_t i = 0; i < 4 && fsm.state() == setupState; i++) fsm.dispatch(EV_CLICK);   // through its fields
+    if (!fsm.in(runState)) { commands.err("not started (state %s)", fsm.stateName(fsm.state())); return false; }
+    return true;
+}
+
+void cmdStart(uint8_t argc, char** argv) {
+    if (!cmdIdle() || (argc > 1 && !selectProfile(argv[1]))) return;
+    const Profile& prof = profileLib.get(selectedProfile);
+    if (profileLib.lastCheck().errors) {
+        commands.err("%s cannot run: %u error(s) against the plate limits", prof.name, profileLib.lastCheck().errors);
+        return;
+    }
+    if (startRun(EV_GO_PROFILE, ST_PROF_SETUP, ST_PROFILE))
+        commands.ok("%s %s", fsm.stateName(fsm.state()), profileLib.get(selectedProfile).name);
+}
+
+void cmdConst(uint8_t argc, char** argv) {
+    long t, secs = constDuration;
+    float ramp = constRampCps;
+    if (!CommandParser::toInt(argv[1], 0, 220, t) || (argc > 2 && !CommandParser::toInt(argv[2], 10, MAX_HOLD_SECS, secs)) ||
+        (argc > 3 && !CommandParser::toFloat(argv[3], 0.0f, 5.0f, ramp))) {
+        commands.err("const 0..220 [10..36000 s] [0..5 C/s]");
+        return;
+    }
+    // A running constant run ramps to the new target; the hold counts from there
+    if (!fsm.in(ST_CONST) && !cmdIdle()) return;
+    constDuration = secs;
+    constRampCps = ramp;
+    if (fsm.in(ST_CONST)) {
+        uint32_t now = clockMs();
+        if (t != constTemp) constRunner.retarget(t, ramp, now);
+        constTemp = t;
+        constRunner.setHoldSec(secs);
+        commands.ok("%s %dC, %us left", fsm.stateName(fsm.state()), constTemp, constRunner.remainingSec(now));
+        return;
+    }
+    constTemp = t;
+    if (startRun(EV_GO_CONST, ST_CONST_SETUP, ST_CONST))
+        commands.ok("%s %dC for %ds, ramp %.1f C/s", fsm.stateName(fsm.state()), constTemp, constDuration, constRampCps);
+}
+
+void cmdAbort(uint8_t, char**) {
+    fsm.dispatch(EV_ABORT);
+    if (fsm.state() == ST_FAULT) commands.err("fault: %s", g_faultReason);
+    else                         commands.ok("%s", fsm.stateName(fsm.state()));
+}
+
+void cmdGains(uint8_t argc, char** argv) {
+    if (argc == 2 && strcmp(argv[1], "default") == 0) {
+        g_remoteGainsSet = false;
+    } else if (argc >= 4) {
+        PIDGains g = heater.gains();
+        if (!CommandParser::toFloat(argv[1], 0.0f, 1000.0f, g.P) || !CommandParser::toFloat(argv[2], 0.0f, 100.0f, g.I) ||
+            !CommandParser::toFloat(argv[3], 0.0f, 10000.0f, g.D) ||
+            (argc > 4 && !CommandParser::toFloat(argv[4], 0.0f, 1000.0f, g.iMax))) {
+            commands.err("gains P I D [iMax], or gains default");
+            return;
         }
-        
-        // Update profile display with condensed graph + data
-        ui.showProfileRun(PROFILES[selectedProfile], setpoint, 
-                          sensors.tempFront(), sensors.tempBack(),
-                          heater.dutyFrontPct(), heater.dutyBackPct(),
-                          elapsed, remaining, profileDone, profileAborted);
+        g_remoteGains = g;
+        g_remoteGainsSet = true;
+        if (fsm.in(ST_RUN)) heater.setGains(g);   // takes effect now, and for later runs
+    } else if (argc != 1) {
+        commands.err("gains P I D [iMax], or gains default");
+        return;
     }
-    
-    if (constRunning && !profileAborted) {
-        int currentSecond = (millis() - runStartTime) / 1000;
-        
-        if (currentSecond >= constDuration) {
-            profileDone = true;
-            constRunning = false;
-            heater.reset();
-            fan.set(true);
-            tone(BUZZER_PIN, 600, 2000);
+    const PIDGains& g = g_remoteGainsSet ? g_remoteGains : heater.gains();
+    commands.ok("P=%.3f I=%.3f D=%.3f iMax=%.0f%s", g.P, g.I, g.D, g.iMax,
+                g_remoteGainsSet ? " (remote)" : " (per-run defaults)");
+}
+
+void applyCalibration() {
+    sensors.setFrontCal(g_calOffset[0]);
+    sensors.setBackCal(g_calOffset[1]);
+}
+
+void cmdCal(uint8_t argc, char** argv) {
+    if (argc == 3) {
+        float f, b;
+        if (!CommandParser::toFloat(argv[1], -200.0f, 200.0f, f) || !CommandParser::toFloat(argv[2], -200.0f, 200.0f, b)) {
+            commands.err("cal <front C> <back C>, -200..200");
+            return;
+        }
+        if (!cmdIdle()) return;
+        g_calOffset[0] = f;
+        g_calOffset[1] = b;
+        applyCalibration();
+    } else if (argc != 1) {
+        commands.err("cal [<front C> <back C>]");
+        return;
+    }
+    commands.ok("front=%.2f back=%.2f", sensors.frontOffset(), sensors.backOffset());
+}
+
+void cmdSettings(uint8_t argc, char** argv) {
+    if (argc > 1) {
+        if (strcmp(argv[1], "save") == 0) {
+            settings.flush();
+        } else if (strcmp(argv[1], "reset") == 0) {
+            if (!cmdIdle()) return;
+            settings.factoryReset();
+            applyCalibration();
         } else {
-            heater.control(heatActive, constTemp, sensors.tempFront(), sensors.tempBack());
-            float maxTemp = max(sensors.tempFront(), sensors.tempBack());
-            
-            if (currentSecond >= constDuration && maxTemp > constTemp + 2.0f) {
-                if (!fan.isOn() && !manualFanMode) {
-                    fan.set(true);
-                    Serial.println("[FAN] Constant mode cooling");
-                }
-            }
+            commands.err("settings [save|reset]");
+            return;
         }
-        
-        // Update constant display (uses simple layout)
-        int remaining = constDuration - currentSecond;
-        ui.showRun(constTemp, sensors.tempFront(), sensors.tempBack(),
-                   heater.dutyFrontPct(), heater.dutyBackPct(), CONST_RUN);
     }
-    
-    // Manual heater control for TEST_RUN mode
-    if (currentMode == TEST_RUN) {
-        // Use manual control by bypassing PID and directly setting a constant setpoint
-        float manualSetpoint = (float)testPct * 2.0f;  // Convert 0-100% to 0-200°C range
-        heater.control(heatSelection, manualSetpoint, sensors.tempFront(), sensors.tempBack());
+    char value[48];
+    for (uint8_t i = 0; i < settings.count(); i++) {
+        settings.format(i, value, sizeof(value));
+        commands.info("%-10s %s%s", settings.def(i).key, value,
+                      settings.dirty(i) ? " (unsaved)" : settings.stored(i) ? "" : " (default)");
     }
-    
-    if (currentMode == COOL_TEST) {
-        runCoolingTest();
+    commands.ok("v%u, %lu commits (%lu writes), %u pending%s%s", SETTINGS_VERSION, (unsigned long)settings.commits(),
+                (unsigned long)settings.writes(), settings.pending(), settings.failures() ? ", write failures" : "",
+                settings.writable() ? "" : ", read-only");
+}
+
+void cmdTelemetry(uint8_t argc, char** argv) {
+    long ms = 0;
+    bool on = strcmp(argv[1], "on") == 0;
+    if ((!on && strcmp(argv[1], "off") != 0) || (argc > 2 && !CommandParser::toInt(argv[2], 0, 60000, ms))) {
+        commands.err("telemetry on|off [interval ms]");
+        return;
     }
+    if (argc > 2) telemetry.setIntervalMs(ms);
+    telemetry.setEnabled(on);
+    commands.ok("telemetry %s", on ? "on" : "off");
+}
+
+void cmdHelp(uint8_t, char**) {
+    commands.help();
+}
+
+const CommandSpec STATION_COMMANDS[] = {
+    // name         min max  handler        usage
+    {"status",      0,  0,   cmdStatus,     "status"},
+    {"profiles",    0,  0,   cmdProfiles,   "profiles"},
+    {"profile",     1,  1,   cmdProfile,    "profile <n>"},
+    {"heat",        1,  1,   cmdHeat,       "heat both|front|back"},
+    {"start",       0,  1,   cmdStart,      "start [profile]"},
+    {"const",       1,  3,   cmdConst,      "const <C> [secs] [C/s]"},
+    {"abort",       0,  0,   cmdAbort,      "abort"},
+    {"gains",       0,  4,   cmdGains,      "gains [P I D [iMax] | default]"},
+    {"telemetry",   1,  2,   cmdTelemetry,  "telemetry on|off [ms]"},
+    {"cal",         0,  2,   cmdCal,        "cal [front back]"},
+    {"settings",    0,  1,   cmdSettings,   "settings [save|reset]"},
+    {"help",        0,  0,   cmdHelp,       "help"},
+};
+
+// ---- Main Control ----
+void runControl() {
+    tach.update(clockMs(), fan.dutyPct(), fanRpmAt(coolCtl.model(), fan.dutyPct()));
+    schedulePlant();
+    if (sensors.sensorFault() || fanFault()) fsm.dispatch(EV_FAULT);
+    fsm.dispatch(EV_TICK);
 }
 
 // ---- Display Update for Non-Running Modes ----
 void updateDisplay() {
-    if (!profileRunning && !constRunning) {
-        switch (currentMode) {
-            case MENU:
-                ui.showMenu(menuIndex, sensors.tempFront(), sensors.tempBack(), 
-                           heatSelection, manualFanMode, manualFanState);
-                break;
-                
-            case PROF_SETUP:
-                ui.showProfileSetup(PROFILES[selectedProfile], 2);
-                break;
-                
-            case CONST_SETUP:
-                ui.showConstantSetup(constTemp, constDuration);
-                break;
-                
-            case TEST_RUN:
-                ui.showTest(testPct, sensors.tempFront(), sensors.tempBack(), heatSelection);
-                break;
-                
-            case COOL_TEST:
-                ui.showCoolTest(sensors.tempFront(), sensors.tempBack());
-                break;
-                
-            default:
-                break;
+    // Run screens are drawn by the run tick, DONE draws once on entry
+    if (fsm.in(ST_RUN) || fsm.state() == ST_DONE) return;
+
+    switch (currentMode) {
+        case MENU:
+            ui.showMenu(menuIndex, sensors.tempFront(), sensors.tempBack(),
+                       heatSelection, manualFanMode, manualFanState,
+                       tach.present() ? (int)tach.rpm() : -1, tach.health() >= FanTach::TACH_DEGRADED);
+            break;
+
+        case PROF_SETUP:
+            ui.showProfileSetup(profileLib.get(selectedProfile), 2);
+            break;
+
+        case CONST_SETUP:
+            ui.showConstantSetup(constTemp, constRampCps, constDuration, constField);
+            break;
+
+        case TEST_RUN:
+            ui.showTest(testPct, sensors.tempFront(), sensors.tempBack(), heatSelection);
+            break;
+
+        case COOL_TEST:
+            ui.showCoolTest(sensors.tempFront(), sensors.tempBack());
+            break;
+
+#ifdef LOOP_PROFILING
+        case DIAG:
+            ui.showDiagnostics(loopProfiler, diagView);
+            break;
+#endif
+
+        case CHARACTERIZE: {
+            static const char* plates[] = {"Front", "Back", "-"};
+            ui.showCharacterize(plates[min(g_plantChar.plate(), (uint8_t)2)],
+                                PlantCharacterizer::phaseName(g_plantChar.phase()),
+                                max(g_plantChar.dutyFront(), g_plantChar.dutyBack()),
+                                g_plantChar.phaseSecs(clockMs()),
+                                sensors.tempFront(), sensors.tempBack());
+            break;
         }
+
+        case FAULT:
+            ui.showFault(faultCleared(), sensors.tempFront(), sensors.tempBack(), g_faultReason);
+            break;
+
+        default:
+            break;
+    }
+}
+
+#ifdef REFLOW_REPLAY
+// ---- Replay Harness ----
+// Feeds the recorded thermProf trace through SensorManager on a virtual
+// clock and runs the real runControl() logic, printing one CSV line per
+// simulated second. test/test_replay/golden.csv is the accepted log;
+// with -DREPLAY_GOLDEN_CRC=0x... the run checks its own log checksum and
+// prints REPLAY PASS / FAIL ([env:replay] on the board, [env:native-replay]
+// on the host).
+// -DREPLAY_PLANT closes the loop instead: each plate is a SimulatedSensor
+// integrating the plant model from the heater duty, and the end line
+// reports how far the plates overshot the setpoint. -DREPLAY_PLANT_TAU /
+// -DREPLAY_PLANT_DEAD give the plates a slower thermocouple and a heater
+// delay; -DREPLAY_INTERP=1/2 forces linear / monotone-cubic setpoints for
+// A/B comparisons.
+#ifndef REPLAY_PROFILE
+#define REPLAY_PROFILE   1       // "Lead 200C" matches the trace peak
+#endif
+#ifndef REPLAY_SAMPLE_MS
+#define REPLAY_SAMPLE_MS 250     // trace sample spacing
+#endif
+#define REPLAY_TICK_MS   100     // one simulated loop()
+
+uint32_t g_virtualMs = 1000;     // ProfileRunner treats 0 as "not started"
+ReplaySensor replayFront(REPLAY_SAMPLE_MS, 0.0f);
+ReplaySensor replayBack(REPLAY_SAMPLE_MS, -1.5f);
+#ifdef REPLAY_PLANT
+SimulatedSensor simFront, simBack;
+#ifndef REPLAY_PLANT_GAIN
+#define REPLAY_PLANT_GAIN 2.0f   // °C/s at full duty, as PlateEstimator assumes
+#endif
+#ifndef REPLAY_PLANT_TAU
+#define REPLAY_PLANT_TAU 4.0f    // s of sensor lag, as PlateEstimator assumes
+#endif
+#ifndef REPLAY_PLANT_DEAD
+#define REPLAY_PLANT_DEAD 0.0f   // s before the duty reaches the plate
+#endif
+float  g_simPlantGain = REPLAY_PLANT_GAIN;   // front plate; set before setup() to override
+float  g_simSensorTau = REPLAY_PLANT_TAU;    // both plates; the estimator still assumes 4 s
+float  g_simDeadSecs = REPLAY_PLANT_DEAD;    // both plates
+float  g_simPeak[2] = {0, 0};      // hottest plate surface before cooling
+float  g_simOver[2] = {0, 0};      // plate above a rising / flat setpoint
+double g_simErr2[2] = {0, 0};      // squared tracking error sum
+uint32_t g_simErrN = 0;
+double g_simCoolErr2 = 0;          // hottest plate vs a falling setpoint
+uint32_t g_simCoolN = 0;
+#endif
+uint32_t g_replayCrc = 0xFFFFFFFFUL;
+uint32_t g_replayLines = 0;
+uint32_t g_replayLastLog = 0;
+bool g_replayDone = false;
+
+void replayLog(const char* line) {
+    Serial.println(line);
+    for (const char* p = line; *p; p++) {
+        g_replayCrc ^= (uint8_t)*p;
+        for (int k = 0; k < 8; k++)
+            g_replayCrc = (g_replayCrc >> 1) ^ (0xEDB88320UL & (0 - (g_replayCrc & 1)));
+    }
+    g_replayLines++;
+}
+
+void replaySetup() {
+    Serial.begin(115200);
+    delay(500);
+    Serial.println("=== REPLAY ===");
+    logger.setRateLimit("FAN", 2000);
+    logger.begin(Serial);
+
+    fan.begin(FAN_PIN, board.fanActiveLow, board.fanPwmHz, board.fanPwmBits, board.fanLedcChannel);
+    ui.begin(I2C_SDA, I2C_SCL);
+    ui.setOutputEnabled(false);
+#ifdef REPLAY_PLANT
+#ifdef PLANT_SYSID
+    simFront.setPlant(SYSID_PLANT_FRONT, 25.0f);    // plates fitted from a recorded run
+    simBack.setPlant(SYSID_PLANT_BACK, 25.0f);
+#else
+    simFront.setPlant(PlantParams{g_simPlantGain, 0.0017f, g_simSensorTau, 25.0f}, 25.0f);
+    simBack.setPlant(PlantParams{g_simPlantGain * 0.9f, 0.0019f, g_simSensorTau, 25.0f}, 25.0f);   // a slightly weaker plate
+#endif
+    simFront.setDeadSecs(g_simDeadSecs);
+    simBack.setDeadSecs(g_simDeadSecs);
+    simFront.setPeriod(REPLAY_SAMPLE_MS);
+    simBack.setPeriod(REPLAY_SAMPLE_MS);
+    sensors.begin(simFront, simBack);
+#else
+    sensors.begin(replayFront, replayBack);
+#endif
+    sensors.update();
+    heater.begin(SSR_FRONT, SSR_BACK, board.ssrWindowMs);
+#ifdef REPLAY_INTERP
+    profRunner.setInterp((ProfileRunner::Interp)REPLAY_INTERP);
+#endif
+
+    stationBegin();
+    selectedProfile = REPLAY_PROFILE;
+    heatSelection = HEAT_BOTH;
+    fsm.dispatch(EV_GO_PROFILE);
+    fsm.dispatch(EV_CLICK);
+    replayLog("t_s,mode,sp,tF,tB,dutyF,dutyB,fan,cooling,done");
+}
+
+void replayLoop() {
+    if (g_replayDone) { delay(1000); return; }
+
+    clockAdvance(REPLAY_TICK_MS);
+#ifdef REPLAY_PLANT
+    simFront.setDuty(heater.dutyFrontPct());
+    simBack.setDuty(heater.dutyBackPct());
+    float fanLoss = fanLossAt(DEFAULT_FAN_MODEL, fan.dutyPct());
+#ifdef PLANT_SYSID
+    // default fan curve, scaled to the fitted loss at 100%
+    simFront.setFanLoss(fanLoss * SYSID_FAN_LOSS_FRONT / DEFAULT_FAN_MODEL.fanLossCoef);
+    simBack.setFanLoss(fanLoss * SYSID_FAN_LOSS_BACK / DEFAULT_FAN_MODEL.fanLossCoef);
+#else
+    simFront.setFanLoss(fanLoss);
+    simBack.setFanLoss(fanLoss);
+#endif
+#endif
+    sensors.setHeaterDuty(heater.dutyFrontPct(), heater.dutyBackPct());
+    sensors.update();
+    runControl();
+#ifdef REPLAY_PLANT
+    if (fsm.in(ST_PROFILE) && !g_profCtl.coolingMode) {
+        float plate[2] = {simFront.plateC(), simBack.plateC()};
+        // the run starts with the setpoint below room temp; skip that
+        bool tracking = g_profCtl.lastSetpoint > 30.0f;
+        for (int i = 0; i < 2; i++) {
+            float e = plate[i] - g_profCtl.lastSetpoint;
+            if (tracking) g_simErr2[i] += e * e;
+            if (tracking && !profRunner.falling()) g_simOver[i] = max(g_simOver[i], e);
+            g_simPeak[i] = max(g_simPeak[i], plate[i]);
+        }
+        if (tracking) g_simErrN++;
+    }
+    if (fsm.in(ST_PROFILE) && profRunner.falling() && g_profCtl.lastSetpoint > 50.0f) {
+        float e = max(simFront.plateC(), simBack.plateC()) - g_profCtl.lastSetpoint;
+        g_simCoolErr2 += e * e;
+        g_simCoolN++;
+    }
+#endif
+
+    if (clockMs() - g_replayLastLog >= 1000) {
+        g_replayLastLog = clockMs();
+        char line[96];
+        snprintf(line, sizeof(line), "%lu,%d,%.1f,%.1f,%.1f,%d,%d,%d,%d,%d",
+                 (unsigned long)((clockMs() - runStartTime) / 1000), (int)currentMode,
+                 g_profCtl.lastSetpoint, sensors.tempFront(), sensors.tempBack(),
+                 heater.dutyFrontPct(), heater.dutyBackPct(),
+                 fan.isOn(), g_profCtl.coolingMode, fsm.state() == ST_DONE);
+        replayLog(line);
+    }
+
+#ifdef REPLAY_PLANT
+    bool traceOver = clockMs() - runStartTime > (profRunner.durationSec() + 900UL) * 1000UL;
+#else
+    bool traceOver = replayFront.finished();
+#endif
+    if (fsm.state() == ST_DONE || traceOver) {
+        g_replayDone = true;
+        uint32_t crc = ~g_replayCrc;
+        Serial.printf("=== REPLAY END lines=%lu crc=0x%08lX ===\n",
+                      (unsigned long)g_replayLines, (unsigned long)crc);
+#ifdef REPLAY_PLANT
+        // Peak = hottest plate vs the profile's peak target (negative: never got there)
+        const Profile& prof = profileLib.get(selectedProfile);
+        int peakC = 0;
+        for (uint8_t s = 0; s < prof.slotCount; s++) peakC = max(peakC, (int)prof.slots[s].targetTempC);
+        double n = g_simErrN ? g_simErrN : 1;
+        Serial.printf("=== SIM %s %s: peak F=%+.1f B=%+.1f C vs %d, over setpoint F=%.1f B=%.1f C, rms err F=%.1f B=%.1f C ===\n",
+                      prof.name, profRunner.smooth() ? "cubic" : "linear",
+                      g_simPeak[0] - peakC, g_simPeak[1] - peakC, peakC,
+                      g_simOver[0], g_simOver[1],
+                      sqrt(g_simErr2[0] / n), sqrt(g_simErr2[1] / n));
+        Serial.printf("=== SIM cooling rms err %.1f C ===\n", sqrt(g_simCoolErr2 / (g_simCoolN ? g_simCoolN : 1)));
+#endif
+#ifdef REPLAY_GOLDEN_CRC
+        Serial.println(crc == (uint32_t)REPLAY_GOLDEN_CRC ? "REPLAY PASS" : "REPLAY FAIL");
+#endif
     }
 }
+#endif
 
 // ---- Setup & Loop ----
 void setup() {
+#ifdef REFLOW_REPLAY
+    replaySetup();
+    return;
+#endif
+#ifdef REFLOW_BENCH
+    Serial.begin(115200);
+    delay(1500);
+    pinMode(SSR_FRONT, OUTPUT); digitalWrite(SSR_FRONT, LOW);
+    pinMode(SSR_BACK, OUTPUT);  digitalWrite(SSR_BACK, LOW);
+    ui.begin(I2C_SDA, I2C_SCL);
+    Bench::run(ui);
+    return;
+#endif
+#ifdef UI_CAPTURE
+    Serial.begin(115200);
+    delay(1500);
+    pinMode(SSR_FRONT, OUTPUT); digitalWrite(SSR_FRONT, LOW);
+    pinMode(SSR_BACK, OUTPUT);  digitalWrite(SSR_BACK, LOW);
+    ui.begin(I2C_SDA, I2C_SCL);
+    uiCaptureScenes(ui, Serial);
+    return;
+#endif
     Serial.begin(115200);
     delay(1500);
     Serial.println("Serial OK");
     Serial.println("Reflow Station Starting...");
+    Serial.printf("Board: %s\n", board.name);
     Serial.printf("ESP_ARDUINO_VERSION_MAJOR = %d\n", ESP_ARDUINO_VERSION_MAJOR);
+
+    // Saved tunables; holding the encoder button through boot restores the defaults
+    settings.begin(STATION_SETTINGS, sizeof(STATION_SETTINGS) / sizeof(STATION_SETTINGS[0]), SETTINGS_VERSION);
+    pinMode(ENC_BTN, INPUT_PULLUP);
+    if (digitalRead(ENC_BTN) == LOW) {
+        settings.factoryReset();
+        Serial.println("Button held - settings restored to defaults");
+        tone(BUZZER_PIN, 1500, 400);
+    }
+    clampSettings();
     
     // Initialize all modules
-    bool ok = fan.begin(FAN_PIN, true, 25000, 8);
+    bool ok = fan.begin(FAN_PIN, board.fanActiveLow, board.fanPwmHz, board.fanPwmBits, board.fanLedcChannel);
     Serial.printf("[FAN] begin ok=%d\n", ok);
 
-    // Fan sanity check: OFF -> ON -> OFF
+    // Fan sanity check: OFF -> ON -> OFF. The board says whether a tach is
+    // wired; a wired one that stays silent here is reported, and stalls
+    // once the fan is driven
+    tach.begin(TACH_PIN == PIN_NONE ? -1 : (int8_t)TACH_PIN);
     Serial.println("[FAN] sanity OFF-ON-OFF");
     fan.set(false); delay(400);
     fan.set(true);  delay(400);
     fan.set(false);
+    if (!tach.present())     Serial.println("[FAN] no tach on this board - stall detection off");
+    else if (tach.pulsed())  Serial.println("[FAN] tach pulses seen");
+    else                     Serial.println("[FAN] WARNING: tach wired but no pulses - check the fan");
 
     // Initialize display using DisplayUI
     ui.begin(I2C_SDA, I2C_SCL);
     
-    sensors.begin(THERM_FRONT, THERM_BACK);
-    // Add these lines in setup() after sensors.begin():
-    sensors.setFrontCal(-120);
-    sensors.setBackCal(-120);
+#if defined(SENSOR_MAX31855) || defined(SENSOR_MAX6675)
+    sensors.begin(tcFront, tcBack);
+#else
+    sensors.begin(THERM_FRONT, THERM_BACK, board.ntc);
+#endif
+    applyCalibration();
     // Let sensors stabilize
     for (int i = 0; i < 20; i++) {
         sensors.update();
         delay(50);
     }
     
+#if !defined(SENSOR_MAX31855) && !defined(SENSOR_MAX6675)
+    // Thermocouple amplifiers are cold-junction compensated; NTCs get a room-temp trim
+    // A saved `cal` wins; the trim itself is not saved
     float avgTemp = (sensors.tempFront() + sensors.tempBack()) / 2.0f;
-    if (avgTemp > 20.0f && avgTemp < 30.0f) {
+    if (settings.stored("cal")) {
+        Serial.printf("Saved calibration: front %.2f, back %.2f\n", g_calOffset[0], g_calOffset[1]);
+    } else if (avgTemp > 20.0f && avgTemp < 30.0f) {
         sensors.calibrateAtRoomTemp(23.5);
         Serial.println("Applied room temperature calibration");
     } else {
@@ -549,8 +1449,9 @@ void setup() {
         Serial.print(avgTemp);
         Serial.println("C");
     }
+#endif
     
-    heater.begin(SSR_FRONT, SSR_BACK, 1000);
+    heater.begin(SSR_FRONT, SSR_BACK, board.ssrWindowMs);
     encoder.begin(ENC_A, ENC_B, ENC_BTN);
     
     pinMode(BUZZER_PIN, OUTPUT);
@@ -578,13 +1479,68 @@ void setup() {
     }
     
     Serial.println("Initialization complete");
+
+    // Runtime messages go through the non-blocking logger from here on;
+    // fan decisions are re-evaluated every loop, so hold repeats
+    logger.setRateLimit("FAN", 2000);
+    logger.begin(Serial);
+    commands.begin(STATION_COMMANDS, sizeof(STATION_COMMANDS) / sizeof(STATION_COMMANDS[0]));
+#ifdef REFLOW_WIFI
+    dashboard.begin();
+#endif
+    recorder.begin();
+    coolCtl.load();
+    tach.setSpinFloor(coolCtl.model().minSpinPct);
+#ifdef PLANT_SYSID
+    sensors.setPlantParams(SYSID_PLANT_FRONT, SYSID_PLANT_BACK);   // a /plant.mdl still wins
+#endif
+    plantModelValid = PlantCharacterizer::load(plantModel);
+    applyPlantModel();
+    profileLib.begin();
+    if (selectedProfile >= profileLib.count()) selectedProfile = 0;   // saved index, profile file changed
+    stationBegin();
+#ifdef TELEMETRY_ON_BOOT
+    telemetry.setEnabled(true);
+#endif
     ui.clear();
 }
 
 void loop() {
-    sensors.update();
-    handleEncoder();
-    runControl();
+#ifdef REFLOW_REPLAY
+    replayLoop();
+    return;
+#endif
+#if defined(REFLOW_BENCH) || defined(UI_CAPTURE)
+    delay(1000);
+    return;
+#endif
+    static uint16_t lastLoopUs = 0;
+    uint32_t loopStart = micros();
+    PROF_MODE(currentMode);
+    PROF_STAGE(STAGE_LOOP);
+
+    {
+        PROF_STAGE(STAGE_SENSORS);
+        sensors.setHeaterDuty(heater.dutyFrontPct(), heater.dutyBackPct());
+        sensors.update();
+    }
+    {
+        PROF_STAGE(STAGE_ENCODER);
+        handleEncoder();
+        commands.poll(Serial);
+#ifdef REFLOW_WIFI
+        char line[WebDashboard::CMD_MAX];
+        while (dashboard.nextCommand(line, sizeof(line))) {
+            LOGI("WEB", "Command: %s", line);
+            commands.execute(line);
+        }
+        dashboard.poll();
+#endif
+    }
+    {
+        PROF_STAGE(STAGE_CONTROL);
+        runControl();
+    }
     
     // Auto-cooling for hot plates in menu mode
     if (currentMode == MENU && !manualFanMode) {
@@ -597,7 +1553,17 @@ void loop() {
     // Update display for non-running modes only
     static unsigned long lastDisplayUpdate = 0;
     if (millis() - lastDisplayUpdate > 100) {
+        PROF_STAGE(STAGE_DISPLAY);
         updateDisplay();
         lastDisplayUpdate = millis();
     }
+
+    {
+        PROF_STAGE(STAGE_LOGGING);
+        recordSample();
+        sendTelemetry(lastLoopUs);
+        settings.poll(clockMs());
+    }
+    uint32_t loopUs = micros() - loopStart;
+    lastLoopUs = loopUs > 0xFFFF ? 0xFFFF : loopUs;
 }
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+#include "TempSensor.h"
+#include "thermProf.h"
+
+// Plays the recorded thermProf trace back as a sensor, one sample every
+// periodMs of (virtual) time. offsetC shifts the trace so front and back
+// can differ. Holds the last sample once the trace is exhausted.
+class ReplaySensor : public TempSensor {
+public:
+  ReplaySensor(uint16_t periodMs, float offsetC = 0.0f) : periodMs_(periodMs), offsetC_(offsetC) {}
+
+  bool begin() override { reader_.rewind(); nextMs_ = 0; done_ = false; return true; }
+  bool poll(uint32_t nowMs) override {
+    if (done_ || (nextMs_ && (int32_t)(nowMs - nextMs_) < 0)) return false;
+    nextMs_ = (nextMs_ ? nextMs_ : nowMs) + periodMs_;
+    float t;
+    if (!reader_.next(t)) { done_ = true; return false; }
+    raw_ = (uint16_t)(t * 10.0f);
+    return accept_(t + offsetC_);
+  }
+  const char* name() const override { return "REPLAY"; }
+
+  bool finished() const { return done_; }
+
+private:
+  ThermProfReader reader_;
+  uint16_t periodMs_;
+  float    offsetC_;
+  uint32_t nextMs_ = 0;
+  bool     done_ = false;
+};
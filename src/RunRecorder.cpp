@@ -0,0 +1,138 @@
+// RunRecorder.cpp
+#include "RunRecorder.h"
+#include "Telemetry.h"
+#include "Log.h"
+#include <LittleFS.h>
+
+RunRecorder recorder;
+
+static uint32_t runNumber_(const char* name) {
+  // accepts "run_00012.rec" with or without the directory
+  const char* p = strrchr(name, '/');
+  p = p ? p + 1 : name;
+  if (strncmp(p, "run_", 4) != 0) return 0;
+  return strtoul(p + 4, nullptr, 10);
+}
+
+bool RunRecorder::begin() {
+  mounted_ = LittleFS.begin(true);   // format on first use
+  if (!mounted_) { LOGE("REC", "LittleFS mount failed"); return false; }
+  if (!LittleFS.exists("/runs")) LittleFS.mkdir("/runs");
+
+  File dir = LittleFS.open("/runs");
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+    uint32_t n = runNumber_(f.name());
+    if (n > lastSeq_) lastSeq_ = n;
+  }
+  LOGI("REC", "LittleFS %u/%u bytes used, last run %lu",
+       (unsigned)LittleFS.usedBytes(), (unsigned)LittleFS.totalBytes(), (unsigned long)lastSeq_);
+  return true;
+}
+
+// Drop the oldest runs so at most MAX_RUNS remain after the next one.
+// Gives up (keeping the extra runs) if a file cannot be removed.
+void RunRecorder::rotate_() {
+  for (;;) {
+    uint32_t oldest = 0, count = 0;
+    File dir = LittleFS.open("/runs");
+    for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+      uint32_t n = runNumber_(f.name());
+      if (!n) continue;
+      count++;
+      if (!oldest || n < oldest) oldest = n;
+    }
+    dir.close();
+    if (count < MAX_RUNS) return;
+    char p[32];
+    snprintf(p, sizeof(p), "/runs/run_%05lu.rec", (unsigned long)oldest);
+    if (!LittleFS.remove(p)) {
+      LOGE("REC", "cannot remove %s, %lu runs kept", p, (unsigned long)count);
+      return;
+    }
+  }
+}
+
+bool RunRecorder::startRun(RunHeader& h) {
+  if (!mounted_) return false;
+  if (active_) endRun();
+  rotate_();
+
+  memcpy(h.magic, "RRUN", 4);
+  h.version = VERSION;
+  h.seq = ++lastSeq_;
+  periodMs_ = h.periodMs ? h.periodMs : 1000;
+
+  snprintf(path_, sizeof(path_), "/runs/run_%05lu.rec", (unsigned long)h.seq);
+  File f = LittleFS.open(path_, "w");
+  if (!f) { LOGE("REC", "cannot create %s", path_); return false; }
+  f.write((const uint8_t*)&h, sizeof(h));
+  f.close();
+
+  len_ = 0; count_ = 0; prev_ = {};
+  lastSampleMs_ = 0;
+  active_ = true;
+  LOGI("REC", "Recording %s", path_);
+  return true;
+}
+
+void RunRecorder::putVarint_(int32_t v) {
+  uint32_t z = ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);   // zigzag
+  do {
+    uint8_t b = z & 0x7F;
+    z >>= 7;
+    buf_[len_++] = z ? (b | 0x80) : b;
+  } while (z);
+}
+
+void RunRecorder::sample(uint32_t nowMs, float tF, float tB, float sp,
+                         int dutyF, int dutyB, int fanPct, uint8_t flags) {
+  if (!active_) return;
+  if (lastSampleMs_ && nowMs - lastSampleMs_ < periodMs_) return;
+
+  RunSample s;
+  s.dtDs       = lastSampleMs_ ? (int32_t)((nowMs - lastSampleMs_ + 50) / 100) : 0;
+  s.tFrontDc   = lroundf(tF * 10.0f);
+  s.tBackDc    = lroundf(tB * 10.0f);
+  s.setpointDc = lroundf(sp * 10.0f);
+  s.dutyFront  = dutyF;
+  s.dutyBack   = dutyB;
+  s.fanPct     = fanPct;
+  s.flags      = flags;
+  lastSampleMs_ = nowMs ? nowMs : 1;
+
+  // Worst case 8 fields x 5 bytes; start a new chunk if it might not fit
+  if (len_ + 40 > CHUNK_MAX) flush_();
+
+  const int32_t* cur = &s.dtDs;
+  const int32_t* old = &prev_.dtDs;
+  const int n = sizeof(RunSample) / sizeof(int32_t);
+  for (int i = 0; i < n; i++) {
+    putVarint_(count_ == 0 ? cur[i] : cur[i] - old[i]);   // keyframe per chunk
+  }
+  prev_ = s;
+  count_++;
+}
+
+void RunRecorder::flush_() {
+  if (!count_) return;
+  File f = LittleFS.open(path_, "a");
+  if (f) {
+    uint16_t hdr[3] = { CHUNK_MAGIC, len_, count_ };
+    uint16_t crc = Telemetry::crc16(buf_, len_);
+    f.write((const uint8_t*)hdr, sizeof(hdr));
+    f.write(buf_, len_);
+    f.write((const uint8_t*)&crc, sizeof(crc));
+    f.close();
+    flushes_++;
+  } else {
+    LOGW("REC", "append failed, %u samples lost", count_);
+  }
+  len_ = 0; count_ = 0;
+}
+
+void RunRecorder::endRun() {
+  if (!active_) return;
+  flush_();
+  active_ = false;
+  LOGI("REC", "Closed %s", path_);
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <Arduino.h>
+#include "Types.h"
+
+// On-device run log in LittleFS: /runs/run_NNNNN.rec, newest MAX_RUNS kept.
+//
+// File = RunHeader, then self-contained chunks:
+//   uint16 CHUNK_MAGIC, uint16 payload bytes, uint16 sample count,
+//   payload, uint16 CRC-16/CCITT-FALSE over the payload.
+// Payload = first sample absolute, the rest as deltas to the previous one;
+// every field is a zigzag varint. A chunk is buffered in RAM and appended
+// in one write (~every 60-100 s at 1 Hz), so flash wear and write stalls
+// stay bounded and a power cut loses at most the unwritten chunk.
+// tools/run_reader.py decodes the format.
+struct __attribute__((packed)) RunHeader {
+  char     magic[4];       // "RRUN"
+  uint8_t  version;
+  uint8_t  kind;           // RunKind
+  uint16_t periodMs;       // nominal sample spacing
+  uint32_t seq;            // file number
+  char     name[16];       // profile name or "Constant"
+  int16_t  constTempC;
+  PIDGains gains;
+  float    calOffsetF, calScaleF;
+  float    calOffsetB, calScaleB;
+};
+
+// Fields per sample, in payload order
+struct RunSample {
+  int32_t dtDs;            // time since previous sample, 0.1 s
+  int32_t tFrontDc;        // 0.1 °C
+  int32_t tBackDc;
+  int32_t setpointDc;
+  int32_t dutyFront;       // %
+  int32_t dutyBack;
+  int32_t fanPct;
+  int32_t flags;           // TLM_* bits
+};
+
+enum RunKind : uint8_t { RUN_PROFILE = 1, RUN_CONSTANT = 2, RUN_CHARACTERIZE = 3 };
+
+class RunRecorder {
+public:
+  static constexpr uint8_t  VERSION     = 1;
+  static constexpr uint16_t CHUNK_MAGIC = 0xC7A5;
+  static constexpr uint8_t  MAX_RUNS    = 10;
+
+  bool begin();   // mount LittleFS, find the newest run number
+
+  // header.magic/version/seq are filled in here
+  bool startRun(RunHeader& h);
+  // Rate-limited to periodMs; call every loop while a run is active
+  void sample(uint32_t nowMs, float tF, float tB, float sp,
+              int dutyF, int dutyB, int fanPct, uint8_t flags);
+  void endRun();
+
+  bool     active()   const { return active_; }
+  uint32_t lastSeq()  const { return lastSeq_; }
+  uint32_t flushes()  const { return flushes_; }
+
+private:
+  static constexpr uint16_t CHUNK_MAX = 480;
+
+  bool      mounted_ = false;
+  bool      active_ = false;
+  uint32_t  lastSeq_ = 0;
+  uint16_t  periodMs_ = 1000;
+  uint32_t  lastSampleMs_ = 0;
+  char      path_[32];
+
+  uint8_t   buf_[CHUNK_MAX];
+  uint16_t  len_ = 0;
+  uint16_t  count_ = 0;
+  RunSample prev_ = {};
+  uint32_t  flushes_ = 0;
+
+  void flush_();
+  void rotate_();
+  void putVarint_(int32_t v);
+};
+
+extern RunRecorder recorder;
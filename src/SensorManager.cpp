@@ -1,110 +1,93 @@
 #include "SensorManager.h"
+#include "Clock.h"
 
 void SensorManager::setFrontCal(float offsetC, float scale) {
-  frontOffset_ = offsetC; frontScale_ = scale;
+  F_.offset = offsetC; F_.scale = scale;
 }
 
 void SensorManager::setBackCal(float offsetC, float scale) {
-  backOffset_ = offsetC;  backScale_  = scale;
+  B_.offset = offsetC; B_.scale = scale;
 }
 
-void SensorManager::begin(uint8_t f, uint8_t b, float vref) {
-  pF_ = f;  pB_ = b;  vref_ = vref;
-
-  pinMode(pF_, INPUT);
-  pinMode(pB_, INPUT);
-
-  // 3.3V range (needed because at high temp the node approaches Vref)
-  analogSetPinAttenuation(pF_, ADC_11db);
-  analogSetPinAttenuation(pB_, ADC_11db);
-  analogReadResolution(12); // 0..4095
-
-  Serial.println("SensorManager: 100k/3950 NTC with 6.8k pull-DOWN (to GND)");
-  Serial.printf("Front pin=%d  Back pin=%d  Vref=%.3fV\n", pF_, pB_, vref_);
+void SensorManager::setPlantParams(const PlantParams& front, const PlantParams& back) {
+  F_.est.setParams(front);
+  B_.est.setParams(back);
 }
 
-/**
- * Correct divider for YOUR wiring:
- * 3V3 ── NTC ──●── 6.8k ── GND, ADC at ●
- * Vnode = Vref * (Rseries / (Rseries + Rntc))
- * => Rntc = Rseries * (Vref - Vnode) / Vnode
- */
-float SensorManager::adcToTemp_(float adc) {
-  // ADC → Voltage
-  float v = (adc / ADC_MAX) * vref_;
-  // Avoid divide-by-zero / log(<=0)
-  if (v < 0.0005f) v = 0.0005f;
-  if (v > vref_ - 0.0005f) v = vref_ - 0.0005f;
-
-  // Compute NTC resistance for pull-DOWN wiring (6.8k to GND)
-  float rntc = SERIES_RESISTOR * (vref_ - v) / v;
-
-  // Beta equation
-  float invT = (1.0f / (TEMPERATURE_NOMINAL + 273.15f))
-             + (log(rntc / THERMISTOR_NOMINAL) / BETA_COEFFICIENT);
-  float tempC = (1.0f / invT) - 273.15f;
-  return tempC;
+void SensorManager::setSpikeFilter(uint8_t window, float k) {
+  ntcF_.setSpikeFilter(window, k);
+  ntcB_.setSpikeFilter(window, k);
 }
 
-// Oversample + clamp + apply per-channel calibration
-float SensorManager::readThermC_(uint8_t pin, float lastStable) {
-  // Oversample for noise reduction
-  float sum = 0;
-  for (int i = 0; i < 32; i++) {
-    sum += analogRead(pin);
-    delayMicroseconds(80);
-  }
-  float adc = sum / 32.0f;
-
-  float t = adcToTemp_(adc);
-
-  // Basic sanity clamps (hold last good if nonsense)
-  if (!isfinite(t) || t < -40.0f || t > 350.0f) {
-    t = lastStable;
-  }
+void SensorManager::begin(uint8_t f, uint8_t b, const NtcParams& ntc) {
+  ntcF_.setPin(f, ntc);
+  ntcB_.setPin(b, ntc);
+  begin(ntcF_, ntcB_);
 
-  // Apply per-sensor calibration
-  if (pin == pF_) t = (t + frontOffset_) * frontScale_;
-  else            t = (t + backOffset_)  * backScale_;
+  Serial.printf("SensorManager: %.0fk/%.0f NTC with %.1fk pull-DOWN (to GND)\n",
+                ntc.nominalOhm / 1000.0f, ntc.beta, ntc.seriesOhm / 1000.0f);
+  Serial.printf("Front pin=%d  Back pin=%d  Vref=%.3fV\n", f, b, ntc.vref);
+}
 
-  return t;
+void SensorManager::begin(TempSensor& front, TempSensor& back) {
+  F_.src = &front;  B_.src = &back;
+  F_.init = false;  B_.init = false;
+  bool okF = front.begin();
+  bool okB = back.begin();
+  Serial.printf("SensorManager: front=%s(%d) back=%s(%d)\n",
+                front.name(), okF, back.name(), okB);
 }
 
 void SensorManager::calibrateAtRoomTemp(float roomTempC) {
   Serial.println("=== Room-temp calibration ===");
-  long sumF = 0, sumB = 0;
+  float sumF = 0, sumB = 0;
   const int N = 32;
   for (int i = 0; i < N; i++) {
-    sumF += analogRead(pF_);
-    sumB += analogRead(pB_);
+    F_.src->poll(millis());
+    B_.src->poll(millis());
+    sumF += F_.src->tempC();
+    sumB += B_.src->tempC();
     delay(10);
   }
-  float avgF = sumF / float(N);
-  float avgB = sumB / float(N);
+  float tF_now = sumF / N;
+  float tB_now = sumB / N;
 
-  float tF_now = adcToTemp_(avgF);
-  float tB_now = adcToTemp_(avgB);
-
-  frontOffset_ = roomTempC - tF_now;
-  backOffset_  = roomTempC - tB_now;
+  F_.offset = roomTempC - tF_now;
+  B_.offset = roomTempC - tB_now;
 
   Serial.printf("Target %.1fC  Front raw %.1fC  Back raw %.1fC\n",
                 roomTempC, tF_now, tB_now);
   Serial.printf("Applied offsets: front %.2fC  back %.2fC\n",
-                frontOffset_, backOffset_);
+                F_.offset, B_.offset);
 }
 
-void SensorManager::update() {
-  static bool init = false;
+// Only channels whose backend produced a fresh reading are advanced, so
+// slow converters simply update the filters less often.
+void SensorManager::updateChannel_(Channel& c, uint32_t now) {
+  if (!c.src || !c.src->poll(now)) return;
 
-  // Read instantaneous temps (use last filtered as fallback if needed)
-  float f = readThermC_(pF_, tF_);
-  float b = readThermC_(pB_, tB_);
+  // Apply per-sensor calibration (backend holds last good on nonsense)
+  float t = (c.src->tempC() + c.offset) * c.scale;
 
-  if (!init) { tF_ = f; tB_ = b; init = true; }
+  if (!c.init) {
+    c.t = t; c.init = true;
+    c.lastMs = now;
+    c.est.begin(c.est.params(), t);
+    return;
+  }
 
   // EMA smoothing — responsive but stable for reflow ramps
   const float alpha = 0.15f;           // ~7-sample time constant
-  tF_ = alpha * f + (1 - alpha) * tF_;
-  tB_ = alpha * b + (1 - alpha) * tB_;
+  c.t = alpha * t + (1 - alpha) * c.t;
+
+  // Observers see the unsmoothed reading; they do their own filtering
+  float dt = (now - c.lastMs) / 1000.0f;
+  c.lastMs = now;
+  c.est.update(t, c.duty, dt);
+}
+
+void SensorManager::update() {
+  uint32_t now = clockMs();
+  updateChannel_(F_, now);
+  updateChannel_(B_, now);
 }
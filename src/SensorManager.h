@@ -1,43 +1,67 @@
 #pragma once
 #include <Arduino.h>
+#include "TempSensor.h"
+#include "NtcSensor.h"
+#include "PlateEstimator.h"
 
 class SensorManager {
 public:
-  void begin(uint8_t thermFrontPin, uint8_t thermBackPin, float vref = 3.30f);
+  // Default wiring: two NTC dividers on ADC pins
+  void begin(uint8_t thermFrontPin, uint8_t thermBackPin, const NtcParams& ntc = NTC_100K_3950_6K8);
+  // Any backend (thermocouple amplifier, simulated source, ...)
+  void begin(TempSensor& front, TempSensor& back);
   void update();                          // call every loop
 
-  float tempFront() const { return tF_; }
-  float tempBack()  const { return tB_;  }
+  float tempFront() const { return F_.t; }
+  float tempBack()  const { return B_.t; }
+
+  // Raw backend codes (ADC counts for the NTCs)
+  uint16_t rawFront() const { return F_.src ? F_.src->raw() : 0; }
+  uint16_t rawBack()  const { return B_.src ? B_.src->raw() : 0; }
+  bool     sensorFault() const { return (F_.src && F_.src->fault()) || (B_.src && B_.src->fault()); }
+
+  // Model-based estimates of the plate surface (less lag than the EMA)
+  float estFront()  const { return F_.est.tempC(); }
+  float estBack()   const { return B_.est.tempC(); }
+  float rateFront() const { return F_.est.rateCps(); }   // °C/s
+  float rateBack()  const { return B_.est.rateCps(); }
+
+  // Heater duty applied since the last update (feeds the estimators)
+  void setHeaterDuty(int frontPct, int backPct) { F_.duty = frontPct; B_.duty = backPct; }
+  void setPlantParams(const PlantParams& front, const PlantParams& back);
+  const PlantParams& plantFront() const { return F_.est.params(); }
+  const PlantParams& plantBack()  const { return B_.est.params(); }
 
   // Calibration (offset in °C, optional scale)
   void setFrontCal(float offsetC, float scale = 1.0f);
   void setBackCal (float offsetC, float scale = 1.0f);
+  float frontOffset() const { return F_.offset; }
+  float frontScale()  const { return F_.scale; }
+  float backOffset()  const { return B_.offset; }
+  float backScale()   const { return B_.scale; }
 
   // Quick one-point calibration at room temp
   void calibrateAtRoomTemp(float roomTempC = 23.0f);
 
-private:
-  // Pins
-  uint8_t pF_ = 32, pB_ = 33;
+  // Spike rejection on raw ADC samples (NTC backends only)
+  void setSpikeFilter(uint8_t window, float k = 3.0f);
+  uint32_t spikesRejected() const { return ntcF_.spikesRejected() + ntcB_.spikesRejected(); }
 
-  // Last filtered temps
-  float   tF_ = 25.0f, tB_ = 25.0f;
-
-  // Divider / thermistor constants (100k 3950 + 6.8k to GND)
-  static constexpr float SERIES_RESISTOR      = 6800.0f;     // 6.8kΩ → GND
-  static constexpr float THERMISTOR_NOMINAL   = 100000.0f;   // 100kΩ @ 25°C
-  static constexpr float TEMPERATURE_NOMINAL  = 25.0f;       // °C
-  static constexpr float BETA_COEFFICIENT     = 3950.0f;     // Beta
-  static constexpr float ADC_MAX              = 4095.0f;     // 12-bit
-
-  // Measured ADC reference (you can pass your measured 3.285 V in begin)
-  float vref_ = 3.30f;
+private:
+  struct Channel {
+    TempSensor*    src = nullptr;
+    float          t = 25.0f;              // last filtered temp
+    float          offset = 0.0f, scale = 1.0f;
+    PlateEstimator est;
+    int            duty = 0;
+    uint32_t       lastMs = 0;
+    bool           init = false;
+  };
+  Channel F_, B_;
 
-  // Per-channel calibration
-  float   frontOffset_ = 0.0f, frontScale_ = 1.0f;
-  float   backOffset_  = 0.0f, backScale_  = 1.0f;
+  // Built-in backends for the default wiring
+  NtcSensor ntcF_, ntcB_;
 
   // Helpers
-  float readThermC_(uint8_t pin, float lastStable);
-  float adcToTemp_(float adc);
+  void updateChannel_(Channel& c, uint32_t nowMs);
 };
@@ -0,0 +1,177 @@
+// SettingsStore.cpp
+#include "SettingsStore.h"
+#include "Log.h"
+
+SettingsStore settings;
+
+static const char* VERSION_KEY = "_ver";
+
+bool SettingsStore::begin(const SettingDef* defs, uint8_t count, uint16_t version,
+                          SettingsMigration migrate, const char* ns) {
+  defs_ = defs;
+  count_ = 0;
+  version_ = version;
+  for (uint8_t i = 0; i < count && count_ < MAX_SETTINGS; i++) {
+    if (defs[i].size > MAX_SIZE) { LOGE("SET", "%s: %u bytes, %u max", defs[i].key, defs[i].size, MAX_SIZE); break; }
+    memcpy(defaults_[i], defs[i].value, defs[i].size);
+    memcpy(shadow_[i], defs[i].value, defs[i].size);
+    count_++;
+  }
+  lastHash_ = hash_();
+
+  open_ = nvs_.begin(ns, false);
+  if (!open_) {
+    LOGE("SET", "NVS namespace '%s' unavailable - settings will not persist", ns);
+    return false;
+  }
+  storedVersion_ = nvs_.getUShort(VERSION_KEY, 0);
+  if (storedVersion_ > version_) {
+    // Writing would mix this schema into the newer one: leave NVS alone
+    nvs_.end();
+    open_ = false;
+    LOGW("SET", "Stored settings are v%u, newer than v%u - using defaults, not saving", storedVersion_, version_);
+    return true;
+  }
+  if (storedVersion_ && storedVersion_ < version_) {
+    LOGI("SET", "Migrating settings v%u -> v%u", storedVersion_, version_);
+    if (migrate) migrate(storedVersion_, nvs_);
+    nvs_.putUShort(VERSION_KEY, version_);
+    commits_++;
+    writes_++;
+  }
+
+  uint8_t loaded = 0;
+  for (uint8_t i = 0; i < count_; i++) {
+    const SettingDef& d = defs_[i];
+    if (!nvs_.isKey(d.key)) continue;
+    size_t n = nvs_.getBytesLength(d.key);
+    if (n != d.size || nvs_.getBytes(d.key, shadow_[i], n) != n) {
+      memcpy(shadow_[i], defaults_[i], d.size);
+      LOGW("SET", "Dropped %s (%u bytes stored, %u now)", d.key, (unsigned)n, d.size);
+      continue;
+    }
+    memcpy(d.value, shadow_[i], d.size);
+    stored_ |= 1UL << i;
+    loaded++;
+  }
+  lastHash_ = hash_();
+  LOGI("SET", "Loaded %u of %u settings (v%u)", loaded, count_, storedVersion_);
+  return true;
+}
+
+bool SettingsStore::stored(const char* key) const {
+  for (uint8_t i = 0; i < count_; i++)
+    if (strcmp(defs_[i].key, key) == 0) return stored(i);
+  return false;
+}
+
+bool SettingsStore::dirty(uint8_t i) const {
+  return memcmp(defs_[i].value, shadow_[i], defs_[i].size) != 0;
+}
+
+uint8_t SettingsStore::pending() const {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < count_; i++) n += dirty(i);
+  return n;
+}
+
+// FNV-1a
+uint32_t SettingsStore::hash_() const {
+  uint32_t h = 2166136261UL;
+  for (uint8_t i = 0; i < count_; i++) {
+    const uint8_t* p = (const uint8_t*)defs_[i].value;
+    for (uint8_t k = 0; k < defs_[i].size; k++) h = (h ^ p[k]) * 16777619UL;
+  }
+  return h;
+}
+
+void SettingsStore::poll(uint32_t nowMs) {
+  if (!count_) return;
+  uint32_t h = hash_();
+  if (h != lastHash_) {
+    lastHash_ = h;
+    lastChangeMs_ = nowMs;
+    if (!changing_) {
+      changing_ = true;
+      firstChangeMs_ = nowMs;
+    }
+  }
+  if (!changing_) return;
+  if (nowMs - lastChangeMs_ < DEBOUNCE_MS && nowMs - firstChangeMs_ < MAX_DEFER_MS) return;
+  changing_ = false;
+  commit_(nowMs);
+}
+
+void SettingsStore::flush() {
+  changing_ = false;
+  commit_(millis());
+}
+
+// Writes the variables that differ from NVS; one commit per call
+void SettingsStore::commit_(uint32_t nowMs) {
+  if (!open_) return;
+  uint8_t written = 0, failed = 0;
+  for (uint8_t i = 0; i < count_; i++) {
+    if (!dirty(i)) continue;
+    const SettingDef& d = defs_[i];
+    if (nvs_.putBytes(d.key, d.value, d.size) == d.size) {
+      memcpy(shadow_[i], d.value, d.size);
+      stored_ |= 1UL << i;
+      written++;
+    } else {
+      failed++;
+    }
+  }
+  if (written && storedVersion_ != version_) {
+    nvs_.putUShort(VERSION_KEY, version_);
+    storedVersion_ = version_;
+    written++;
+  }
+  if (!written && !failed) return;
+  commits_++;
+  writes_ += written;
+  if (failed) {
+    failures_ += failed;
+    changing_ = true;                      // try again after another debounce
+    firstChangeMs_ = lastChangeMs_ = nowMs;
+    LOGW("SET", "%u setting(s) failed to save", failed);
+  }
+  LOGD("SET", "Saved %u key(s), commit #%lu", written, (unsigned long)commits_);
+}
+
+void SettingsStore::factoryReset() {
+  if (open_) {
+    nvs_.clear();
+    commits_++;
+  }
+  for (uint8_t i = 0; i < count_; i++) {
+    memcpy(defs_[i].value, defaults_[i], defs_[i].size);
+    memcpy(shadow_[i], defaults_[i], defs_[i].size);
+  }
+  stored_ = 0;
+  storedVersion_ = 0;
+  changing_ = false;
+  lastHash_ = hash_();
+  LOGW("SET", "Factory reset: %u settings back to defaults", count_);
+}
+
+void SettingsStore::format(uint8_t i, char* out, size_t cap) const {
+  const SettingDef& d = defs_[i];
+  switch (d.type) {
+    case SET_BOOL:  snprintf(out, cap, "%s", *(const bool*)d.value ? "true" : "false"); break;
+    case SET_U8:    snprintf(out, cap, "%u", *(const uint8_t*)d.value); break;
+    case SET_INT:   snprintf(out, cap, "%d", *(const int*)d.value); break;
+    case SET_FLOAT: {
+      size_t n = 0;
+      for (uint8_t k = 0; k < d.size / sizeof(float) && n < cap; k++)
+        n += snprintf(out + n, cap - n, k ? " %.2f" : "%.2f", ((const float*)d.value)[k]);
+      break;
+    }
+    default: {
+      size_t n = snprintf(out, cap, "0x");
+      for (uint8_t k = 0; k < d.size && n + 3 <= cap; k++)
+        n += snprintf(out + n, cap - n, "%02x", ((const uint8_t*)d.value)[k]);
+      break;
+    }
+  }
+}
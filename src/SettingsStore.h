@@ -0,0 +1,96 @@
+#pragma once
+#include <Arduino.h>
+#include <Preferences.h>
+#include <type_traits>
+
+// Persistent tunables in NVS (Preferences), written lazily.
+// The registry points at the firmware's own variables, so hot paths keep
+// reading plain RAM and nothing changes for them. The store keeps a shadow
+// of what NVS holds; poll() compares the variables with it and commits
+// the ones that differ once they have been quiet for DEBOUNCE_MS (or
+// MAX_DEFER_MS after the first change, if they keep moving), so an
+// encoder sweep costs one flash write, not one per detent.
+//
+// Each value is one NVS key holding its raw bytes. A stored value whose
+// size no longer matches its variable (the type changed) is dropped and
+// the variable keeps its default. The schema version is stored too; an
+// older one is passed to the migration hook (renames, unit changes)
+// before loading, a newer one (firmware downgrade) is not trusted: the
+// defaults are used and the store turns read-only, so the newer settings
+// are still there after an upgrade. The defaults are the variables'
+// values at begin(). Nothing checks value ranges; the caller clamps.
+enum SettingType : uint8_t { SET_BOOL, SET_U8, SET_INT, SET_FLOAT, SET_BLOB };
+
+struct SettingDef {
+  const char* key;         // NVS key, at most 15 characters
+  SettingType type;        // for listing; storage is by size
+  void*       value;       // the live variable
+  uint8_t     size;
+};
+
+// Plain enums list as their int value, float arrays as floats
+template <class T> struct SettingTypeOf {
+  static constexpr SettingType type = std::is_enum<T>::value && sizeof(T) == sizeof(int) ? SET_INT : SET_BLOB;
+};
+template <>        struct SettingTypeOf<bool>        { static constexpr SettingType type = SET_BOOL; };
+template <>        struct SettingTypeOf<uint8_t>     { static constexpr SettingType type = SET_U8; };
+template <>        struct SettingTypeOf<int>         { static constexpr SettingType type = SET_INT; };
+template <>        struct SettingTypeOf<float>       { static constexpr SettingType type = SET_FLOAT; };
+template <size_t N> struct SettingTypeOf<float[N]>   { static constexpr SettingType type = SET_FLOAT; };
+
+template <class T> SettingDef setting(const char* key, T& var) {
+  return SettingDef{key, SettingTypeOf<T>::type, &var, (uint8_t)sizeof(T)};
+}
+
+// fromVersion: the stored schema. Runs with the namespace open read-write.
+typedef void (*SettingsMigration)(uint16_t fromVersion, Preferences& nvs);
+
+class SettingsStore {
+public:
+  static constexpr uint8_t  MAX_SETTINGS = 16;
+  static constexpr uint8_t  MAX_SIZE     = 16;      // bytes per value
+  static constexpr uint32_t DEBOUNCE_MS  = 5000;
+  static constexpr uint32_t MAX_DEFER_MS = 30000;
+
+  // Snapshots each variable as its default, then loads what NVS has.
+  // False if NVS could not be opened (the variables keep their defaults).
+  bool begin(const SettingDef* defs, uint8_t count, uint16_t version,
+             SettingsMigration migrate = nullptr, const char* ns = "reflow");
+
+  void poll(uint32_t nowMs);              // call every loop; RAM only until a commit is due
+  void flush();                           // commit pending changes now
+  void factoryReset();                    // defaults back into the variables, namespace cleared
+
+  uint8_t     count() const { return count_; }
+  const SettingDef& def(uint8_t i) const { return defs_[i]; }
+  bool        stored(uint8_t i) const { return stored_ & (1UL << i); }   // NVS has a value
+  bool        stored(const char* key) const;
+  bool        dirty(uint8_t i) const;     // variable differs from NVS, commit due
+  uint8_t     pending() const;            // how many are dirty
+  uint16_t    storedVersion() const { return storedVersion_; }           // 0: none found
+  bool        writable() const { return open_; }                         // false: nothing persists
+  uint32_t    commits() const { return commits_; }                       // flash commits since boot
+  uint32_t    writes() const { return writes_; }                         // keys written by them
+  uint32_t    failures() const { return failures_; }
+  // Value as text ("1.50", "true", "0x03"; float arrays space separated)
+  void        format(uint8_t i, char* out, size_t cap) const;
+
+private:
+  uint32_t hash_() const;                 // over every variable, to see them move
+  void commit_(uint32_t nowMs);
+
+  Preferences       nvs_;
+  bool              open_ = false;
+  const SettingDef* defs_ = nullptr;
+  uint8_t           count_ = 0;
+  uint16_t          version_ = 0, storedVersion_ = 0;
+  uint8_t           shadow_[MAX_SETTINGS][MAX_SIZE];     // what NVS holds (or the default)
+  uint8_t           defaults_[MAX_SETTINGS][MAX_SIZE];
+  uint32_t          stored_ = 0;
+  uint32_t          lastHash_ = 0;
+  bool              changing_ = false;
+  uint32_t          firstChangeMs_ = 0, lastChangeMs_ = 0;
+  uint32_t          commits_ = 0, writes_ = 0, failures_ = 0;
+};
+
+extern SettingsStore settings;
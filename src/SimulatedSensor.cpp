@@ -0,0 +1,27 @@
+#include "SimulatedSensor.h"
+
+bool SimulatedSensor::poll(uint32_t nowMs) {
+  if (lastMs_ && nowMs - lastMs_ < periodMs_) return false;
+  float dt = lastMs_ ? (nowMs - lastMs_) / 1000.0f : 0.0f;
+  lastMs_ = nowMs ? nowMs : 1;
+
+  float out = simC_;
+  if (plant_) {
+    // Small steps keep the sensor lag stable over long polls
+    while (dt > 0.0f) {
+      float h = dt > 0.1f ? 0.1f : dt;
+      const uint8_t n = sizeof(dutyLine_);
+      head_ = (head_ + 1) % n;
+      dutyLine_[head_] = duty_;
+      int duty = dutyLine_[(head_ + n - deadSteps_) % n];
+      simC_  += h * (p_.heatGain * duty / 100.0f - (p_.lossCoef + fanLoss_) * (simC_ - p_.ambientC));
+      sensC_ += h * (simC_ - sensC_) / p_.sensorTau;
+      dt -= h;
+    }
+    out = sensC_;
+  }
+  if (noiseC_ > 0.0f) out += noiseC_ * ((random(2001) - 1000) / 1000.0f);
+
+  raw_ = (uint16_t)constrain(out * 4.0f, 0.0f, 65535.0f);
+  return accept_(out);
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "TempSensor.h"
+#include "PlateEstimator.h"
+
+// Stand-in sensor for bench work without a plate. Either holds a value set
+// by setTempC(), or integrates the PlantParams model from the heater duty.
+class SimulatedSensor : public TempSensor {
+public:
+  bool begin() override { lastMs_ = 0; return true; }
+  bool poll(uint32_t nowMs) override;
+  const char* name() const override { return "SIM"; }
+
+  void setTempC(float c) { simC_ = c; plant_ = false; }
+  void setPlant(const PlantParams& p, float startC) { p_ = p; simC_ = startC; sensC_ = startC; plant_ = true; }
+  void setDuty(int pct) { duty_ = constrain(pct, 0, 100); }
+  void setFanLoss(float k) { fanLoss_ = k; }   // 1/s added to lossCoef
+  void setNoise(float peakC) { noiseC_ = peakC; }
+  void setPeriod(uint16_t ms) { periodMs_ = ms; }
+  // Heater-to-plate delay, up to DEAD_MAX_S: the element and glass warm
+  // before the plate does. 0 = the duty acts at once.
+  void setDeadSecs(float s) { deadSteps_ = (uint8_t)constrain(s * 10.0f, 0.0f, DEAD_MAX_S * 10.0f); }
+
+  float plateC() const { return simC_; }
+
+  static constexpr uint8_t DEAD_MAX_S = 10;
+
+private:
+  PlantParams p_ = {2.0f, 0.0017f, 4.0f, 25.0f};
+  bool     plant_ = false;
+  float    simC_ = 25.0f, sensC_ = 25.0f;
+  int      duty_ = 0;
+  float    fanLoss_ = 0.0f;
+  float    noiseC_ = 0.0f;
+  uint16_t periodMs_ = 0;
+  uint32_t lastMs_ = 0;
+  uint8_t  dutyLine_[DEAD_MAX_S * 10 + 1] = {};   // duty per 0.1 s step, newest at head_
+  uint8_t  head_ = 0, deadSteps_ = 0;
+};
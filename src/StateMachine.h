@@ -0,0 +1,154 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Small table-driven hierarchical state machine.
+// States form a tree through `parent`. An event is offered to the current
+// state first, then to each ancestor; the first row whose guard passes wins.
+// Rows with to == FSM_INTERNAL only run their action. A real transition runs
+// exit actions from the current state up to the common ancestor, then the
+// row action, then entry actions down to the target (targets are leaves).
+//
+// Each state gets an event mask at begin() (its rows plus its ancestors'),
+// so an event nobody in the chain handles costs one AND. Actions may post()
+// follow-up events; they run after the current one, in order.
+// Nothing here depends on Arduino: tables, guards and actions are plain
+// data and function pointers, so transitions can be driven off-target.
+#define FSM_NONE     0xFF   // parent of a top-level state
+#define FSM_INTERNAL 0xFE   // row target: stay, no exit/entry
+
+typedef void (*FsmAction)();
+typedef bool (*FsmGuard)();
+
+struct FsmState {
+  const char* name;
+  uint8_t     parent;
+  FsmAction   onEntry;   // may be null
+  FsmAction   onExit;    // may be null
+};
+
+struct FsmTransition {
+  uint8_t   from;
+  uint8_t   event;       // 0..31
+  uint8_t   to;          // state index or FSM_INTERNAL
+  FsmGuard  guard;       // null = always
+  FsmAction action;      // null = none
+};
+
+template <uint8_t MAXSTATES>
+class StateMachine {
+public:
+  typedef void (*TraceFn)(uint8_t from, uint8_t event, uint8_t to);
+
+  void begin(const FsmState* states, uint8_t nStates,
+             const FsmTransition* rows, uint8_t nRows, uint8_t initial) {
+    states_ = states; nStates_ = nStates < MAXSTATES ? nStates : MAXSTATES;
+    rows_ = rows; nRows_ = nRows;
+    qHead_ = qLen_ = 0;
+
+    uint32_t own[MAXSTATES] = {};
+    for (uint8_t r = 0; r < nRows_; r++)
+      if (rows_[r].from < nStates_) own[rows_[r].from] |= 1UL << rows_[r].event;
+    for (uint8_t s = 0; s < nStates_; s++) {
+      uint32_t m = 0;
+      for (uint8_t a = s; a != FSM_NONE; a = states_[a].parent) m |= own[a];
+      mask_[s] = m;
+    }
+
+    cur_ = initial;
+    enterFrom_(FSM_NONE, initial);
+  }
+
+  uint8_t state() const { return cur_; }
+  const char* stateName(uint8_t s) const { return s < nStates_ ? states_[s].name : "?"; }
+
+  // True if s is the current state or one of its ancestors
+  bool in(uint8_t s) const {
+    for (uint8_t a = cur_; a != FSM_NONE; a = states_[a].parent)
+      if (a == s) return true;
+    return false;
+  }
+
+  bool handles(uint8_t event) const { return mask_[cur_] & (1UL << event); }
+
+  // Queue an event to run after the one being dispatched (or on the next dispatch)
+  void post(uint8_t event) {
+    if (qLen_ < QLEN) queue_[(qHead_ + qLen_++) % QLEN] = event;
+  }
+
+  // Returns true if the event (not counting posted follow-ups) was handled
+  bool dispatch(uint8_t event) {
+    bool handled = step_(event);
+    while (qLen_) {
+      uint8_t e = queue_[qHead_];
+      qHead_ = (qHead_ + 1) % QLEN;
+      qLen_--;
+      step_(e);
+    }
+    return handled;
+  }
+
+  // Called after every real transition (logging, mode bookkeeping)
+  void setTrace(TraceFn fn) { trace_ = fn; }
+
+private:
+  static constexpr uint8_t QLEN = 4;
+
+  const FsmState*      states_ = nullptr;
+  const FsmTransition* rows_ = nullptr;
+  uint8_t  nStates_ = 0, nRows_ = 0;
+  uint8_t  cur_ = 0;
+  uint32_t mask_[MAXSTATES] = {};
+  uint8_t  queue_[QLEN];
+  uint8_t  qHead_ = 0, qLen_ = 0;
+  TraceFn  trace_ = nullptr;
+
+  bool step_(uint8_t event) {
+    if (!(mask_[cur_] & (1UL << event))) return false;
+    for (uint8_t s = cur_; s != FSM_NONE; s = states_[s].parent) {
+      for (uint8_t r = 0; r < nRows_; r++) {
+        const FsmTransition& t = rows_[r];
+        if (t.from != s || t.event != event) continue;
+        if (t.guard && !t.guard()) continue;
+        fire_(t);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void fire_(const FsmTransition& t) {
+    if (t.to == FSM_INTERNAL) {
+      if (t.action) t.action();
+      return;
+    }
+    uint8_t from = cur_;
+    // Self-transition leaves and re-enters the state itself
+    uint8_t lca = (t.to == from) ? states_[from].parent : commonAncestor_(from, t.to);
+    for (uint8_t s = from; s != lca; s = states_[s].parent) {
+      if (states_[s].onExit) states_[s].onExit();
+    }
+    if (t.action) t.action();
+    cur_ = t.to;
+    enterFrom_(lca, t.to);
+    if (trace_) trace_(from, t.event, t.to);
+  }
+
+  // Entry actions from just below `top` down to `target`
+  void enterFrom_(uint8_t top, uint8_t target) {
+    uint8_t path[MAXSTATES];
+    uint8_t n = 0;
+    for (uint8_t s = target; s != top && s != FSM_NONE && n < MAXSTATES; s = states_[s].parent) path[n++] = s;
+    while (n) {
+      uint8_t s = path[--n];
+      if (states_[s].onEntry) states_[s].onEntry();
+    }
+  }
+
+  uint8_t commonAncestor_(uint8_t a, uint8_t b) const {
+    for (uint8_t x = a; x != FSM_NONE; x = states_[x].parent)
+      for (uint8_t y = b; y != FSM_NONE; y = states_[y].parent)
+        if (x == y) return x;
+    return FSM_NONE;
+  }
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include <stdint.h>
+#include "Types.h"
+#include "StateMachine.h"
+
+// Station state machine of ReflowStation.cpp: states, events, the machine
+// and the inputs its guards read, so host tests can drive transitions.
+// IDLE:  MENU, TEST, COOL_TEST (CT_HEAT -> CT_COOL), CHAR, DIAG (-DLOOP_PROFILING)
+// SETUP: PROF_SETUP, CONST_SETUP
+// RUN:   PROFILE (PREHEAT, SOAK, REFLOW, COOL), CONST
+// DONE, FAULT
+enum StationState : uint8_t {
+  ST_IDLE, ST_MENU, ST_TEST, ST_COOL_TEST, ST_CT_HEAT, ST_CT_COOL, ST_CHAR,
+#ifdef LOOP_PROFILING
+  ST_DIAG,
+#endif
+  ST_SETUP, ST_PROF_SETUP, ST_CONST_SETUP,
+  ST_RUN, ST_PROFILE, ST_PREHEAT, ST_SOAK, ST_REFLOW, ST_COOL, ST_CONST,
+  ST_DONE, ST_FAULT, ST_COUNT
+};
+
+enum StationEvent : uint8_t {
+  EV_TICK, EV_TURN, EV_CLICK, EV_LONG,
+  EV_GO_PROFILE, EV_GO_CONST, EV_GO_TEST,
+  EV_PHASE_PREHEAT, EV_PHASE_SOAK, EV_PHASE_REFLOW, EV_PHASE_COOL,
+  EV_FINISHED, EV_AT_TEMP, EV_COOLED, EV_FAULT,
+  EV_ABORT                 // remote `abort`: heaters off, back towards the menu
+};
+
+extern StateMachine<ST_COUNT> fsm;
+extern Mode currentMode;       // screen/telemetry view of the station state
+
+// What the menu, setup and test screens have selected
+extern int       menuIndex;
+extern HeatState heatSelection;
+extern HeatState heatActive;
+extern int       testPct;
+extern uint8_t   constField;
+extern int       encoderSteps;   // steps carried by the EV_TURN being dispatched
+extern bool      runAborted;     // how the last run reached DONE
+
+// Loads the tables and enters MENU (setup() does this)
+void stationBegin();
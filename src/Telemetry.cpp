@@ -0,0 +1,54 @@
+// Telemetry.cpp
+#include "Telemetry.h"
+#include "Log.h"
+
+Telemetry telemetry;
+
+uint16_t Telemetry::crc16(const uint8_t* data, size_t n) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < n; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int k = 0; k < 8; k++)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+  }
+  return crc;
+}
+
+size_t Telemetry::cobsEncode(const uint8_t* in, size_t n, uint8_t* out) {
+  size_t codeIdx = 0, o = 1;
+  uint8_t code = 1;
+  for (size_t i = 0; i < n; i++) {
+    if (in[i] == 0) {
+      out[codeIdx] = code; codeIdx = o++; code = 1;
+    } else {
+      out[o++] = in[i];
+      if (++code == 0xFF) { out[codeIdx] = code; codeIdx = o++; code = 1; }
+    }
+  }
+  out[codeIdx] = code;
+  return o;
+}
+
+void Telemetry::send(TelemetryFrame& f, uint32_t nowMs) {
+  if (!enabled_) return;
+  if (intervalMs_ && lastMs_ && nowMs - lastMs_ < intervalMs_) return;
+  lastMs_ = nowMs ? nowMs : 1;
+
+  f.version = TELEMETRY_VERSION;
+  f.seq = seq_++;
+  f.tMs = nowMs;
+
+  uint8_t raw[sizeof(TelemetryFrame) + 2];
+  memcpy(raw, &f, sizeof(f));
+  uint16_t crc = crc16(raw, sizeof(f));
+  raw[sizeof(f)]     = crc & 0xFF;
+  raw[sizeof(f) + 1] = crc >> 8;
+
+  uint8_t wire[sizeof(raw) + sizeof(raw) / 254 + 3];
+  wire[0] = 0;
+  size_t n = 1 + cobsEncode(raw, sizeof(raw), wire + 1);
+  wire[n++] = 0;
+
+  if (logger.writeRaw(wire, n)) sent_++;
+  else dropped_++;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <Arduino.h>
+
+// One control-tick snapshot. Little-endian, packed; version bumps on any
+// layout change (tools/telemetry_decode.py mirrors this struct).
+struct __attribute__((packed)) TelemetryFrame {
+  uint8_t  version;
+  uint8_t  mode;          // Mode
+  uint16_t seq;           // wraps; gaps = dropped frames
+  uint32_t tMs;
+  uint16_t rawFront, rawBack;   // backend raw codes (ADC counts for NTC)
+  int16_t  tFrontCc, tBackCc;   // filtered temps, centi-°C
+  int16_t  setpointCc;
+  uint8_t  dutyFront, dutyBack; // %
+  uint8_t  fanPct;
+  uint8_t  flags;         // TLM_* bits
+  uint16_t loopUs;        // previous loop() duration
+};
+
+#define TELEMETRY_VERSION 1
+enum : uint8_t {
+  TLM_FAN_ON       = 0x01,
+  TLM_COOLING      = 0x02,
+  TLM_RUNNING      = 0x04,
+  TLM_SENSOR_ERR   = 0x08,
+  TLM_MANUAL_FAN   = 0x10,
+  TLM_FAN_STALL    = 0x20,
+  TLM_FAN_DEGRADED = 0x40,
+};
+
+// Binary telemetry stream on the log UART.
+// Wire format per frame: 0x00, COBS(frame + CRC-16/CCITT-FALSE), 0x00.
+// The leading delimiter lets a decoder resync after interleaved log text.
+// Frames are queued through the logger so text and frames never interleave
+// mid-record; a frame that does not fit is dropped and counted.
+class Telemetry {
+public:
+  void setEnabled(bool on) { enabled_ = on; }
+  bool enabled() const { return enabled_; }
+  void setIntervalMs(uint16_t ms) { intervalMs_ = ms; }   // 0 = every tick
+
+  // Stamps version/seq/tMs and queues the frame if due
+  void send(TelemetryFrame& f, uint32_t nowMs);
+
+  uint32_t sent()    const { return sent_; }
+  uint32_t dropped() const { return dropped_; }
+
+  static uint16_t crc16(const uint8_t* data, size_t n);
+  // Returns encoded length; out needs n + n/254 + 1 bytes
+  static size_t cobsEncode(const uint8_t* in, size_t n, uint8_t* out);
+
+private:
+  bool     enabled_ = false;
+  uint16_t intervalMs_ = 0;
+  uint32_t lastMs_ = 0;
+  uint16_t seq_ = 0;
+  uint32_t sent_ = 0, dropped_ = 0;
+};
+
+extern Telemetry telemetry;
@@ -0,0 +1,32 @@
+#pragma once
+#include <Arduino.h>
+
+// Source of one plate temperature (uncalibrated °C).
+// poll() is called every loop and must return quickly: backends with slow
+// conversions keep their own schedule and only report when a fresh
+// reading is ready. SensorManager applies calibration and filtering.
+class TempSensor {
+public:
+  virtual ~TempSensor() {}
+  virtual bool begin() = 0;
+
+  // Returns true when a new reading was produced by this call
+  virtual bool poll(uint32_t nowMs) = 0;
+
+  float    tempC() const { return tempC_; }   // last good reading
+  uint16_t raw()   const { return raw_; }     // last raw code (ADC counts / chip word)
+  bool     fault() const { return fault_; }
+  virtual const char* name() const = 0;
+
+protected:
+  float    tempC_ = 25.0f;
+  uint16_t raw_   = 0;
+  bool     fault_ = false;
+
+  // Accept a reading if plausible, otherwise flag and hold the last good one
+  bool accept_(float t) {
+    if (!isfinite(t) || t < -40.0f || t > 350.0f) { fault_ = true; return false; }
+    tempC_ = t; fault_ = false;
+    return true;
+  }
+};
@@ -0,0 +1,60 @@
+#include "ThermocoupleSensor.h"
+#include <SPI.h>
+
+void ArduinoSpiBus::begin(uint8_t csPin) {
+  pinMode(csPin, OUTPUT);
+  digitalWrite(csPin, HIGH);
+  if (!started_) { SPI.begin(sck_, miso_, -1, -1); started_ = true; }
+}
+
+uint32_t ArduinoSpiBus::read(uint8_t csPin, uint8_t bits) {
+  SPI.beginTransaction(SPISettings(hz_, MSBFIRST, SPI_MODE0));
+  digitalWrite(csPin, LOW);
+  uint32_t w = SPI.transfer16(0);
+  if (bits == 32) w = (w << 16) | SPI.transfer16(0);
+  digitalWrite(csPin, HIGH);
+  SPI.endTransaction();
+  return w;
+}
+
+// A read takes a few µs; the conversion schedule is what keeps the loop free
+bool ThermocoupleSensor::poll(uint32_t nowMs) {
+  if (started_ && nowMs - lastReadMs_ < periodMs_) return false;
+  started_ = true;
+  lastReadMs_ = nowMs;
+
+  uint32_t w = bus_.read(cs_, bits_());
+  raw_ = (bits_() == 32) ? (uint16_t)(w >> 18) : (uint16_t)w;
+
+  float t;
+  if (!decode_(w, t)) { fault_ = true; return false; }
+  return accept_(t);
+}
+
+/**
+ * D31..18 TC temp (signed, 0.25 °C), D16 fault,
+ * D15..4 internal temp (signed, 0.0625 °C), D2 SCV, D1 SCG, D0 OC
+ */
+bool Max31855Sensor::decode(uint32_t w, float& tempC, float& internalC, uint8_t& faults) {
+  faults = w & 0x07;
+  if (w & 0x00010000UL) {
+    if (!faults) faults = 0x80;   // fault bit without a cause: bus stuck high
+    return false;
+  }
+  int16_t tc = (int16_t)((w >> 16) & 0xFFFC) >> 2;   // sign-extend 14 bits
+  int16_t ij = (int16_t)(w & 0xFFF0) >> 4;           // sign-extend 12 bits
+  tempC = tc * 0.25f;
+  internalC = ij * 0.0625f;
+  return true;
+}
+
+/**
+ * D15 dummy 0, D14..3 TC temp (0.25 °C), D2 open thermocouple, D1 id 0
+ */
+bool Max6675Sensor::decode(uint16_t w, float& tempC, uint8_t& faults) {
+  faults = 0;
+  if (w & 0x8002) { faults = 0x80; return false; }   // must-be-zero bits set: no chip
+  if (w & 0x0004) { faults = 0x01; return false; }   // open thermocouple
+  tempC = (w >> 3) * 0.25f;
+  return true;
+}
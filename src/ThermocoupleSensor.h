@@ -0,0 +1,83 @@
+#pragma once
+#include "TempSensor.h"
+
+// Minimal read-only SPI access for thermocouple amplifiers. The chips only
+// shift data out, so a read is CS low, clock N bits, CS high.
+class ThermoBus {
+public:
+  virtual ~ThermoBus() {}
+  virtual void     begin(uint8_t csPin) = 0;
+  virtual uint32_t read(uint8_t csPin, uint8_t bits) = 0;   // 16 or 32, MSB first
+};
+
+// Hardware SPI on explicit pins. The VSPI defaults (SCK 18, MISO 19) are
+// taken by SSR_FRONT and the fan on this board.
+class ArduinoSpiBus : public ThermoBus {
+public:
+  ArduinoSpiBus(int8_t sck, int8_t miso, uint32_t hz = 4000000) : sck_(sck), miso_(miso), hz_(hz) {}
+  void     begin(uint8_t csPin) override;
+  uint32_t read(uint8_t csPin, uint8_t bits) override;
+private:
+  int8_t   sck_, miso_;
+  uint32_t hz_;
+  bool     started_ = false;
+};
+
+// Base for chips that convert continuously and must not be read faster than
+// their conversion time (a read during conversion restarts it).
+class ThermocoupleSensor : public TempSensor {
+public:
+  ThermocoupleSensor(ThermoBus& bus, uint8_t csPin, uint16_t periodMs)
+    : bus_(bus), cs_(csPin), periodMs_(periodMs) {}
+
+  bool begin() override { bus_.begin(cs_); lastReadMs_ = 0; started_ = false; return true; }
+  bool poll(uint32_t nowMs) override;
+
+  uint8_t faultBits() const { return faultBits_; }   // chip-specific fault flags
+
+protected:
+  // Decode one chip word; return false on a chip-reported fault
+  virtual bool decode_(uint32_t word, float& tempC) = 0;
+  virtual uint8_t bits_() const = 0;
+
+  ThermoBus& bus_;
+  uint8_t    cs_;
+  uint16_t   periodMs_;
+  uint32_t   lastReadMs_ = 0;
+  bool       started_ = false;
+  uint8_t    faultBits_ = 0;
+};
+
+// MAX31855: 32-bit word, 14-bit signed TC temp in 0.25 °C, ~100 ms conversion
+class Max31855Sensor : public ThermocoupleSensor {
+public:
+  Max31855Sensor(ThermoBus& bus, uint8_t csPin) : ThermocoupleSensor(bus, csPin, 100) {}
+  const char* name() const override { return "MAX31855"; }
+  float internalC() const { return internalC_; }   // cold-junction temp
+
+  static bool decode(uint32_t word, float& tempC, float& internalC, uint8_t& faults);
+
+protected:
+  bool decode_(uint32_t word, float& tempC) override {
+    return decode(word, tempC, internalC_, faultBits_);
+  }
+  uint8_t bits_() const override { return 32; }
+
+private:
+  float internalC_ = 25.0f;
+};
+
+// MAX6675: 16-bit word, 12-bit TC temp in 0.25 °C, up to 220 ms conversion
+class Max6675Sensor : public ThermocoupleSensor {
+public:
+  Max6675Sensor(ThermoBus& bus, uint8_t csPin) : ThermocoupleSensor(bus, csPin, 250) {}
+  const char* name() const override { return "MAX6675"; }
+
+  static bool decode(uint16_t word, float& tempC, uint8_t& faults);
+
+protected:
+  bool decode_(uint32_t word, float& tempC) override {
+    return decode((uint16_t)word, tempC, faultBits_);
+  }
+  uint8_t bits_() const override { return 16; }
+};
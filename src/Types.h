@@ -1,6 +1,13 @@
 #pragma once
 #include <Arduino.h>
-enum Mode : uint8_t { MENU, PROF_SETUP, PROFILE_RUN, CONST_SETUP, CONST_RUN, TEST_RUN, COOL_TEST };
+enum Mode : uint8_t { MENU, PROF_SETUP, PROFILE_RUN, CONST_SETUP, CONST_RUN, TEST_RUN, COOL_TEST, DIAG, FAULT, CHARACTERIZE, MODE_COUNT };
 enum HeatState : uint8_t { HEAT_OFF, HEAT_BOTH, HEAT_FRONT, HEAT_BACK };
 
 struct PIDGains { float P, I, D; float iMax; };
+
+inline const char* modeName(uint8_t m) {
+  static const char* names[MODE_COUNT] = { "MENU", "PROF_SETUP", "PROFILE_RUN", "CONST_SETUP",
+                                           "CONST_RUN", "TEST_RUN", "COOL_TEST", "DIAG", "FAULT",
+                                           "CHARACTERIZE" };
+  return m < MODE_COUNT ? names[m] : "?";
+}
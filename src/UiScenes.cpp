@@ -0,0 +1,84 @@
+// UiScenes.cpp
+#include "UiScenes.h"
+#include "ProfileRunner.h"
+#include "LoopProfiler.h"
+#include "Clock.h"
+
+static constexpr uint32_t UI_CAPTURE_FRAMES = 24;
+
+const char* uiSceneName(uint8_t scene) {
+  static const char* names[UI_SCENE_COUNT] = {
+    "menu", "profile_setup", "constant_setup", "run",
+    "profile_run", "profile_done", "test", "cool_test",
+#ifdef LOOP_PROFILING
+    "diagnostics",
+#endif
+    "fault"
+  };
+  return scene < UI_SCENE_COUNT ? names[scene] : "?";
+}
+
+void uiRenderScene(DisplayUI& ui, uint8_t scene, uint32_t frame) {
+  const Profile& prof = PROFILES[0];
+  switch (scene) {
+    case SCENE_MENU:
+      ui.showMenu(frame % 5, 150.0f, 148.5f, HEAT_BOTH, false, true);
+      break;
+    case SCENE_PROFILE_SETUP:
+      ui.showProfileSetup(prof, 2);
+      break;
+    case SCENE_CONSTANT_SETUP:
+      ui.showConstantSetup(180, 1.0f, 300, frame % 3);
+      break;
+    case SCENE_RUN:
+      ui.showConstantRun(180.0f, 180, 179.2f, 178.6f, 62, 58, 1.0f, true, 300 - (int)frame);
+      break;
+    case SCENE_PROFILE_RUN: {
+      // Plate tracks the profile 3 °C low; one graph column per frame step
+      uint16_t dur = prof.slots[prof.slotCount - 1].slotSecs;
+      if (frame == 0) ui.setupProfileDisplay(prof, dur);
+      ProfileRunner r;
+      r.begin(prof);
+      uint16_t elapsed = (uint16_t)((frame * 10u) % dur);
+      bool finished;
+      float sp = r.update(clockMs() + elapsed * 1000u, finished);
+      ui.showProfileRun(prof, sp, sp - 3.0f, sp - 3.5f, 70, 66, elapsed, dur - elapsed, false, false,
+                        r.phaseAt(elapsed));
+      break;
+    }
+    case SCENE_PROFILE_DONE:
+      ui.showProfileRun(prof, 0, 0, 0, 0, 0, 0, 0, true, false);
+      break;
+    case SCENE_TEST:
+      ui.showTest(40, 120.0f, 119.0f, HEAT_BOTH);
+      break;
+    case SCENE_COOL_TEST:
+      ui.showCoolTest(120.0f, 119.0f);
+      break;
+#ifdef LOOP_PROFILING
+    case SCENE_DIAGNOSTICS:
+      ui.showDiagnostics(loopProfiler, MENU);
+      break;
+#endif
+    case SCENE_FAULT:
+      ui.showFault(false, 999.0f, 24.5f);
+      break;
+    default:
+      break;
+  }
+}
+
+void uiCaptureScenes(DisplayUI& ui, Print& out) {
+  for (uint8_t s = 0; s < UI_SCENE_COUNT; s++) {
+    for (uint32_t f = 0; f + 1 < UI_CAPTURE_FRAMES; f++) uiRenderScene(ui, s, f);
+    ui.frame().resetStats();
+    uiRenderScene(ui, s, UI_CAPTURE_FRAMES - 1);
+
+    const OledFramebuffer::Stats& st = ui.frame().stats();
+    out.printf("SCREEN,%s,%lu,%lu,%lu,%08lX\n", uiSceneName(s),
+               (unsigned long)st.primitives, (unsigned long)st.glyphs,
+               (unsigned long)st.pixels, (unsigned long)ui.frame().crc32());
+    ui.frame().writePbm(out);
+  }
+  out.println("SCREEN_END");
+}
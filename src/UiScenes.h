@@ -0,0 +1,24 @@
+#pragma once
+#include <Arduino.h>
+#include "DisplayUI.h"
+
+// Every DisplayUI screen rendered from fixed inputs. Shared by the bench
+// build and the screen-capture build (-DUI_CAPTURE), so both look at the
+// same frames. `frame` steps any animated content (graph trace, blink).
+enum UiScene : uint8_t {
+  SCENE_MENU, SCENE_PROFILE_SETUP, SCENE_CONSTANT_SETUP, SCENE_RUN,
+  SCENE_PROFILE_RUN, SCENE_PROFILE_DONE, SCENE_TEST, SCENE_COOL_TEST,
+#ifdef LOOP_PROFILING
+  SCENE_DIAGNOSTICS,
+#endif
+  SCENE_FAULT, UI_SCENE_COUNT
+};
+
+const char* uiSceneName(uint8_t scene);
+void uiRenderScene(DisplayUI& ui, uint8_t scene, uint32_t frame);
+
+// Renders each scene for UI_CAPTURE_FRAMES frames and prints, per scene:
+//   SCREEN,<name>,<primitives>,<glyphs>,<pixels>,<crc32>
+//   <P1 PBM of the final frame>
+// Counts cover the final frame only (tools/screen_capture.py).
+void uiCaptureScenes(DisplayUI& ui, Print& out);
@@ -0,0 +1,224 @@
+// WebDashboard.cpp
+#ifdef REFLOW_WIFI
+#include "WebDashboard.h"
+#include "DashboardPage.h"
+#include "Log.h"
+#include <stdio.h>
+#include <WiFi.h>
+
+WebDashboard dashboard;
+
+static WiFiServer server(80);
+static WiFiClient socks[WebDashboard::MAX_CLIENTS];
+
+void WebDashboard::begin(uint8_t taskPriority) {
+  xTaskCreatePinnedToCore(task_, "web", 6144, this, taskPriority, nullptr, 0);
+}
+
+void WebDashboard::task_(void* arg) {
+  WebDashboard* self = (WebDashboard*)arg;
+#ifdef WIFI_SSID
+  WiFi.mode(WIFI_STA);
+  WiFi.setAutoReconnect(true);
+  WiFi.begin(WIFI_SSID, WIFI_PASS);
+  while (WiFi.status() != WL_CONNECTED) vTaskDelay(pdMS_TO_TICKS(250));
+  snprintf(self->addr_, sizeof(self->addr_), "http://%s/", WiFi.localIP().toString().c_str());
+#else
+  WiFi.mode(WIFI_AP);
+  WiFi.softAP(WIFI_AP_SSID, WIFI_AP_PASS);
+  snprintf(self->addr_, sizeof(self->addr_), "http://%s/ on AP '%s'", WiFi.softAPIP().toString().c_str(), WIFI_AP_SSID);
+#endif
+  self->addrReady_.store(true, std::memory_order_release);
+  server.begin();
+  server.setNoDelay(true);
+  for (;;) {
+    self->serve_();
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+}
+
+// ---- Control loop side ----
+void WebDashboard::publish(const TelemetryFrame& f, uint32_t nowMs) {
+  DashSample s;
+  s.tMs = nowMs;
+  s.tFront = f.tFrontCc / 100.0f;
+  s.tBack = f.tBackCc / 100.0f;
+  s.setpoint = f.setpointCc / 100.0f;
+  s.dutyFront = f.dutyFront;
+  s.dutyBack = f.dutyBack;
+  s.fanPct = f.fanPct;
+  s.mode = f.mode;
+  s.flags = f.flags;
+  portENTER_CRITICAL(&mux_);
+  window_.add(s);
+  portEXIT_CRITICAL(&mux_);
+}
+
+// The logger takes messages from the loop task only, so the network
+// task leaves notes and they are logged here
+void WebDashboard::poll() {
+  if (!addrLogged_ && addrReady_.load(std::memory_order_acquire)) {
+    LOGI("WEB", "Dashboard at %s", addr_);
+    addrLogged_ = true;
+  }
+  uint8_t on = connects_.load(std::memory_order_relaxed), off = disconnects_.load(std::memory_order_relaxed);
+  if (on != connectsLogged_ || off != disconnectsLogged_) {
+    LOGI("WEB", "%u client(s) connected, %u left", (uint8_t)(on - connectsLogged_), (uint8_t)(off - disconnectsLogged_));
+    connectsLogged_ = on;
+    disconnectsLogged_ = off;
+  }
+}
+
+bool WebDashboard::nextCommand(char* out, size_t cap) {
+  uint8_t tail = cmdTail_.load(std::memory_order_relaxed);
+  if (tail == cmdHead_.load(std::memory_order_acquire)) return false;
+  strncpy(out, cmds_[tail % CMD_SLOTS], cap - 1);
+  out[cap - 1] = '\0';
+  cmdTail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+// ---- Network task ----
+void WebDashboard::serve_() {
+  accept_();
+
+  SampleAverager fresh;
+  portENTER_CRITICAL(&mux_);
+  fresh = window_;
+  window_ = SampleAverager();
+  portEXIT_CRITICAL(&mux_);
+
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+    Client& c = clients_[i];
+    if (!c.used) continue;
+    if (!socks[i].connected()) { drop_(i); continue; }
+    read_(i);
+    if (!c.used || !c.upgraded) continue;
+    c.avg.add(fresh);
+    if (now - c.lastPushMs >= c.pushMs && !c.avg.empty()) {
+      c.lastPushMs = now;
+      uint16_t n = c.avg.count();
+      char json[160];
+      size_t len = dashJson(c.avg.take(), n, json, sizeof(json));
+      if (len) sendText_(i, json, len);
+    }
+  }
+}
+
+void WebDashboard::accept_() {
+  WiFiClient incoming = server.available();
+  if (!incoming) return;
+  for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+    if (clients_[i].used) continue;
+    socks[i] = incoming;
+    socks[i].setNoDelay(true);
+    Client& c = clients_[i];
+    c.used = true;
+    c.upgraded = false;
+    c.pushMs = DEFAULT_PUSH_MS;
+    c.lastPushMs = millis();
+    c.req.reset();
+    c.ws.reset();
+    c.avg = SampleAverager();
+    return;
+  }
+  incoming.print("HTTP/1.1 503 Service Unavailable\r\nConnection: close\r\n\r\n");
+  incoming.stop();
+}
+
+void WebDashboard::read_(uint8_t i) {
+  Client& c = clients_[i];
+  uint8_t buf[128];
+  int n = socks[i].available();
+  if (n <= 0) return;
+  n = socks[i].read(buf, min(n, (int)sizeof(buf)));
+  for (int k = 0; k < n && c.used; k++) {
+    if (!c.upgraded) {
+      if (c.req.feed(buf[k]))   onRequest_(i);
+      else if (c.req.error())   drop_(i);
+      continue;
+    }
+    switch (c.ws.feed(buf[k])) {
+      case WsReader::WS_MESSAGE:
+        onMessage_(i, c.ws.message());
+        break;
+      case WsReader::WS_PING: {
+        uint8_t f[WS_MAX_MESSAGE + 2];
+        size_t len = wsFrame(WS_OP_PONG, c.ws.message(), c.ws.length(), f, sizeof(f));
+        socks[i].write(f, len);
+        break;
+      }
+      case WsReader::WS_CLOSE:
+      case WsReader::WS_ERROR: {
+        uint8_t f[2];
+        socks[i].write(f, wsFrame(WS_OP_CLOSE, nullptr, 0, f, sizeof(f)));
+        drop_(i);
+        break;
+      }
+      default:
+        break;
+    }
+  }
+}
+
+void WebDashboard::onRequest_(uint8_t i) {
+  Client& c = clients_[i];
+  WiFiClient& s = socks[i];
+  if (strcmp(c.req.path(), "/ws") == 0 && c.req.wantsWebSocket()) {
+    char resp[160];
+    size_t n = wsHandshake(c.req.wsKey(), resp, sizeof(resp));
+    s.write((const uint8_t*)resp, n);
+    c.upgraded = true;
+    c.lastPushMs = millis();
+    connects_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  if (strcmp(c.req.method(), "GET") == 0 && (strcmp(c.req.path(), "/") == 0 || strcmp(c.req.path(), "/index.html") == 0)) {
+    size_t len = sizeof(DASHBOARD_HTML) - 1;
+    s.printf("HTTP/1.1 200 OK\r\nContent-Type: text/html\r\nContent-Length: %u\r\nConnection: close\r\n\r\n",
+             (unsigned)len);
+    for (size_t off = 0; off < len; off += 1024)
+      s.write((const uint8_t*)DASHBOARD_HTML + off, min(len - off, (size_t)1024));
+  } else {
+    s.print("HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+  }
+  drop_(i);
+}
+
+void WebDashboard::onMessage_(uint8_t i, const char* msg) {
+  char reply[64];
+  int ms;
+  if (sscanf(msg, "rate %d", &ms) == 1) {
+    clients_[i].pushMs = constrain(ms, MIN_PUSH_MS, MAX_PUSH_MS);
+    snprintf(reply, sizeof(reply), "{\"ack\":\"rate %u\"}", clients_[i].pushMs);
+  } else if (strcmp(msg, "abort") == 0 || strcmp(msg, "start") == 0 ||
+             (strncmp(msg, "start ", 6) == 0 && strlen(msg) < CMD_MAX)) {
+    uint8_t head = cmdHead_.load(std::memory_order_relaxed);
+    if ((uint8_t)(head - cmdTail_.load(std::memory_order_acquire)) >= CMD_SLOTS) {
+      snprintf(reply, sizeof(reply), "{\"err\":\"busy\"}");
+    } else {
+      strncpy(cmds_[head % CMD_SLOTS], msg, CMD_MAX - 1);
+      cmds_[head % CMD_SLOTS][CMD_MAX - 1] = '\0';
+      cmdHead_.store(head + 1, std::memory_order_release);
+      snprintf(reply, sizeof(reply), "{\"ack\":\"%s\"}", msg);
+    }
+  } else {
+    snprintf(reply, sizeof(reply), "{\"err\":\"unknown command\"}");
+  }
+  sendText_(i, reply, strlen(reply));
+}
+
+void WebDashboard::sendText_(uint8_t i, const char* text, size_t n) {
+  uint8_t f[200];
+  size_t len = wsFrame(WS_OP_TEXT, text, n, f, sizeof(f));
+  if (len && socks[i].write(f, len) != len) drop_(i);   // a stalled client is cut off
+}
+
+void WebDashboard::drop_(uint8_t i) {
+  if (clients_[i].upgraded) disconnects_.fetch_add(1, std::memory_order_relaxed);
+  socks[i].stop();
+  clients_[i].used = false;
+  clients_[i].upgraded = false;
+}
+#endif
@@ -0,0 +1,82 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "DashboardFeed.h"
+#include "Telemetry.h"
+#include "WsProtocol.h"
+
+// Optional WiFi dashboard (build with -DREFLOW_WIFI).
+// GET / serves the page compiled into flash (DashboardPage.h); GET /ws
+// upgrades to a WebSocket that pushes one JSON sample per push interval
+// (DEFAULT_PUSH_MS, "rate <ms>" from the page changes it per client).
+// Clients may send "start [profile]" and "abort"; those are queued for
+// the loop, which runs them through the serial command table.
+//
+// All network work runs in its own task on core 0. The control loop only
+// adds its tick to a shared window under a spinlock (publish) and pops
+// queued commands (nextCommand); it never waits on a socket.
+// Without WIFI_SSID the station opens its own access point. Its password
+// has no default: one in the public source would let anyone in range
+// start the heaters, so the build must supply WIFI_AP_PASS.
+#ifndef WIFI_AP_SSID
+#define WIFI_AP_SSID "ReflowStation"
+#endif
+#ifndef WIFI_SSID
+#ifndef WIFI_AP_PASS
+#error "REFLOW_WIFI needs -DWIFI_AP_PASS=\"...\" for the access point (or WIFI_SSID / WIFI_PASS to join a network)"
+#endif
+static_assert(sizeof(WIFI_AP_PASS) > 8, "WIFI_AP_PASS needs 8+ chars, or the access point would stay open");
+#endif
+
+class WebDashboard {
+public:
+  static constexpr uint8_t  MAX_CLIENTS     = 3;
+  static constexpr uint16_t DEFAULT_PUSH_MS = 500;
+  static constexpr uint16_t MIN_PUSH_MS     = 100;
+  static constexpr uint16_t MAX_PUSH_MS     = 5000;
+  static constexpr uint8_t  CMD_SLOTS       = 4;
+  static constexpr uint8_t  CMD_MAX         = 24;
+
+  void begin(uint8_t taskPriority = 1);
+
+  // Control loop side
+  void publish(const TelemetryFrame& f, uint32_t nowMs);
+  bool nextCommand(char* out, size_t cap);
+  void poll();                               // logs what the network task noted
+
+private:
+  struct Client {
+    bool           used;
+    bool           upgraded;
+    uint16_t       pushMs;
+    uint32_t       lastPushMs;
+    HttpRequest    req;
+    WsReader       ws;
+    SampleAverager avg;
+  };
+
+  static void task_(void* arg);
+  void serve_();
+  void accept_();
+  void read_(uint8_t i);
+  void onRequest_(uint8_t i);
+  void onMessage_(uint8_t i, const char* msg);
+  void sendText_(uint8_t i, const char* text, size_t n);
+  void drop_(uint8_t i);
+
+  Client         clients_[MAX_CLIENTS];
+  portMUX_TYPE   mux_ = portMUX_INITIALIZER_UNLOCKED;
+  SampleAverager window_;                    // loop -> network, under mux_
+
+  char                 addr_[48];
+  std::atomic<bool>    addrReady_{false};
+  std::atomic<uint8_t> connects_{0}, disconnects_{0};
+  bool                 addrLogged_ = false;         // loop side
+  uint8_t              connectsLogged_ = 0, disconnectsLogged_ = 0;
+
+  char                 cmds_[CMD_SLOTS][CMD_MAX];   // network -> loop
+  std::atomic<uint8_t> cmdHead_{0};                 // written by the network task
+  std::atomic<uint8_t> cmdTail_{0};                 // written by the loop
+};
+
+extern WebDashboard dashboard;
@@ -0,0 +1,195 @@
+// WsProtocol.cpp
+#include "WsProtocol.h"
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+
+// ---- HTTP request head ----
+void HttpRequest::reset() {
+  len_ = 0;
+  done_ = error_ = upgrade_ = false;
+  method_ = path_ = "";
+  key_ = nullptr;
+}
+
+bool HttpRequest::feed(uint8_t b) {
+  if (done_ || error_) return done_;
+  if (len_ >= sizeof(buf_) - 1 || b == 0) { error_ = true; return false; }   // NUL would cut the head short
+  buf_[len_++] = (char)b;
+  if (len_ >= 4 && memcmp(buf_ + len_ - 4, "\r\n\r\n", 4) == 0) {
+    buf_[len_] = '\0';
+    parse_();
+    done_ = !error_;
+  }
+  return done_;
+}
+
+// Splits the head in place: request line, then "Name: value" lines
+void HttpRequest::parse_() {
+  char* line = buf_;
+  char* eol = strstr(line, "\r\n");
+  *eol = '\0';
+  char* sp1 = strchr(line, ' ');
+  char* sp2 = sp1 ? strchr(sp1 + 1, ' ') : nullptr;
+  if (!sp1 || !sp2) { error_ = true; return; }
+  *sp1 = *sp2 = '\0';
+  method_ = line;
+  path_ = sp1 + 1;
+
+  for (line = eol + 2; *line; line = eol + 2) {
+    eol = strstr(line, "\r\n");
+    *eol = '\0';
+    char* colon = strchr(line, ':');
+    if (!colon) continue;
+    *colon = '\0';
+    char* v = colon + 1;
+    while (*v == ' ') v++;
+    if (strcasecmp(line, "Upgrade") == 0)               upgrade_ = strcasecmp(v, "websocket") == 0;
+    else if (strcasecmp(line, "Sec-WebSocket-Key") == 0) key_ = v;
+  }
+  if (strcmp(method_, "GET") != 0) upgrade_ = false;
+}
+
+// ---- Handshake ----
+void sha1(const uint8_t* data, size_t n, uint8_t out[20]) {
+  uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+  uint8_t block[64];
+  uint64_t bits = (uint64_t)n * 8;
+  size_t total = ((n + 8) / 64 + 1) * 64;    // message + 0x80 + length, padded
+
+  for (size_t off = 0; off < total; off += 64) {
+    for (size_t i = 0; i < 64; i++) {
+      size_t k = off + i;
+      if (k < n)                   block[i] = data[k];
+      else if (k == n)             block[i] = 0x80;
+      else if (k >= total - 8)     block[i] = (uint8_t)(bits >> (8 * (total - 1 - k)));
+      else                         block[i] = 0;
+    }
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++)
+      w[i] = (uint32_t)block[4 * i] << 24 | (uint32_t)block[4 * i + 1] << 16 |
+             (uint32_t)block[4 * i + 2] << 8 | block[4 * i + 3];
+    for (int i = 16; i < 80; i++) {
+      uint32_t x = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+      w[i] = x << 1 | x >> 31;
+    }
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    for (int i = 0; i < 80; i++) {
+      uint32_t f, k;
+      if (i < 20)      { f = (b & c) | (~b & d);           k = 0x5A827999; }
+      else if (i < 40) { f = b ^ c ^ d;                    k = 0x6ED9EBA1; }
+      else if (i < 60) { f = (b & c) | (b & d) | (c & d);  k = 0x8F1BBCDC; }
+      else             { f = b ^ c ^ d;                    k = 0xCA62C1D6; }
+      uint32_t t = (a << 5 | a >> 27) + f + e + k + w[i];
+      e = d; d = c; c = b << 30 | b >> 2; b = a; a = t;
+    }
+    h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+  }
+  for (int i = 0; i < 20; i++) out[i] = (uint8_t)(h[i / 4] >> (24 - 8 * (i % 4)));
+}
+
+void wsAcceptKey(const char* key, char out[29]) {
+  static const char GUID[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+  static const char B64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  char in[64 + sizeof(GUID)];
+  size_t kn = strnlen(key, 64);
+  memcpy(in, key, kn);
+  memcpy(in + kn, GUID, sizeof(GUID) - 1);
+  uint8_t d[21];                             // digest + a zero pad byte
+  sha1((const uint8_t*)in, kn + sizeof(GUID) - 1, d);
+  d[20] = 0;
+  // 20 bytes -> 27 chars + one '='
+  for (int i = 0, o = 0; i < 21; i += 3) {
+    uint32_t v = (uint32_t)d[i] << 16 | (uint32_t)d[i + 1] << 8 | d[i + 2];
+    out[o++] = B64[v >> 18 & 63];
+    out[o++] = B64[v >> 12 & 63];
+    if (o < 28) out[o++] = B64[v >> 6 & 63];
+    if (o < 28) out[o++] = B64[v & 63];
+  }
+  out[27] = '=';
+  out[28] = '\0';
+}
+
+size_t wsHandshake(const char* key, char* out, size_t cap) {
+  char accept[29];
+  wsAcceptKey(key, accept);
+  int n = snprintf(out, cap,
+                   "HTTP/1.1 101 Switching Protocols\r\n"
+                   "Upgrade: websocket\r\n"
+                   "Connection: Upgrade\r\n"
+                   "Sec-WebSocket-Accept: %s\r\n\r\n", accept);
+  return (n > 0 && (size_t)n < cap) ? n : 0;
+}
+
+// ---- Frames ----
+size_t wsFrame(uint8_t opcode, const void* payload, size_t n, uint8_t* out, size_t cap) {
+  size_t hdr = n < 126 ? 2 : (n <= 0xFFFF ? 4 : 10);
+  if (hdr + n > cap) return 0;
+  out[0] = 0x80 | (opcode & 0x0F);           // FIN, no fragments
+  if (n < 126) {
+    out[1] = (uint8_t)n;
+  } else if (n <= 0xFFFF) {
+    out[1] = 126;
+    out[2] = (uint8_t)(n >> 8);
+    out[3] = (uint8_t)n;
+  } else {
+    out[1] = 127;
+    for (int i = 0; i < 8; i++) out[2 + i] = (uint8_t)((uint64_t)n >> (56 - 8 * i));
+  }
+  if (n) memcpy(out + hdr, payload, n);
+  return hdr + n;
+}
+
+WsReader::Event WsReader::feed(uint8_t b) {
+  switch (state_) {
+    case HDR0:
+      opcode_ = b & 0x0F;
+      // no fragmentation, no binary, no extensions (RSV bits)
+      if (!(b & 0x80) || (b & 0x70) || opcode_ == WS_OP_CONT || opcode_ == WS_OP_BINARY) return WS_ERROR;
+      state_ = HDR1;
+      return WS_MORE;
+
+    case HDR1:
+      if (!(b & 0x80)) return WS_ERROR;      // clients must mask
+      want_ = b & 0x7F;
+      len_ = 0;
+      if (want_ >= 126) { need_ = want_ == 126 ? 2 : 8; want_ = 0; state_ = LEN; }
+      else              { need_ = 4; state_ = MASK; }
+      return WS_MORE;
+
+    case LEN:
+      want_ = want_ << 8 | b;
+      if (--need_ == 0) {
+        if (want_ > WS_MAX_MESSAGE) return WS_ERROR;
+        need_ = 4;
+        state_ = MASK;
+      }
+      return WS_MORE;
+
+    case MASK:
+      mask_[4 - need_] = b;
+      if (--need_ == 0) {
+        if (want_ > WS_MAX_MESSAGE) return WS_ERROR;
+        state_ = PAYLOAD;
+        if (want_ == 0) return finish_();
+      }
+      return WS_MORE;
+
+    case PAYLOAD:
+      msg_[len_] = (char)(b ^ mask_[len_ & 3]);
+      if (++len_ == want_) return finish_();
+      return WS_MORE;
+  }
+  return WS_ERROR;
+}
+
+WsReader::Event WsReader::finish_() {
+  msg_[len_] = '\0';
+  state_ = HDR0;
+  switch (opcode_) {
+    case WS_OP_TEXT:  return WS_MESSAGE;
+    case WS_OP_PING:  return WS_PING;
+    case WS_OP_CLOSE: return WS_CLOSE;
+    default:          return WS_MORE;        // pong: nothing to do
+  }
+}
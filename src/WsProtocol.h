@@ -0,0 +1,77 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Server side of the dashboard's HTTP / WebSocket (RFC 6455) exchange,
+// without sockets: received bytes go in, bytes to send come out, so the
+// same code runs in the ESP32 network task and behind a loopback socket
+// in test_ws_protocol.
+// Scope is what the dashboard needs: one GET per connection (the page or
+// an upgrade), unfragmented text messages up to WS_MAX_MESSAGE bytes,
+// ping/pong and close. Anything else is an error and the caller closes.
+// Nothing here depends on Arduino.
+#define WS_MAX_MESSAGE   125       // fits a control frame too
+#define HTTP_MAX_REQUEST 768
+
+enum WsOpcode : uint8_t {
+  WS_OP_CONT = 0x0, WS_OP_TEXT = 0x1, WS_OP_BINARY = 0x2,
+  WS_OP_CLOSE = 0x8, WS_OP_PING = 0x9, WS_OP_PONG = 0xA
+};
+
+// Request head reader: feed() bytes until it returns true (blank line seen)
+class HttpRequest {
+public:
+  void reset();
+  bool feed(uint8_t b);
+  bool done()  const { return done_; }
+  bool error() const { return error_; }      // too long or malformed
+
+  const char* method() const { return method_; }
+  const char* path()   const { return path_; }
+  bool wantsWebSocket() const { return upgrade_ && key_; }
+  const char* wsKey()  const { return key_; }
+
+private:
+  void parse_();
+
+  char     buf_[HTTP_MAX_REQUEST];
+  uint16_t len_ = 0;
+  bool     done_ = false, error_ = false, upgrade_ = false;
+  const char* method_ = "";
+  const char* path_ = "";
+  const char* key_ = nullptr;
+};
+
+// Sec-WebSocket-Accept for a client key: base64(SHA-1(key + GUID)), 28 chars + NUL
+void wsAcceptKey(const char* key, char out[29]);
+// 101 Switching Protocols response; returns its length, 0 if cap is too small
+size_t wsHandshake(const char* key, char* out, size_t cap);
+// One unmasked server frame; returns bytes written, 0 if cap is too small
+size_t wsFrame(uint8_t opcode, const void* payload, size_t n, uint8_t* out, size_t cap);
+
+void sha1(const uint8_t* data, size_t n, uint8_t out[20]);
+
+// Incremental reader for client frames (always masked)
+class WsReader {
+public:
+  enum Event : uint8_t { WS_MORE, WS_MESSAGE, WS_PING, WS_CLOSE, WS_ERROR };
+
+  void  reset() { state_ = HDR0; }
+  Event feed(uint8_t b);
+
+  // Payload of the last WS_MESSAGE / WS_PING, NUL terminated
+  const char* message() const { return msg_; }
+  uint16_t    length()  const { return len_; }
+
+private:
+  enum State : uint8_t { HDR0, HDR1, LEN, MASK, PAYLOAD };
+  Event finish_();
+
+  State    state_ = HDR0;
+  uint8_t  opcode_ = 0;
+  uint8_t  need_ = 0;          // extended length / mask bytes still due
+  uint64_t want_ = 0;
+  uint16_t len_ = 0;
+  uint8_t  mask_[4];
+  char     msg_[WS_MAX_MESSAGE + 1];
+};
@@ -0,0 +1,24 @@
+// thermProf.cpp - recorded plate trace, stored as linear segments
+#include "thermProf.h"
+
+// {first, last (centi-°C), sample count}; 4010 samples in 46 segments
+const ThermProfSegment THERM_PROF_SEGMENTS[] = {
+  { 2300,  2755,  11}, { 2400,  2829,   7}, { 2500,  2958,  12},
+  { 2600,  3062,  13}, { 2700,  3158,  12}, { 2800,  3050,   6},
+  { 3000,  3214,   4}, { 2900,  2650,   3}, { 3100,  3544,   9},
+  { 3200,  3650,  10}, { 3300,  3750,  10}, { 3400,  3850,  10},
+  { 3500,  4000,  57}, { 4007,  4500,  74}, { 4508,  5000,  60},
+  { 5008,  5500,  63}, { 5505,  6000, 110}, { 6007,  6500,  73},
+  { 6505,  7000, 111}, { 7004,  7500, 119}, { 7504,  8000, 137},
+  { 8004,  8500, 118}, { 8505,  9000, 109}, { 9004, 10000, 276},
+  {10003, 10500, 156}, {10506, 11000,  77}, {11004, 11500, 121},
+  {11504, 12000, 116}, {12004, 12500, 142}, {12503, 13000, 157},
+  {13006, 13500,  87}, {13504, 14000, 128}, {14005, 14500,  98},
+  {14507, 15000,  72}, {15003, 15500, 172}, {15508, 16000,  66},
+  {16004, 16500, 113}, {16514, 17000,  37}, {17005, 17500, 104},
+  {17508, 18000,  62}, {18006, 18500,  79}, {18505, 19000, 102},
+  {19004, 19500, 113}, {19501, 20000, 530}, {20017, 20500,  30},
+  {20514, 20972,  34}
+};
+const uint8_t THERM_PROF_SEGMENT_COUNT = sizeof(THERM_PROF_SEGMENTS) / sizeof(THERM_PROF_SEGMENTS[0]);
+const uint16_t THERM_PROF_LENGTH = 4010;
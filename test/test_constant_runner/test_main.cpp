@@ -0,0 +1,138 @@
+// ConstantRunner on its own: the setpoint ramp from the coldest plate, the
+// hold timer that waits for the plates (REACHED_BAND_C, or the reach
+// timeout), the step for lower targets, and retarget() keeping the time
+// already held.
+#include <unity.h>
+#include "ConstantRunner.h"
+
+static const uint32_t T0 = 5000;
+
+static uint32_t at(float secs) { return T0 + (uint32_t)(secs * 1000.0f); }
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_ramps_from_the_coldest_plate(void) {
+  ConstantRunner r;
+  bool finished;
+  // plates at 40 / 48: the station passes the coldest as the start
+  r.begin(200.0f, 2.0f, 60, 40.0f, T0);
+  TEST_ASSERT_TRUE(r.ramping());
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 40.0f, r.update(at(0), finished, 40.0f, 48.0f));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 60.0f, r.update(at(10), finished, 55.0f, 62.0f));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 150.0f, r.update(at(55), finished, 140.0f, 148.0f));
+  TEST_ASSERT_TRUE(r.ramping());
+  // 80 s in: at the target and no further
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 200.0f, r.update(at(80), finished, 185.0f, 192.0f));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 200.0f, r.update(at(200), finished, 190.0f, 195.0f));
+  TEST_ASSERT_FALSE(r.ramping());
+  TEST_ASSERT_FALSE(finished);
+
+  // rampCps = 0 steps straight to the target
+  r.begin(200.0f, 0.0f, 60, 40.0f, T0);
+  TEST_ASSERT_FALSE(r.ramping());
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 200.0f, r.update(at(0), finished, 40.0f, 48.0f));
+}
+
+void test_timer_starts_inside_the_band(void) {
+  ConstantRunner r;
+  bool finished;
+  r.begin(150.0f, 5.0f, 30, 50.0f, T0);
+  r.update(at(20), finished, 120.0f, 130.0f);         // ramp over at 20 s
+  TEST_ASSERT_FALSE(r.ramping());
+  // the hotter plate is there, the coldest is not: still waiting
+  r.update(at(25), finished, 150.0f - ConstantRunner::REACHED_BAND_C - 0.5f, 151.0f);
+  TEST_ASSERT_FALSE(r.timing());
+  TEST_ASSERT_EQUAL(0, r.heldSec(at(25)));
+  TEST_ASSERT_EQUAL(30, r.remainingSec(at(25)));     // the full hold until it starts
+
+  r.update(at(31), finished, 150.0f - ConstantRunner::REACHED_BAND_C, 151.0f);
+  TEST_ASSERT_TRUE(r.timing());
+  TEST_ASSERT_FALSE(r.reachTimedOut());
+  TEST_ASSERT_EQUAL(31, r.reachSec());
+  TEST_ASSERT_EQUAL(10, r.remainingSec(at(51)));
+  TEST_ASSERT_FALSE(finished);
+  r.update(at(61), finished, 149.0f, 151.0f);
+  TEST_ASSERT_TRUE(finished);
+}
+
+void test_timer_starts_on_reach_timeout(void) {
+  ConstantRunner r;
+  bool finished;
+  r.begin(250.0f, 0.0f, 30, 100.0f, T0);
+  // a plate that stalls 10 C short
+  r.update(at(0), finished, 240.0f, 240.0f);
+  r.update(at(ConstantRunner::REACH_TIMEOUT_S - 1), finished, 240.0f, 240.0f);
+  TEST_ASSERT_FALSE(r.timing());
+  r.update(at(ConstantRunner::REACH_TIMEOUT_S), finished, 240.0f, 240.0f);
+  TEST_ASSERT_TRUE(r.timing());
+  TEST_ASSERT_TRUE(r.reachTimedOut());
+  TEST_ASSERT_EQUAL(ConstantRunner::REACH_TIMEOUT_S, r.reachSec());
+}
+
+void test_lower_target_steps_and_waits_for_the_hottest_plate(void) {
+  ConstantRunner r;
+  bool finished;
+  // plates at 180 / 190, target 120: no ramp down, the setpoint steps
+  r.begin(120.0f, 2.0f, 20, 180.0f, T0);
+  TEST_ASSERT_FALSE(r.ramping());
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 120.0f, r.update(at(0), finished, 180.0f, 190.0f));
+  // the coldest plate is in the band, the hottest is not
+  r.update(at(30), finished, 121.0f, 125.0f);
+  TEST_ASSERT_FALSE(r.timing());
+  r.update(at(40), finished, 118.0f, 120.0f + ConstantRunner::REACHED_BAND_C);
+  TEST_ASSERT_TRUE(r.timing());
+  TEST_ASSERT_EQUAL(40, r.reachSec());
+  r.update(at(60), finished, 118.0f, 121.0f);
+  TEST_ASSERT_TRUE(finished);
+}
+
+void test_retarget_keeps_the_time_held(void) {
+  ConstantRunner r;
+  bool finished;
+  r.begin(150.0f, 0.0f, 60, 25.0f, T0);
+  r.update(at(10), finished, 149.0f, 151.0f);        // timing from 10 s
+  TEST_ASSERT_TRUE(r.timing());
+  TEST_ASSERT_EQUAL(25, r.heldSec(at(35)));
+
+  // Higher: ramps on from the current setpoint, timer paused
+  r.retarget(170.0f, 1.0f, at(35));
+  TEST_ASSERT_FALSE(r.timing());
+  TEST_ASSERT_EQUAL(25, r.heldSec(at(35)));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 160.0f, r.update(at(45), finished, 150.0f, 152.0f));
+  TEST_ASSERT_EQUAL(25, r.heldSec(at(45)));
+  TEST_ASSERT_EQUAL(35, r.remainingSec(at(45)));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 170.0f, r.update(at(55), finished, 160.0f, 165.0f));
+  TEST_ASSERT_FALSE(r.timing());
+
+  // Resumes in the new band, counting on from 25 s
+  r.update(at(60), finished, 169.0f, 171.0f);
+  TEST_ASSERT_TRUE(r.timing());
+  TEST_ASSERT_EQUAL(25, r.reachSec());                // from the retarget
+  TEST_ASSERT_EQUAL(45, r.heldSec(at(80)));
+  r.update(at(94), finished, 169.0f, 171.0f);
+  TEST_ASSERT_FALSE(finished);
+  r.update(at(95), finished, 169.0f, 171.0f);
+  TEST_ASSERT_TRUE(finished);
+
+  // Lower: steps, and the held time still carries over
+  r.begin(150.0f, 0.0f, 60, 25.0f, T0);
+  r.update(at(10), finished, 149.0f, 151.0f);
+  r.retarget(130.0f, 2.0f, at(30));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 130.0f, r.update(at(30), finished, 149.0f, 151.0f));
+  TEST_ASSERT_FALSE(r.timing());
+  TEST_ASSERT_EQUAL(20, r.heldSec(at(40)));
+  r.update(at(50), finished, 128.0f, 131.0f);
+  TEST_ASSERT_TRUE(r.timing());
+  TEST_ASSERT_EQUAL(30, r.heldSec(at(60)));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_ramps_from_the_coldest_plate);
+  RUN_TEST(test_timer_starts_inside_the_band);
+  RUN_TEST(test_timer_starts_on_reach_timeout);
+  RUN_TEST(test_lower_target_steps_and_waits_for_the_hottest_plate);
+  RUN_TEST(test_retarget_keeps_the_time_held);
+  return UNITY_END();
+}
@@ -0,0 +1,148 @@
+// CoolingController on a simulated plate whose fan cools less than the
+// model says (the PI term has to find the rest), its spin floor and
+// anti-windup; FanModelFit recovering a known fan model from the cooling
+// test's duty steps.
+#include <unity.h>
+#include <math.h>
+#include "HostArduino.h"
+#include "CoolingController.h"
+
+// The plate the fan really cools: weaker than DEFAULT_FAN_MODEL
+static const FanModel TRUE_FAN = {0.0020f, 0.0040f, 25.0f, 20, {0, 0, 0, 0, 0}};
+
+// dt seconds of Newton cooling at a fan duty, in 10 ms steps
+static float cool(const FanModel& m, float tempC, uint8_t duty, float dt) {
+  for (int n = (int)lroundf(dt * 100.0f); n > 0; n--)
+    tempC -= 0.01f * (m.lossCoef + fanLossAt(m, duty)) * (tempC - m.ambientC);
+  return tempC;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_feed_forward_is_the_model_inverse(void) {
+  CoolingController c;
+  c.begin(DEFAULT_FAN_MODEL);
+  // 1 C/s at 200 C: (1/175 - 0.0017) / 0.0055 of the span above the 20% floor
+  float u = (1.0f / 175.0f - DEFAULT_FAN_MODEL.lossCoef) / DEFAULT_FAN_MODEL.fanLossCoef;
+  uint8_t want = (uint8_t)(20.0f + u * 80.0f + 0.5f);
+  TEST_ASSERT_EQUAL(want, c.update(1000, -1.0f, -1.0f, 200.0f));   // on rate: no trim
+  // slower than asked pushes the duty up, faster pulls it down
+  c.reset();
+  TEST_ASSERT_GREATER_THAN(want, c.update(1000, -1.0f, -0.8f, 200.0f));
+  c.reset();
+  TEST_ASSERT_LESS_THAN(want, c.update(1000, -1.0f, -1.2f, 200.0f));
+}
+
+void test_tracks_a_slope_with_a_weak_fan(void) {
+  CoolingController c;
+  c.begin(DEFAULT_FAN_MODEL);
+  const float slope = -0.6f;
+  float temp = 230.0f, prev = temp;
+  uint8_t duty = 0;
+  float worst = 0.0f;
+  uint32_t now = 1000;
+  for (int tick = 0; tick < 1200; tick++) {       // 120 s at 100 ms
+    float rate = (temp - prev) / 0.1f;
+    prev = temp;
+    duty = c.update(now, slope, rate, temp);
+    temp = cool(TRUE_FAN, temp, duty, 0.1f);
+    now += 100;
+    if (tick >= 300) worst = max(worst, fabsf(rate - slope));   // after 30 s
+  }
+  // the model's duty alone cools too slowly on this fan; the PI term closes it
+  char msg[64];
+  snprintf(msg, sizeof(msg), "worst rate error %.3f C/s, end %.1f C at %u%%", worst, temp, duty);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_LESS_THAN(0.03f, worst);
+  TEST_ASSERT_FLOAT_WITHIN(2.0f, 230.0f + slope * 120.0f, temp);
+}
+
+void test_never_commands_a_stalling_duty(void) {
+  CoolingController c;
+  c.begin(DEFAULT_FAN_MODEL);
+  const uint8_t floor = DEFAULT_FAN_MODEL.minSpinPct;
+  // natural loss alone gives ~0.30 C/s at 200 C, so a 0.3 C/s request
+  // sits at the floor and a faster plate asks for less than that
+  TEST_ASSERT_EQUAL(floor, c.update(1000, -0.3f, -0.3f, 200.0f));
+  c.reset();
+  TEST_ASSERT_EQUAL(floor, c.update(1000, -0.3f, -0.5f, 200.0f));   // rounds up to spinning
+  c.reset();
+  TEST_ASSERT_EQUAL(0, c.update(1000, -0.3f, -0.6f, 200.0f));       // down to off
+  // nothing to cool, or already at ambient
+  TEST_ASSERT_EQUAL(0, c.update(1100, 0.5f, 0.5f, 200.0f));
+  TEST_ASSERT_EQUAL(0, c.update(1200, -1.0f, 0.0f, 25.5f));
+
+  for (int i = 0; i < 2000; i++) {
+    float slope = -(i % 40) * 0.05f, rate = -((i * 7) % 50) * 0.04f, temp = 30.0f + (i % 23) * 9.0f;
+    uint8_t d = c.update(1300 + i * 100, slope, rate, temp);
+    TEST_ASSERT_TRUE(d == 0 || (d >= floor && d <= 100));
+  }
+}
+
+void test_saturation_does_not_wind_up(void) {
+  CoolingController c;
+  c.begin(DEFAULT_FAN_MODEL);
+  // 3 C/s from 100 C is beyond the fan: full duty for a minute
+  uint32_t now = 1000;
+  for (int i = 0; i < 600; i++, now += 100) TEST_ASSERT_EQUAL(100, c.update(now, -3.0f, -0.4f, 100.0f));
+  // Back to a reachable request on rate: the feed-forward duty, no stored push
+  CoolingController fresh;
+  fresh.begin(DEFAULT_FAN_MODEL);
+  uint8_t ff = fresh.update(1000, -0.3f, -0.3f, 100.0f);
+  TEST_ASSERT_UINT_WITHIN(1, ff, c.update(now, -0.3f, -0.3f, 100.0f));
+}
+
+// ---- Identification ----
+
+// Runs a whole cooling test on a plate with `truth`'s losses; the tach
+// reads 30 rpm per % above the spin floor
+static bool fitFrom(const FanModel& truth, float startC, FanModel& out) {
+  FanModelFit fit;
+  uint32_t now = 1000;
+  float temp = startC;
+  fit.begin(now, truth.ambientC);
+  uint8_t duty = 0;
+  while (!fit.done()) {
+    uint16_t rpm = duty > truth.minSpinPct ? duty * 30 : 0;
+    duty = fit.update(now, temp, rpm);
+    temp = cool(truth, temp, duty, 0.1f);
+    now += 100;
+  }
+  return fit.result(out);
+}
+
+void test_fit_recovers_the_fan_model(void) {
+  FanModel m = {};
+  TEST_ASSERT_TRUE(fitFrom(TRUE_FAN, 220.0f, m));
+  TEST_ASSERT_FLOAT_WITHIN(0.02f * TRUE_FAN.lossCoef, TRUE_FAN.lossCoef, m.lossCoef);
+  TEST_ASSERT_FLOAT_WITHIN(0.03f * TRUE_FAN.fanLossCoef, TRUE_FAN.fanLossCoef, m.fanLossCoef);
+  TEST_ASSERT_UINT_WITHIN(1, TRUE_FAN.minSpinPct, m.minSpinPct);
+  TEST_ASSERT_EQUAL_FLOAT(TRUE_FAN.ambientC, m.ambientC);
+  // tach at the end of the 20..100% steps; 20% is the floor, not spinning
+  static const uint16_t rpm[FAN_RPM_POINTS] = {0, 1200, 1800, 2400, 3000};
+  for (int i = 0; i < FAN_RPM_POINTS; i++) TEST_ASSERT_EQUAL(rpm[i], m.rpmAt[i]);
+
+  // A different floor and strength come out as well
+  const FanModel strong = {0.0015f, 0.0090f, 22.0f, 35, {0, 0, 0, 0, 0}};
+  TEST_ASSERT_TRUE(fitFrom(strong, 230.0f, m));
+  TEST_ASSERT_FLOAT_WITHIN(0.03f * strong.fanLossCoef, strong.fanLossCoef, m.fanLossCoef);
+  TEST_ASSERT_UINT_WITHIN(1, strong.minSpinPct, m.minSpinPct);
+}
+
+void test_fit_needs_a_hot_plate(void) {
+  FanModel m = DEFAULT_FAN_MODEL;
+  TEST_ASSERT_FALSE(fitFrom(TRUE_FAN, TRUE_FAN.ambientC + 4.0f, m));
+  TEST_ASSERT_EQUAL_FLOAT(DEFAULT_FAN_MODEL.fanLossCoef, m.fanLossCoef);   // untouched
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_feed_forward_is_the_model_inverse);
+  RUN_TEST(test_tracks_a_slope_with_a_weak_fan);
+  RUN_TEST(test_never_commands_a_stalling_duty);
+  RUN_TEST(test_saturation_does_not_wind_up);
+  RUN_TEST(test_fit_recovers_the_fan_model);
+  RUN_TEST(test_fit_needs_a_hot_plate);
+  return UNITY_END();
+}
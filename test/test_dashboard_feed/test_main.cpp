@@ -0,0 +1,107 @@
+// DashboardFeed: what one push interval of control ticks turns into on the
+// wire - averaged temperatures and duties, the latest time / setpoint /
+// mode, OR-ed flags - and the JSON the page parses.
+#include <unity.h>
+#include <string.h>
+#include "DashboardFeed.h"
+#include "Telemetry.h"
+
+static DashSample sample(uint32_t tMs, float temp, float duty, uint8_t mode, uint8_t flags) {
+  DashSample s;
+  s.tMs = tMs;
+  s.tFront = temp;
+  s.tBack = temp - 2.0f;
+  s.setpoint = temp + 5.0f;
+  s.dutyFront = duty;
+  s.dutyBack = duty / 2;
+  s.fanPct = duty > 0 ? 0.0f : 100.0f;
+  s.mode = mode;
+  s.flags = flags;
+  return s;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_averages_the_window(void) {
+  SampleAverager a;
+  TEST_ASSERT_TRUE(a.empty());
+  a.add(sample(1000, 100.0f, 80.0f, 1, TLM_RUNNING));
+  a.add(sample(1100, 102.0f, 40.0f, 1, TLM_RUNNING | TLM_FAN_ON));
+  a.add(sample(1200, 104.0f, 0.0f, 2, TLM_RUNNING | TLM_COOLING));
+  TEST_ASSERT_EQUAL(3, a.count());
+
+  DashSample r = a.take();
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 102.0f, r.tFront);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 100.0f, r.tBack);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 40.0f, r.dutyFront);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 20.0f, r.dutyBack);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 100.0f / 3, r.fanPct);
+  // time, setpoint and mode are the newest tick's
+  TEST_ASSERT_EQUAL(1200, r.tMs);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 109.0f, r.setpoint);
+  TEST_ASSERT_EQUAL(2, r.mode);
+  // a flag seen on any tick survives the window
+  TEST_ASSERT_EQUAL_HEX8(TLM_RUNNING | TLM_FAN_ON | TLM_COOLING, r.flags);
+
+  // take() starts a new window
+  TEST_ASSERT_TRUE(a.empty());
+  a.add(sample(1300, 50.0f, 10.0f, 0, 0));
+  r = a.take();
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 50.0f, r.tFront);
+  TEST_ASSERT_EQUAL_HEX8(0, r.flags);
+}
+
+void test_merging_windows(void) {
+  SampleAverager a, b, empty;
+  a.add(sample(1000, 100.0f, 60.0f, 1, TLM_SENSOR_ERR));
+  b.add(sample(1100, 110.0f, 20.0f, 1, 0));
+  b.add(sample(1200, 120.0f, 10.0f, 3, TLM_FAN_STALL));
+  a.add(b);
+  a.add(empty);                      // nothing to merge
+  TEST_ASSERT_EQUAL(3, a.count());
+  DashSample r = a.take();
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 110.0f, r.tFront);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 30.0f, r.dutyFront);
+  TEST_ASSERT_EQUAL(1200, r.tMs);
+  TEST_ASSERT_EQUAL(3, r.mode);
+  TEST_ASSERT_EQUAL_HEX8(TLM_SENSOR_ERR | TLM_FAN_STALL, r.flags);
+
+  // into an empty window the other one is taken as is
+  empty.add(b);
+  TEST_ASSERT_EQUAL(2, empty.count());
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 115.0f, empty.take().tFront);
+}
+
+void test_json(void) {
+  SampleAverager a;
+  a.add(sample(12345, 180.25f, 72.4f, 2, TLM_RUNNING));
+  a.add(sample(12445, 180.25f, 72.4f, 2, TLM_FAN_ON));
+  char out[160];
+  size_t n = dashJson(a.take(), 2, out, sizeof(out));
+  static const char want[] =
+      "{\"t\":12.4,\"m\":2,\"f\":180.2,\"b\":178.2,\"sp\":185.2,"
+      "\"df\":72,\"db\":36,\"fan\":0,\"fl\":5,\"n\":2}";
+  TEST_ASSERT_EQUAL_STRING(want, out);
+  TEST_ASSERT_EQUAL(strlen(want), n);
+}
+
+void test_json_too_small(void) {
+  DashSample s = sample(1000, 25.0f, 0.0f, 0, 0);
+  char out[160];
+  size_t n = dashJson(s, 1, out, sizeof(out));
+  TEST_ASSERT_TRUE(n > 0);
+  // one byte short of the NUL: nothing half-written is reported
+  TEST_ASSERT_EQUAL(0, dashJson(s, 1, out, n));
+  TEST_ASSERT_EQUAL(0, dashJson(s, 1, out, 8));
+  TEST_ASSERT_EQUAL(n, dashJson(s, 1, out, n + 1));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_averages_the_window);
+  RUN_TEST(test_merging_windows);
+  RUN_TEST(test_json);
+  RUN_TEST(test_json_too_small);
+  return UNITY_END();
+}
@@ -0,0 +1,123 @@
+// FanTach against synthetic pulse trains: 2 pulses per revolution,
+// update() every 10 ms as the station loop does. Presence comes from the
+// board's tach pin, so a wired tach that never pulses is a stall.
+#include <unity.h>
+#include "HostArduino.h"
+#include "FanTach.h"
+
+static const uint8_t TACH_PIN = 27;
+static uint32_t tUs;
+
+// `secs` of edges at rpm (0 = none), optionally with bounce after each edge
+static void run(FanTach& t, float secs, float rpm, uint8_t duty, uint16_t expected, bool bounce = false) {
+  double period = rpm > 0 ? 60e6 / (rpm * 2) : 1e18;
+  double next = tUs + period;
+  uint32_t end = tUs + (uint32_t)(secs * 1e6f);
+  while (tUs < end) {
+    tUs += 100;
+    if (tUs >= next) {
+      t.onEdge(tUs);
+      if (bounce) { t.onEdge(tUs + 40); t.onEdge(tUs + 700); t.onEdge(tUs + 1900); }
+      next += period;
+    }
+    if (tUs % 10000 == 0) t.update(tUs / 1000, duty, expected);
+  }
+}
+
+void setUp(void) { tUs = 1000000; }
+void tearDown(void) {}
+
+void test_no_pin_is_never_judged(void) {
+  FanTach t;
+  t.begin(-1);
+  TEST_ASSERT_FALSE(t.present());
+  run(t, 10, 0, 100, 2400);
+  TEST_ASSERT_EQUAL(FanTach::TACH_NONE, t.health());
+  TEST_ASSERT_FALSE(t.stalled());
+}
+
+// The old rule treated "no pulses yet" as "no tach" and never faulted
+void test_wired_tach_without_pulses_stalls(void) {
+  FanTach t;
+  t.begin(TACH_PIN);
+  TEST_ASSERT_TRUE(t.present());
+  TEST_ASSERT_FALSE(t.pulsed());
+  run(t, 2, 0, 0, 0);
+  TEST_ASSERT_EQUAL(FanTach::TACH_OK, t.health());   // not driven: nothing to judge
+  run(t, 4.5, 0, 100, 2400);
+  TEST_ASSERT_FALSE(t.stalled());                    // spin-up grace + stall time
+  run(t, 1, 0, 100, 2400);
+  TEST_ASSERT_TRUE(t.stalled());
+  TEST_ASSERT_FALSE(t.pulsed());
+}
+
+void test_rpm_from_pulse_train(void) {
+  FanTach t;
+  t.begin(TACH_PIN);
+  run(t, 3, 2400, 100, 2400);
+  TEST_ASSERT_UINT_WITHIN(100, 2400, t.rpm());
+  TEST_ASSERT_EQUAL(FanTach::TACH_OK, t.health());
+  run(t, 3, 2400, 100, 2400, true);
+  TEST_ASSERT_UINT_WITHIN(100, 2400, t.rpm());       // bounce is filtered
+}
+
+void test_stall_and_recovery(void) {
+  FanTach t;
+  t.begin(TACH_PIN);
+  run(t, 4, 1500, 60, 1500);
+  TEST_ASSERT_EQUAL(FanTach::TACH_OK, t.health());
+  run(t, 2, 0, 60, 1500);
+  TEST_ASSERT_FALSE(t.stalled());                    // window + STALL_MS not yet over
+  run(t, 2, 0, 60, 1500);
+  TEST_ASSERT_TRUE(t.stalled());
+  run(t, 2, 1500, 60, 1500);
+  TEST_ASSERT_EQUAL(FanTach::TACH_OK, t.health());
+}
+
+void test_slow_fan_degrades_only_when_calibrated(void) {
+  FanTach t;
+  t.begin(TACH_PIN);
+  run(t, 4, 700, 60, 1500);
+  TEST_ASSERT_EQUAL(FanTach::TACH_OK, t.health());
+  run(t, 4, 700, 60, 1500);
+  TEST_ASSERT_EQUAL(FanTach::TACH_DEGRADED, t.health());
+  run(t, 3, 700, 60, 0);
+  TEST_ASSERT_EQUAL(FanTach::TACH_OK, t.health());
+}
+
+void test_below_spin_floor_is_not_judged(void) {
+  FanTach t;
+  t.begin(TACH_PIN);
+  t.setSpinFloor(30);
+  run(t, 8, 0, 25, 900);
+  TEST_ASSERT_EQUAL(FanTach::TACH_OK, t.health());
+  run(t, 6, 0, 35, 900);
+  TEST_ASSERT_TRUE(t.stalled());
+}
+
+// Edges through the attached interrupt, timed by micros()
+void test_edges_through_the_isr(void) {
+  FanTach t;
+  t.begin(TACH_PIN);
+  hostAdvanceMs(1000);                               // millis() 0 reads as "no window yet"
+  t.update(millis(), 100);
+  for (int i = 0; i < 100; i++) {
+    hostAdvanceUs(12500);                            // 2400 rpm at 2 ppr
+    TEST_ASSERT_TRUE(hostFireInterrupt(TACH_PIN));
+  }
+  t.update(millis(), 100);
+  TEST_ASSERT_TRUE(t.pulsed());
+  TEST_ASSERT_UINT_WITHIN(50, 2400, t.rpm());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_no_pin_is_never_judged);
+  RUN_TEST(test_wired_tach_without_pulses_stalls);
+  RUN_TEST(test_rpm_from_pulse_train);
+  RUN_TEST(test_stall_and_recovery);
+  RUN_TEST(test_slow_fan_degrades_only_when_calibrated);
+  RUN_TEST(test_below_spin_floor_is_not_judged);
+  RUN_TEST(test_edges_through_the_isr);
+  return UNITY_END();
+}
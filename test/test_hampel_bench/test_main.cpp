@@ -0,0 +1,94 @@
+// Host per-sample cost of the Hampel filter against a sort-per-sample
+// reference, window 3..15. Host timings only rank the two; the numbers on
+// the target come from [env:bench].
+#include <unity.h>
+#include <chrono>
+#include <vector>
+#include "HampelFilter.h"
+
+static const int SAMPLES = 200000;
+static std::vector<uint16_t> input;
+
+// Straightforward Hampel: sort the window, sort the deviations
+class NaiveHampel {
+public:
+  explicit NaiveHampel(uint8_t n, float k = 3.0f) : n_(n), k_(k) {}
+  uint16_t filter(uint16_t x) {
+    win_.push_back(x);
+    if (win_.size() > n_) win_.erase(win_.begin());
+    if (win_.size() < n_) return x;
+    std::vector<uint16_t> s(win_);
+    std::sort(s.begin(), s.end());
+    uint16_t med = s[n_ / 2];
+    std::vector<uint16_t> d;
+    for (uint16_t v : s) d.push_back(v > med ? v - med : med - v);
+    std::sort(d.begin(), d.end());
+    float dev = x > med ? float(x - med) : float(med - x);
+    return (dev > k_ * 1.4826f * d[n_ / 2] && dev > 1.0f) ? med : x;
+  }
+private:
+  uint8_t n_;
+  float k_;
+  std::vector<uint16_t> win_;
+};
+
+template <class F>
+static double nsPerSample(F& f, uint32_t& sink) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint16_t x : input) sink += f.filter(x);
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() / input.size();
+}
+
+void setUp(void) {
+  if (!input.empty()) return;
+  uint32_t s = 7;
+  for (int i = 0; i < SAMPLES; i++) {
+    s = s * 1664525u + 1013904223u;
+    uint16_t x = 1800 + (i / 64) % 400 + (s >> 16) % 7;
+    if ((s >> 8) % 50 == 0) x += 700;   // 2 % spikes
+    input.push_back(x);
+  }
+}
+
+void tearDown(void) {}
+
+// Same decisions as the reference on every sample, for every window
+void test_matches_reference(void) {
+  for (uint8_t n = 3; n <= 15; n += 2) {
+    HampelFilter<15> f;
+    f.configure(n);
+    NaiveHampel ref(n);
+    for (int i = 0; i < 20000; i++) {
+      uint16_t a = f.filter(input[i]), b = ref.filter(input[i]);
+      if (a != b) {
+        char msg[64];
+        snprintf(msg, sizeof(msg), "window %u sample %d: %u vs %u", n, i, a, b);
+        TEST_FAIL_MESSAGE(msg);
+      }
+    }
+  }
+}
+
+void test_per_sample_cost(void) {
+  uint32_t sink = 0;
+  char msg[96];
+  for (uint8_t n = 3; n <= 15; n += 4) {
+    HampelFilter<15> f;
+    f.configure(n);
+    NaiveHampel ref(n);
+    double fast = nsPerSample(f, sink);
+    double slow = nsPerSample(ref, sink);
+    snprintf(msg, sizeof(msg), "window %2u: %.1f ns/sample (sorting reference %.1f ns)", n, fast, slow);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE_MESSAGE(fast < slow, msg);
+  }
+  TEST_ASSERT_NOT_EQUAL(0, sink);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_reference);
+  RUN_TEST(test_per_sample_cost);
+  return UNITY_END();
+}
@@ -0,0 +1,110 @@
+// Spike injection into the Hampel filter the NTC channels run on raw ADC codes
+#include <unity.h>
+#include "HampelFilter.h"
+#include "NtcSensor.h"
+
+static uint32_t seed;
+
+static int noise(int amp) {
+  seed = seed * 1664525u + 1013904223u;
+  return (int)((seed >> 16) % (2 * amp + 1)) - amp;
+}
+
+// Slow ramp with +-3 LSB of noise, like a heating plate on the 12-bit ADC
+static uint16_t clean(int i) {
+  return (uint16_t)(1800 + i / 8 + noise(3));
+}
+
+void setUp(void) { seed = 1; }
+void tearDown(void) {}
+
+void test_isolated_spikes_are_replaced(void) {
+  HampelFilter<15> f;
+  f.configure(7);
+  int injected = 0, passed = 0, quiet = 0, maxErr = 0, maxQuietErr = 0;
+  for (int i = 0; i < 4000; i++) {
+    uint16_t x = clean(i);
+    bool spike = i >= 7 && i % 37 == 0;
+    uint16_t in = spike ? (uint16_t)(x + (i & 1 ? 600 : -600)) : x;
+    uint16_t out = f.filter(in);
+    if (spike) {
+      injected++;
+      maxErr = max(maxErr, abs((int)out - (int)x));
+    } else {
+      quiet++;
+      if (out == in) passed++;
+      maxQuietErr = max(maxQuietErr, abs((int)out - (int)in));
+    }
+  }
+  TEST_ASSERT_EQUAL(injected, (int)f.replaced() - (quiet - passed));
+  TEST_ASSERT_LESS_OR_EQUAL(8, maxErr);                 // replaced by the local median
+  // Quantised noise trips the MAD test now and then; the median it
+  // substitutes stays within the noise band
+  TEST_ASSERT_GREATER_OR_EQUAL(quiet * 95 / 100, passed);
+  TEST_ASSERT_LESS_OR_EQUAL(6, maxQuietErr);
+}
+
+// Up to half the window of back-to-back spikes is still rejected
+void test_spike_burst_below_half_window(void) {
+  HampelFilter<15> f;
+  f.configure(7);
+  for (int i = 0; i < 50; i++) f.filter(clean(i));
+  uint32_t before = f.replaced();
+  for (int i = 0; i < 3; i++) {
+    uint16_t out = f.filter(4000);
+    TEST_ASSERT_LESS_THAN(1900, out);
+  }
+  TEST_ASSERT_EQUAL_UINT32(before + 3, f.replaced());
+}
+
+// A real step is held back by at most half a window, then followed
+void test_step_passes_after_half_window(void) {
+  HampelFilter<15> f;
+  f.configure(7);
+  for (int i = 0; i < 50; i++) f.filter(2000);
+  uint16_t out = 0;
+  for (int i = 0; i < 4; i++) out = f.filter(2300);
+  TEST_ASSERT_EQUAL_UINT16(2300, out);
+}
+
+void test_median_mode_with_k_zero(void) {
+  HampelFilter<15> f;
+  f.configure(5, 0.0f);
+  const uint16_t in[] = {10, 50, 20, 40, 30, 0, 0};
+  uint16_t out = 0;
+  for (uint16_t x : in) out = f.filter(x);
+  TEST_ASSERT_EQUAL_UINT16(20, out);    // median of 20 40 30 0 0
+}
+
+void test_window_is_clamped_and_odd(void) {
+  HampelFilter<15> f;
+  f.configure(1);
+  TEST_ASSERT_EQUAL_UINT8(3, f.window());
+  f.configure(8);
+  TEST_ASSERT_EQUAL_UINT8(7, f.window());
+  f.configure(99);
+  TEST_ASSERT_EQUAL_UINT8(15, f.window());
+}
+
+// setSpikeFilter() before begin() must not be overwritten by the default
+void test_ntc_keeps_configured_window(void) {
+  NtcSensor a(34), b(35);
+  TEST_ASSERT_EQUAL_UINT8(NtcSensor::DEFAULT_SPIKE_WINDOW, a.spikeWindow());
+  a.begin();
+  TEST_ASSERT_EQUAL_UINT8(NtcSensor::DEFAULT_SPIKE_WINDOW, a.spikeWindow());
+
+  b.setSpikeFilter(11);
+  b.begin();
+  TEST_ASSERT_EQUAL_UINT8(11, b.spikeWindow());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_isolated_spikes_are_replaced);
+  RUN_TEST(test_spike_burst_below_half_window);
+  RUN_TEST(test_step_passes_after_half_window);
+  RUN_TEST(test_median_mode_with_k_zero);
+  RUN_TEST(test_window_is_clamped_and_odd);
+  RUN_TEST(test_ntc_keeps_configured_window);
+  return UNITY_END();
+}
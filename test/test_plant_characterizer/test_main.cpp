@@ -0,0 +1,83 @@
+// PlantCharacterizer against two SimulatedSensor plates with known FOPDT
+// parameters: the whole characterization runs on 100 ms steps and the
+// whole-range fits must give back the plants' gain and loss. The simulated
+// plates have a first-order sensor lag rather than a pure delay, so the
+// fitted dead time lands on or a little under the lag.
+#include <unity.h>
+#include "PlantCharacterizer.h"
+#include "SimulatedSensor.h"
+
+static const PlantParams FRONT = {2.0f, 0.0017f, 4.0f, 25.0f};
+static const PlantParams BACK  = {1.6f, 0.0022f, 6.0f, 25.0f};
+static const float FAN_LOSS = 0.0055f;   // 1/s at 100%
+
+static PlantModel model;
+static bool finished = false;
+static uint32_t elapsedMs = 0;
+
+static void characterize(float noiseC) {
+  SimulatedSensor f, b;
+  f.setPlant(FRONT, 60.0f);
+  b.setPlant(BACK, 40.0f);
+  f.setNoise(noiseC);
+  b.setNoise(noiseC);
+  PlantCharacterizer c;
+  uint32_t t = 1000;
+  f.poll(t);
+  b.poll(t);
+  c.begin(t, FRONT.ambientC);
+  while (!c.done() && t < 6 * 3600 * 1000UL) {
+    t += 100;
+    f.setDuty(c.dutyFront());
+    b.setDuty(c.dutyBack());
+    float fan = c.fanPct() ? FAN_LOSS * c.fanPct() / 100.0f : 0.0f;
+    f.setFanLoss(fan);
+    b.setFanLoss(fan);
+    f.poll(t);
+    b.poll(t);
+    c.update(t, f.tempC(), b.tempC());
+  }
+  memset(&model, 0, sizeof(model));
+  finished = c.result(model);
+  elapsedMs = t - 1000;
+}
+
+static void checkPlate(uint8_t p, const PlantParams& plant) {
+  const FopdtFit& fit = model.fit[p][PLANT_ALL];
+  char msg[96];
+  snprintf(msg, sizeof(msg), "plate %u: gain %.3f loss %.5f dead %.0f r2 %.3f", p,
+           fit.heatGain, fit.lossCoef, fit.deadSecs, fit.r2);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_FLOAT_WITHIN_MESSAGE(plant.heatGain * 0.08f, plant.heatGain, fit.heatGain, msg);
+  TEST_ASSERT_FLOAT_WITHIN_MESSAGE(plant.lossCoef * 0.15f, plant.lossCoef, fit.lossCoef, msg);
+  TEST_ASSERT_FLOAT_WITHIN_MESSAGE(2.0f, plant.sensorTau - 1.0f, fit.deadSecs, msg);
+  TEST_ASSERT_GREATER_THAN_MESSAGE(0.9f, fit.r2, msg);
+  TEST_ASSERT_FLOAT_WITHIN(FAN_LOSS * 0.1f, FAN_LOSS, model.fanLossCoef[p]);
+  TEST_ASSERT_FLOAT_WITHIN(0.0002f, 0.0f, model.couplingCoef[p]);   // the simulated plates are uncoupled
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_noiseless_plates(void) {
+  characterize(0.0f);
+  TEST_ASSERT_TRUE_MESSAGE(finished, "characterization did not finish");
+  TEST_ASSERT_LESS_THAN(3600UL * 1000, elapsedMs);
+  checkPlate(0, FRONT);
+  checkPlate(1, BACK);
+}
+
+// Thermocouple-sized noise moves the fits only slightly
+void test_noisy_plates(void) {
+  characterize(0.2f);
+  TEST_ASSERT_TRUE_MESSAGE(finished, "characterization did not finish");
+  checkPlate(0, FRONT);
+  checkPlate(1, BACK);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_noiseless_plates);
+  RUN_TEST(test_noisy_plates);
+  return UNITY_END();
+}
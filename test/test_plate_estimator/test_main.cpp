@@ -0,0 +1,142 @@
+// PlateEstimator vs the display EMA on the recorded plate trace.
+// The trace is taken as the true plate temperature; the thermistor is
+// modelled as a 4 s first-order lag of it plus white noise. Both filters
+// run on the same readings with no heater duty (the trace has none), so
+// the estimator has to carry the heating rate in its bias state.
+//   lag   = time shift that best aligns a filter's noise-free output with the trace
+//   noise = RMS of (output on noisy readings - output on clean readings)
+#include <unity.h>
+#include <vector>
+#include "PlateEstimator.h"
+#include "thermProf.h"
+
+static const float DT = 0.25f;        // trace sample spacing
+static const float SENSOR_TAU = 4.0f;
+static const float NOISE_C = 0.3f;    // thermistor noise, 1 sigma
+static const size_t SETTLE = 200;     // samples skipped while the filters converge
+
+static std::vector<float> truth, clean, noisy;
+
+// Deterministic ~N(0,1): sum of 12 LCG uniforms
+static float gauss(uint32_t& s) {
+  float a = 0;
+  for (int i = 0; i < 12; i++) {
+    s = s * 1664525u + 1013904223u;
+    a += (s >> 8) / 16777216.0f;
+  }
+  return a - 6.0f;
+}
+
+static std::vector<float> runEstimator(const std::vector<float>& in) {
+  std::vector<float> out;
+  PlateEstimator e;
+  e.begin(PlantParams{2.0f, 0.0017f, SENSOR_TAU, 25.0f}, in[0]);
+  for (float m : in) {
+    e.update(m, 0, DT);
+    out.push_back(e.tempC());
+  }
+  return out;
+}
+
+static std::vector<float> runEma(const std::vector<float>& in, float alpha) {
+  std::vector<float> out;
+  float y = in[0];
+  for (float m : in) {
+    y = alpha * m + (1 - alpha) * y;
+    out.push_back(y);
+  }
+  return out;
+}
+
+static float lagSec(const std::vector<float>& out) {
+  int best = 0;
+  double bestErr = 1e30;
+  for (int k = 0; k <= 80; k++) {
+    double e2 = 0;
+    size_t n = 0;
+    for (size_t i = SETTLE; i + k < out.size(); i++, n++) {
+      double d = out[i + k] - truth[i];
+      e2 += d * d;
+    }
+    if (e2 / n < bestErr) { bestErr = e2 / n; best = k; }
+  }
+  return best * DT;
+}
+
+static float noiseC(const std::vector<float>& onNoisy, const std::vector<float>& onClean) {
+  double e2 = 0;
+  for (size_t i = SETTLE; i < onNoisy.size(); i++) {
+    double d = onNoisy[i] - onClean[i];
+    e2 += d * d;
+  }
+  return sqrt(e2 / (onNoisy.size() - SETTLE));
+}
+
+static float emaNoise(float alpha) {
+  return noiseC(runEma(noisy, alpha), runEma(clean, alpha));
+}
+
+void setUp(void) {
+  if (!truth.empty()) return;
+  ThermProfReader r;
+  uint32_t seed = 12345;
+  float t, sensor = ThermProfReader::at(0);
+  while (r.next(t)) {
+    sensor += DT / SENSOR_TAU * (t - sensor);
+    truth.push_back(t);
+    clean.push_back(sensor);
+    noisy.push_back(sensor + NOISE_C * gauss(seed));
+  }
+}
+
+void tearDown(void) {}
+
+void test_trace_is_loaded(void) {
+  TEST_ASSERT_EQUAL(THERM_PROF_LENGTH, truth.size());
+}
+
+// Filtering must not cost more than the sensor's own lag, and must filter
+void test_estimator_has_no_lag_and_reduces_noise(void) {
+  float lag = lagSec(runEstimator(clean));
+  float noise = noiseC(runEstimator(noisy), runEstimator(clean));
+  char msg[64];
+  snprintf(msg, sizeof(msg), "estimator lag %.2f s, noise %.3f C", lag, noise);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_LESS_OR_EQUAL(0.5f, lag);
+  TEST_ASSERT_LESS_THAN(NOISE_C * 0.8f, noise);
+}
+
+// Tune the EMA to the estimator's output noise, then compare lag
+void test_less_lag_than_ema_at_equal_noise(void) {
+  float estLag = lagSec(runEstimator(clean));
+  float estNoise = noiseC(runEstimator(noisy), runEstimator(clean));
+
+  float lo = 0.01f, hi = 1.0f;   // EMA noise rises with alpha
+  for (int i = 0; i < 30; i++) {
+    float mid = 0.5f * (lo + hi);
+    if (emaNoise(mid) < estNoise) lo = mid; else hi = mid;
+  }
+  float alpha = 0.5f * (lo + hi);
+  float emaLag = lagSec(runEma(clean, alpha));
+
+  char msg[96];
+  snprintf(msg, sizeof(msg), "equal noise %.3f C: EMA alpha %.2f lag %.2f s, estimator %.2f s",
+           estNoise, alpha, emaLag, estLag);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, estNoise, emaNoise(alpha));
+  TEST_ASSERT_TRUE_MESSAGE(estLag + 2.0f < emaLag, msg);
+}
+
+// The shipped EMA (alpha 0.15) trails the plate by more than the sensor lag
+void test_shipped_ema_lags_the_plate(void) {
+  TEST_ASSERT_GREATER_THAN(SENSOR_TAU - 0.5f, lagSec(runEma(clean, 0.15f)));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_trace_is_loaded);
+  RUN_TEST(test_estimator_has_no_lag_and_reduces_noise);
+  RUN_TEST(test_less_lag_than_ema_at_equal_noise);
+  RUN_TEST(test_shipped_ema_lags_the_plate);
+  return UNITY_END();
+}
@@ -0,0 +1,112 @@
+// ProfileLibrary against library files written here in the
+// tools/profile_pack.py format: a good file loads, an index that cannot
+// be verified is refused, and a record that goes bad after boot comes back
+// as an error instead of another profile.
+#include <unity.h>
+#include <vector>
+#include "HostArduino.h"
+#include "ProfileLibrary.h"
+#include "Telemetry.h"
+#include <LittleFS.h>
+
+static const char* PATH = "/profiles.bin";
+
+// The built-in profiles, packed; `count` overrides the header's count
+static std::vector<uint8_t> pack(int count = -1) {
+  std::vector<uint8_t> records;
+  std::vector<LibIndexEntry> idx(PROFILE_COUNT);
+  uint32_t at = sizeof(LibHeader) + PROFILE_COUNT * sizeof(LibIndexEntry);
+  for (uint8_t i = 0; i < PROFILE_COUNT; i++) {
+    const Profile& p = PROFILES[i];
+    LibRecord r = {p.pidProfile, p.slotCount, p.coolingSlot, p.flags,
+                   (int16_t)p.profMinTemp, (int16_t)p.profMaxTemp, (int16_t)p.doneTemp};
+    std::vector<uint8_t> rec((uint8_t*)&r, (uint8_t*)&r + sizeof(r));
+    rec.insert(rec.end(), (const uint8_t*)p.slots, (const uint8_t*)(p.slots + p.slotCount));
+    uint16_t crc = Telemetry::crc16(rec.data(), rec.size());
+    rec.insert(rec.end(), (uint8_t*)&crc, (uint8_t*)&crc + 2);
+    memset(&idx[i], 0, sizeof(LibIndexEntry));
+    strncpy(idx[i].name, p.name, sizeof(idx[i].name));
+    idx[i].offset = at + records.size();
+    idx[i].length = rec.size();
+    records.insert(records.end(), rec.begin(), rec.end());
+  }
+  LibHeader h = {{'R', 'P', 'L', 'B'}, ProfileLibrary::VERSION, (uint8_t)(count < 0 ? PROFILE_COUNT : count),
+                 Telemetry::crc16((const uint8_t*)idx.data(), idx.size() * sizeof(LibIndexEntry))};
+  std::vector<uint8_t> out((uint8_t*)&h, (uint8_t*)&h + sizeof(h));
+  out.insert(out.end(), (uint8_t*)idx.data(), (uint8_t*)(idx.data() + idx.size()));
+  out.insert(out.end(), records.begin(), records.end());
+  return out;
+}
+
+static void writeFile(const std::vector<uint8_t>& data) {
+  File f = LittleFS.open(PATH, "w");
+  f.write(data.data(), data.size());
+  f.close();
+}
+
+void setUp(void) {
+  hostFsWipe();
+  LittleFS.begin(true);
+}
+void tearDown(void) {}
+
+void test_packed_file_loads(void) {
+  writeFile(pack());
+  ProfileLibrary lib;
+  TEST_ASSERT_TRUE(lib.begin(PATH));
+  TEST_ASSERT_TRUE(lib.fromFile());
+  TEST_ASSERT_EQUAL(PROFILE_COUNT, lib.count());
+  const Profile& p = lib.get(1);
+  TEST_ASSERT_EQUAL_STRING(PROFILES[1].name, p.name);
+  TEST_ASSERT_EQUAL(PROFILES[1].slotCount, p.slotCount);
+  TEST_ASSERT_EQUAL(0, lib.lastCheck().errors);
+}
+
+// The CRC covers the full index; a count past MAX_PROFILES cannot be checked
+void test_oversized_index_is_refused(void) {
+  std::vector<uint8_t> data = pack(ProfileLibrary::MAX_PROFILES + 1);
+  data.resize(data.size() + 64 * sizeof(LibIndexEntry), 0);   // enough bytes to read
+  writeFile(data);
+  ProfileLibrary lib;
+  TEST_ASSERT_FALSE(lib.begin(PATH));
+  TEST_ASSERT_FALSE(lib.fromFile());
+  TEST_ASSERT_EQUAL(PROFILE_COUNT, lib.count());
+}
+
+void test_index_crc_mismatch_is_refused(void) {
+  std::vector<uint8_t> data = pack();
+  data[sizeof(LibHeader) + 3] ^= 0x20;       // a name byte
+  writeFile(data);
+  ProfileLibrary lib;
+  TEST_ASSERT_FALSE(lib.begin(PATH));
+}
+
+// A record that no longer reads is an error, not a different profile
+void test_unreadable_record_is_an_error(void) {
+  std::vector<uint8_t> data = pack();
+  writeFile(data);
+  ProfileLibrary lib;
+  TEST_ASSERT_TRUE(lib.begin(PATH));
+  LibIndexEntry e;
+  memcpy(&e, data.data() + sizeof(LibHeader) + 2 * sizeof(LibIndexEntry), sizeof(e));
+  data[e.offset + sizeof(LibRecord)] ^= 0xFF;  // first slot of profile 2
+  writeFile(data);
+
+  const Profile& p = lib.get(2);
+  TEST_ASSERT_EQUAL_STRING(PROFILES[2].name, p.name);
+  TEST_ASSERT_NOT_EQUAL(0, lib.lastCheck().errors);
+  TEST_ASSERT_EQUAL(1, p.slotCount);
+  TEST_ASSERT_NOT_NULL(p.slots);
+  // the others still load
+  lib.get(1);
+  TEST_ASSERT_EQUAL(0, lib.lastCheck().errors);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_packed_file_loads);
+  RUN_TEST(test_oversized_index_is_refused);
+  RUN_TEST(test_index_crc_mismatch_is_refused);
+  RUN_TEST(test_unreadable_record_is_an_error);
+  return UNITY_END();
+}
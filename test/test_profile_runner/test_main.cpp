@@ -0,0 +1,65 @@
+// ProfileRunner setpoints at arbitrary times. A run only moves forward,
+// but the bench and the UI scenes query scrambled times on one runner;
+// the slot cursor has to follow them back as well as forward.
+#include <unity.h>
+#include "HostArduino.h"
+#include "ProfileRunner.h"
+
+static const uint32_t T0 = 5000;   // start time; 0 reads as "not started"
+
+static float freshSetpoint(const Profile& p, ProfileRunner::Interp interp, uint32_t ms) {
+  ProfileRunner r;
+  r.setInterp(interp);
+  r.begin(p);
+  bool finished;
+  return r.update(millis() + ms, finished);
+}
+
+static void checkScrambled(ProfileRunner::Interp interp) {
+  for (uint8_t i = 0; i < PROFILE_COUNT; i++) {
+    const Profile& p = PROFILES[i];
+    ProfileRunner r;
+    r.setInterp(interp);
+    r.begin(p);
+    uint32_t spanMs = r.durationSec() * 1000u;
+    for (uint32_t k = 0; k < 2000; k++) {
+      uint32_t ms = (k * 7919u * 1000u + k * 37u) % spanMs;
+      bool finished;
+      float got = r.update(millis() + ms, finished);
+      float want = freshSetpoint(p, interp, ms);
+      char msg[64];
+      snprintf(msg, sizeof(msg), "%s at %lu ms", p.name, (unsigned long)ms);
+      TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-4f, want, got, msg);
+    }
+  }
+}
+
+void setUp(void) {
+  if (millis() < T0) hostAdvanceMs(T0 - millis());
+}
+
+void tearDown(void) {}
+
+void test_scrambled_times_linear(void) { checkScrambled(ProfileRunner::INTERP_LINEAR); }
+void test_scrambled_times_cubic(void)  { checkScrambled(ProfileRunner::INTERP_MONOTONE); }
+
+// Going back to the first slot after the last one
+void test_rewind_to_start(void) {
+  const Profile& p = PROFILES[1];
+  ProfileRunner r;
+  r.begin(p);
+  bool finished;
+  uint32_t t0 = millis();
+  float first = r.update(t0 + 1000, finished);
+  r.update(t0 + (r.durationSec() - 1) * 1000u, finished);
+  TEST_ASSERT_EQUAL_FLOAT(first, r.update(t0 + 1000, finished));
+  TEST_ASSERT_EQUAL_FLOAT(p.profMinTemp, r.update(t0, finished));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_scrambled_times_linear);
+  RUN_TEST(test_scrambled_times_cubic);
+  RUN_TEST(test_rewind_to_start);
+  return UNITY_END();
+}
@@ -0,0 +1,131 @@
+// Closed-loop simulator (pio test -e native-sim): the station runs High
+// 230C against two SimulatedSensor plates, once with linear and once with
+// monotone-cubic setpoints, each in a forked process so every run starts
+// from a fresh station. What the simulator shows:
+//  - neither setpoint shape drives a plate above a rising or flat setpoint
+//  - on the estimator's 2 C/s plant the plates lag, and the cubic's eased
+//    corners get the peak a few degrees closer to its target
+//  - on a 6 C/s plant both shapes reach the peak alike
+//  - on an 8 C/s plant with a 6 s thermocouple and a 3 s heater delay the
+//    loop reacts late: linear ramps run past the setpoint and the peak, and
+//    the cubic's eased corners cut both
+#include <unity.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "HostArduino.h"
+#include "ProfileRunner.h"
+
+#if !defined(REFLOW_REPLAY) || !defined(REPLAY_PLANT)
+#error "build with [env:native-sim]"
+#endif
+
+extern ProfileRunner profRunner;
+extern float    g_simPlantGain;
+extern float    g_simSensorTau;
+extern float    g_simDeadSecs;
+extern float    g_simPeak[2];
+extern float    g_simOver[2];
+extern double   g_simErr2[2];
+extern uint32_t g_simErrN;
+extern bool     g_replayDone;
+
+struct SimResult {
+  bool  done;
+  float peak[2];   // hottest plate, °C
+  float over[2];   // worst plate above a rising / flat setpoint, °C
+  float rms[2];    // tracking error, °C
+};
+
+static const int   PEAK_C = 230;
+static const long  MAX_LOOPS = 200000;
+
+static SimResult simulate(ProfileRunner::Interp interp, float gain, float tau = 4.0f, float dead = 0.0f) {
+  int fds[2];
+  SimResult r = {};
+  TEST_ASSERT_EQUAL(0, pipe(fds));
+  pid_t pid = fork();
+  TEST_ASSERT_TRUE(pid >= 0);
+  if (pid == 0) {
+    close(fds[0]);
+    hostSerialAttach(open("/dev/null", O_WRONLY));
+    profRunner.setInterp(interp);
+    g_simPlantGain = gain;
+    g_simSensorTau = tau;
+    g_simDeadSecs = dead;
+    setup();
+    for (long i = 0; i < MAX_LOOPS && !g_replayDone; i++) loop();
+    r.done = g_replayDone;
+    double n = g_simErrN ? g_simErrN : 1;
+    for (int p = 0; p < 2; p++) {
+      r.peak[p] = g_simPeak[p];
+      r.over[p] = g_simOver[p];
+      r.rms[p] = sqrt(g_simErr2[p] / n);
+    }
+    ssize_t w = write(fds[1], &r, sizeof(r));
+    _exit(w == (ssize_t)sizeof(r) ? 0 : 1);
+  }
+  close(fds[1]);
+  ssize_t got = read(fds[0], &r, sizeof(r));
+  close(fds[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  TEST_ASSERT_EQUAL_MESSAGE(sizeof(r), got, "simulator child died");
+  TEST_ASSERT_TRUE_MESSAGE(r.done, "run did not finish");
+
+  char msg[128];
+  snprintf(msg, sizeof(msg), "%s %.0f C/s, lag %.0f s, delay %.0f s: peak F=%+.1f B=%+.1f, over F=%.1f B=%.1f, rms F=%.1f B=%.1f",
+           interp == ProfileRunner::INTERP_MONOTONE ? "cubic" : "linear", gain, tau, dead,
+           r.peak[0] - PEAK_C, r.peak[1] - PEAK_C, r.over[0], r.over[1], r.rms[0], r.rms[1]);
+  TEST_MESSAGE(msg);
+  return r;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_no_overshoot_on_the_estimator_plant(void) {
+  SimResult lin = simulate(ProfileRunner::INTERP_LINEAR, 2.0f);
+  SimResult cub = simulate(ProfileRunner::INTERP_MONOTONE, 2.0f);
+  for (int p = 0; p < 2; p++) {
+    TEST_ASSERT_LESS_OR_EQUAL(0.5f, lin.over[p]);
+    TEST_ASSERT_LESS_OR_EQUAL(0.5f, cub.over[p]);
+  }
+  // The plates lag either way; the cubic peaks closer to 230 on both
+  for (int p = 0; p < 2; p++) {
+    TEST_ASSERT_LESS_THAN(PEAK_C, cub.peak[p]);
+    TEST_ASSERT_GREATER_THAN(lin.peak[p] + 2.0f, cub.peak[p]);
+  }
+}
+
+void test_no_overshoot_on_a_fast_plant(void) {
+  SimResult lin = simulate(ProfileRunner::INTERP_LINEAR, 6.0f);
+  SimResult cub = simulate(ProfileRunner::INTERP_MONOTONE, 6.0f);
+  for (int p = 0; p < 2; p++) {
+    TEST_ASSERT_LESS_OR_EQUAL(0.5f, lin.over[p]);
+    TEST_ASSERT_LESS_OR_EQUAL(0.5f, cub.over[p]);
+    TEST_ASSERT_FLOAT_WITHIN(5.0f, PEAK_C, lin.peak[p]);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, lin.peak[p], cub.peak[p]);
+  }
+}
+
+void test_cubic_reduces_overshoot_on_a_lagging_plant(void) {
+  SimResult lin = simulate(ProfileRunner::INTERP_LINEAR, 8.0f, 6.0f, 3.0f);
+  SimResult cub = simulate(ProfileRunner::INTERP_MONOTONE, 8.0f, 6.0f, 3.0f);
+  for (int p = 0; p < 2; p++) {
+    // the linear corners overshoot on this plant...
+    TEST_ASSERT_GREATER_THAN(3.0f, lin.over[p]);
+    TEST_ASSERT_GREATER_THAN(PEAK_C + 1.5f, lin.peak[p]);
+    // ...and the cubic takes a good part of it back
+    TEST_ASSERT_LESS_THAN(lin.over[p] - 0.75f, cub.over[p]);
+    TEST_ASSERT_LESS_THAN(lin.peak[p] - 0.75f, cub.peak[p]);
+  }
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_no_overshoot_on_the_estimator_plant);
+  RUN_TEST(test_no_overshoot_on_a_fast_plant);
+  RUN_TEST(test_cubic_reduces_overshoot_on_a_lagging_plant);
+  return UNITY_END();
+}
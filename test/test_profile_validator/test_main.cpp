@@ -0,0 +1,77 @@
+// ProfileValidator structure checks: the built-in profiles pass, and slots
+// whose phase or hold the station cannot act on are errors (a phase past
+// PHASE_COOL would post an event other than a phase change).
+#include <unity.h>
+#include <string>
+#include "ProfileValidator.h"
+
+static std::string lastError;
+
+static void report(bool error, uint8_t, const char* msg) {
+  if (error) lastError = msg;
+}
+
+// Built-in lead profile with one slot replaced
+static ValidationResult checkWith(uint8_t slot, const ProfileEntry& e) {
+  const Profile& base = PROFILES[1];
+  ProfileEntry slots[MAXPRSLOTS];
+  memcpy(slots, base.slots, base.slotCount * sizeof(ProfileEntry));
+  slots[slot] = e;
+  Profile p = base;
+  p.slots = slots;
+  lastError.clear();
+  return ProfileValidator::check(p, DEFAULT_PLATE_LIMITS, nullptr, report);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_builtin_profiles_have_no_errors(void) {
+  for (uint8_t i = 0; i < PROFILE_COUNT; i++) {
+    ValidationResult r = ProfileValidator::check(PROFILES[i], DEFAULT_PLATE_LIMITS);
+    TEST_ASSERT_EQUAL_MESSAGE(0, r.errors, PROFILES[i].name);
+  }
+}
+
+void test_phase_past_cool_is_an_error(void) {
+  ProfileEntry e = PROFILES[1].slots[1];
+  e.phase = PHASE_COOL;
+  TEST_ASSERT_EQUAL(0, checkWith(1, e).errors);
+  e.phase = PHASE_COUNT;
+  TEST_ASSERT_EQUAL(1, checkWith(1, e).errors);
+  TEST_ASSERT_EQUAL_STRING("phase 4, expected 0..3", lastError.c_str());
+  e.phase = 0xFF;
+  TEST_ASSERT_EQUAL(1, checkWith(1, e).errors);
+}
+
+void test_hold_tolerance_is_bounded(void) {
+  ProfileEntry e = PROFILES[1].slots[1];
+  e.holdTolC = HOLD_TOL_MAX_C;
+  TEST_ASSERT_EQUAL(0, checkWith(1, e).errors);
+  e.holdTolC = HOLD_TOL_MAX_C + 1;
+  TEST_ASSERT_EQUAL(1, checkWith(1, e).errors);
+}
+
+void test_hold_needs_a_limit(void) {
+  ProfileEntry e = PROFILES[1].slots[1];
+  e.holdTolC = 5;
+  e.holdMaxSecs = 0;
+  TEST_ASSERT_EQUAL(1, checkWith(1, e).errors);
+  TEST_ASSERT_EQUAL_STRING("hold limit 0s, expected 1..600", lastError.c_str());
+  e.holdMaxSecs = HOLD_MAX_SECS + 1;
+  TEST_ASSERT_EQUAL(1, checkWith(1, e).errors);
+  e.holdMaxSecs = HOLD_MAX_SECS;
+  TEST_ASSERT_EQUAL(0, checkWith(1, e).errors);
+  e.holdTolC = 0;   // no hold: the limit is unused
+  e.holdMaxSecs = 0;
+  TEST_ASSERT_EQUAL(0, checkWith(1, e).errors);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_builtin_profiles_have_no_errors);
+  RUN_TEST(test_phase_past_cool_is_an_error);
+  RUN_TEST(test_hold_tolerance_is_bounded);
+  RUN_TEST(test_hold_needs_a_limit);
+  return UNITY_END();
+}
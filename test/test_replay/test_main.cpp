@@ -0,0 +1,76 @@
+// Recorded-trace replay against the golden log (pio test -e native-replay).
+// The replay build prints one CSV line per simulated second and keeps a
+// CRC-32 of them; golden.csv next to this file is the accepted log, and
+// REPLAY_GOLDEN_CRC / REPLAY_GOLDEN_LINES in platformio.ini are its
+// checksum and length. On a mismatch the CSV lines of the run are left in
+// replay_out.csv (working directory) for diffing; if the change is
+// intended, copy that over golden.csv and update the two numbers.
+#include <unity.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string>
+#include "HostArduino.h"
+
+#if !defined(REFLOW_REPLAY) || !defined(REPLAY_GOLDEN_CRC) || !defined(REPLAY_GOLDEN_LINES)
+#error "build with [env:native-replay]"
+#endif
+
+extern uint32_t g_replayCrc;
+extern uint32_t g_replayLines;
+extern bool     g_replayDone;
+
+static const char* OUT_PATH = "replay_out.csv";
+static const long  MAX_LOOPS = 200000;   // 5.5 h of simulated loop() ticks
+static long loops = 0;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Keep only the CSV lines (log and banner lines are not part of the CRC)
+static void keepCsvLines() {
+  FILE* f = fopen(OUT_PATH, "r");
+  if (!f) return;
+  std::string csv;
+  char line[160];
+  while (fgets(line, sizeof(line), f)) {
+    char* end = line + strcspn(line, "\r\n");
+    *end = 0;
+    if ((line[0] >= '0' && line[0] <= '9') || !strncmp(line, "t_s,", 4)) csv += std::string(line) + "\n";
+  }
+  fclose(f);
+  f = fopen(OUT_PATH, "w");
+  if (f) { fputs(csv.c_str(), f); fclose(f); }
+}
+
+static void runReplay() {
+  int fd = open(OUT_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  TEST_ASSERT_TRUE_MESSAGE(fd >= 0, "cannot create replay_out.csv");
+  hostSerialAttach(fd);
+  setup();
+  while (!g_replayDone && loops < MAX_LOOPS) { loop(); loops++; }
+  hostSerialAttach(STDOUT_FILENO);
+  close(fd);
+  keepCsvLines();
+}
+
+void test_replay_finishes(void) {
+  runReplay();
+  TEST_ASSERT_TRUE_MESSAGE(g_replayDone, "replay did not reach the end of the trace");
+}
+
+void test_replay_matches_golden(void) {
+  char msg[128];
+  snprintf(msg, sizeof(msg), "lines=%lu crc=0x%08lX, golden lines=%lu crc=0x%08lX; see %s",
+           (unsigned long)g_replayLines, (unsigned long)~g_replayCrc,
+           (unsigned long)REPLAY_GOLDEN_LINES, (unsigned long)REPLAY_GOLDEN_CRC, OUT_PATH);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(REPLAY_GOLDEN_LINES, g_replayLines, msg);
+  TEST_ASSERT_EQUAL_HEX32_MESSAGE(REPLAY_GOLDEN_CRC, ~g_replayCrc, msg);
+  unlink(OUT_PATH);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_replay_finishes);
+  RUN_TEST(test_replay_matches_golden);
+  return UNITY_END();
+}
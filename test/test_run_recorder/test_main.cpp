@@ -0,0 +1,202 @@
+// RunRecorder: a simulated run written to the host LittleFS and decoded back
+#include <unity.h>
+#include <vector>
+#include "HostArduino.h"
+#include "RunRecorder.h"
+#include "Telemetry.h"
+#include <LittleFS.h>
+
+struct Decoded {
+  RunHeader header;
+  std::vector<RunSample> samples;   // absolute values, dtDs as recorded
+  int badChunks;
+};
+
+static int32_t readVarint(const uint8_t*& p, const uint8_t* end) {
+  uint32_t z = 0;
+  uint8_t shift = 0;
+  while (p < end) {
+    uint8_t b = *p++;
+    z |= (uint32_t)(b & 0x7F) << shift;
+    shift += 7;
+    if (!(b & 0x80)) break;
+  }
+  return (int32_t)(z >> 1) ^ -(int32_t)(z & 1);
+}
+
+// Same format as tools/run_reader.py
+static bool decode(const char* path, Decoded& d) {
+  File f = LittleFS.open(path, "r");
+  if (!f) return false;
+  std::vector<uint8_t> data(f.size());
+  f.read(data.data(), data.size());
+  f.close();
+  if (data.size() < sizeof(RunHeader)) return false;
+  memcpy(&d.header, data.data(), sizeof(RunHeader));
+  d.samples.clear();
+  d.badChunks = 0;
+
+  size_t pos = sizeof(RunHeader);
+  while (pos + 8 <= data.size()) {
+    uint16_t hdr[3];
+    memcpy(hdr, &data[pos], sizeof(hdr));
+    if (hdr[0] != RunRecorder::CHUNK_MAGIC || pos + 6 + hdr[1] + 2 > data.size()) return false;
+    const uint8_t* p = &data[pos + 6];
+    const uint8_t* end = p + hdr[1];
+    uint16_t crc;
+    memcpy(&crc, end, 2);
+    pos += 6 + hdr[1] + 2;
+    if (crc != Telemetry::crc16(p, hdr[1])) { d.badChunks++; continue; }
+
+    RunSample prev = {};
+    for (uint16_t k = 0; k < hdr[2]; k++) {
+      RunSample s;
+      int32_t* cur = &s.dtDs;
+      const int32_t* old = &prev.dtDs;
+      for (size_t i = 0; i < sizeof(RunSample) / sizeof(int32_t); i++)
+        cur[i] = readVarint(p, end) + (k ? old[i] : 0);
+      d.samples.push_back(s);
+      prev = s;
+    }
+    if (p != end) return false;
+  }
+  return pos == data.size();
+}
+
+static RunHeader makeHeader() {
+  RunHeader h = {};
+  h.kind = RUN_PROFILE;
+  h.periodMs = 1000;
+  strcpy(h.name, "Lead 200C");
+  h.gains = PIDGains{3.0f, 0.13f, 8.0f, 150.0f};
+  h.calOffsetF = -1.5f; h.calScaleF = 1.0f;
+  h.calOffsetB = 0.5f;  h.calScaleB = 1.0f;
+  return h;
+}
+
+// 12 minutes at a 100 ms loop, one sample kept per second
+static std::vector<RunSample> recordRun(RunRecorder& rec, uint32_t t0 = 1000) {
+  std::vector<RunSample> expect;
+  uint32_t last = 0;
+  for (uint32_t t = t0; t <= t0 + 720000; t += 100) {
+    float x = (t - t0) / 1000.0f;
+    float tF = 25 + x * 0.3f, tB = 24 + x * 0.29f, sp = 26 + x * 0.3f;
+    int dF = (int)(50 + 40 * sinf(x / 10)), dB = 40, fan = x > 600 ? 100 : 0;
+    uint8_t flags = x > 600 ? 3 : 4;
+    rec.sample(t, tF, tB, sp, dF, dB, fan, flags);
+    if (!last || t - last >= 1000) {
+      expect.push_back(RunSample{last ? (int32_t)((t - last + 50) / 100) : 0,
+                                 (int32_t)lroundf(tF * 10), (int32_t)lroundf(tB * 10),
+                                 (int32_t)lroundf(sp * 10), dF, dB, fan, flags});
+      last = t;
+    }
+  }
+  return expect;
+}
+
+static int runFiles() {
+  int n = 0;
+  File dir = LittleFS.open("/runs");
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile()) n++;
+  return n;
+}
+
+void setUp(void) {
+  hostFsWipe();
+  hostFsFailRemove(false);
+}
+
+void tearDown(void) {}
+
+void test_round_trip(void) {
+  RunRecorder rec;
+  TEST_ASSERT_TRUE(rec.begin());
+  RunHeader h = makeHeader();
+  TEST_ASSERT_TRUE(rec.startRun(h));
+  std::vector<RunSample> expect = recordRun(rec);
+  rec.endRun();
+  TEST_ASSERT_GREATER_THAN(1, (int)rec.flushes());   // spans several chunks
+
+  Decoded d;
+  TEST_ASSERT_TRUE(decode("/runs/run_00001.rec", d));
+  TEST_ASSERT_EQUAL_MEMORY("RRUN", d.header.magic, 4);
+  TEST_ASSERT_EQUAL_UINT8(RunRecorder::VERSION, d.header.version);
+  TEST_ASSERT_EQUAL_UINT32(1, d.header.seq);
+  TEST_ASSERT_EQUAL_STRING("Lead 200C", d.header.name);
+  TEST_ASSERT_EQUAL_FLOAT(0.13f, d.header.gains.I);
+  TEST_ASSERT_EQUAL_FLOAT(-1.5f, d.header.calOffsetF);
+  TEST_ASSERT_EQUAL_INT(0, d.badChunks);
+
+  TEST_ASSERT_EQUAL(expect.size(), d.samples.size());
+  for (size_t i = 0; i < expect.size(); i++)
+    TEST_ASSERT_EQUAL_MEMORY(&expect[i], &d.samples[i], sizeof(RunSample));
+}
+
+// A corrupted chunk is skipped by its CRC; the others still decode
+void test_corrupt_chunk_is_isolated(void) {
+  RunRecorder rec;
+  rec.begin();
+  RunHeader h = makeHeader();
+  rec.startRun(h);
+  std::vector<RunSample> expect = recordRun(rec);
+  rec.endRun();
+
+  std::string path = std::string(hostFsDir()) + "/runs/run_00001.rec";
+  FILE* f = fopen(path.c_str(), "r+b");
+  TEST_ASSERT_NOT_NULL(f);
+  fseek(f, sizeof(RunHeader) + 20, SEEK_SET);   // inside the first payload
+  fputc(0x55, f);
+  fclose(f);
+
+  Decoded d;
+  TEST_ASSERT_TRUE(decode("/runs/run_00001.rec", d));
+  TEST_ASSERT_EQUAL_INT(1, d.badChunks);
+  TEST_ASSERT_GREATER_THAN(0, (int)d.samples.size());
+  TEST_ASSERT_LESS_THAN((int)expect.size(), (int)d.samples.size());
+}
+
+void test_rotation_keeps_newest_runs(void) {
+  RunRecorder rec;
+  rec.begin();
+  for (int r = 0; r < RunRecorder::MAX_RUNS + 3; r++) {
+    RunHeader h = makeHeader();
+    TEST_ASSERT_TRUE(rec.startRun(h));
+    rec.sample(1000, 25, 25, 25, 0, 0, 0, 0);
+    rec.endRun();
+  }
+  TEST_ASSERT_EQUAL_INT(RunRecorder::MAX_RUNS, runFiles());
+  TEST_ASSERT_FALSE(LittleFS.exists("/runs/run_00003.rec"));
+  TEST_ASSERT_TRUE(LittleFS.exists("/runs/run_00004.rec"));
+
+  // Numbering continues after a restart
+  RunRecorder again;
+  again.begin();
+  TEST_ASSERT_EQUAL_UINT32(RunRecorder::MAX_RUNS + 3, again.lastSeq());
+}
+
+// A filesystem that refuses deletes must not hang startRun()
+void test_rotation_gives_up_when_remove_fails(void) {
+  RunRecorder rec;
+  rec.begin();
+  for (int r = 0; r < RunRecorder::MAX_RUNS; r++) {
+    RunHeader h = makeHeader();
+    rec.startRun(h);
+    rec.endRun();
+  }
+  hostFsFailRemove(true);
+  RunHeader h = makeHeader();
+  TEST_ASSERT_TRUE(rec.startRun(h));
+  rec.endRun();
+  TEST_ASSERT_EQUAL_INT(RunRecorder::MAX_RUNS + 1, runFiles());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_corrupt_chunk_is_isolated);
+  RUN_TEST(test_rotation_keeps_newest_runs);
+  RUN_TEST(test_rotation_gives_up_when_remove_fails);
+  int failures = UNITY_END();
+  hostFsWipe();
+  return failures;
+}
@@ -0,0 +1,127 @@
+// SettingsStore on the host's in-memory NVS: loading, debounced commits,
+// a newer stored schema (downgraded firmware) that must stay untouched,
+// and the station's setup() pulling out-of-range saved values back in.
+#include <unity.h>
+#include <math.h>
+#include "HostArduino.h"
+#include "SettingsStore.h"
+#include "Types.h"
+
+extern int      constTemp;
+extern int      constDuration;
+extern float    constRampCps;
+extern PIDGains g_remoteGains;
+extern float    g_calOffset[2];
+
+static int   temp;
+static float ramp;
+static const SettingDef DEFS[] = {
+    setting("temp", temp),
+    setting("ramp", ramp),
+};
+
+static void seed(const char* ns, uint16_t version, int t, float r) {
+  Preferences p;
+  p.begin(ns, false);
+  p.clear();
+  p.putUShort("_ver", version);
+  p.putBytes("temp", &t, sizeof(t));
+  p.putBytes("ramp", &r, sizeof(r));
+  p.end();
+}
+
+static int storedTemp(const char* ns) {
+  Preferences p;
+  p.begin(ns, true);
+  int t = 0;
+  p.getBytes("temp", &t, sizeof(t));
+  return t;
+}
+
+void setUp(void) {
+  temp = 150;
+  ramp = 1.0f;
+  hostAdvanceMs(1000);
+}
+void tearDown(void) {}
+
+void test_loads_and_commits_after_debounce(void) {
+  seed("t_load", 1, 180, 2.5f);
+  SettingsStore s;
+  TEST_ASSERT_TRUE(s.begin(DEFS, 2, 1, nullptr, "t_load"));
+  TEST_ASSERT_TRUE(s.writable());
+  TEST_ASSERT_EQUAL(180, temp);
+  TEST_ASSERT_EQUAL_FLOAT(2.5f, ramp);
+
+  temp = 200;
+  s.poll(millis());
+  hostAdvanceMs(SettingsStore::DEBOUNCE_MS - 100);
+  s.poll(millis());
+  TEST_ASSERT_EQUAL(180, storedTemp("t_load"));
+  hostAdvanceMs(200);
+  s.poll(millis());
+  TEST_ASSERT_EQUAL(200, storedTemp("t_load"));
+  TEST_ASSERT_EQUAL(0, s.pending());
+}
+
+// Firmware older than the stored schema: defaults, and nothing written back
+void test_newer_schema_is_read_only(void) {
+  seed("t_newer", 7, 180, 2.5f);
+  SettingsStore s;
+  TEST_ASSERT_TRUE(s.begin(DEFS, 2, 1, nullptr, "t_newer"));
+  TEST_ASSERT_FALSE(s.writable());
+  TEST_ASSERT_EQUAL(7, s.storedVersion());
+  TEST_ASSERT_EQUAL(150, temp);
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, ramp);
+
+  temp = 210;
+  s.poll(millis());
+  hostAdvanceMs(SettingsStore::MAX_DEFER_MS);
+  s.poll(millis());
+  s.flush();
+  s.factoryReset();
+  TEST_ASSERT_EQUAL(0, s.commits());
+
+  Preferences p;
+  p.begin("t_newer", true);
+  TEST_ASSERT_EQUAL(7, p.getUShort("_ver"));
+  TEST_ASSERT_EQUAL(180, storedTemp("t_newer"));
+}
+
+// The station's own namespace, seeded with values no command would take
+void test_station_clamps_loaded_values(void) {
+  Preferences p;
+  p.begin("reflow", false);
+  p.clear();
+  p.putUShort("_ver", 1);
+  int t = 900, secs = 70000;
+  float r = NAN;
+  PIDGains g = {5000.0f, -1.0f, 20000.0f, 1e9f};
+  float cal[2] = {-500.0f, 12.5f};
+  p.putBytes("constTemp", &t, sizeof(t));
+  p.putBytes("constSecs", &secs, sizeof(secs));
+  p.putBytes("constRamp", &r, sizeof(r));
+  p.putBytes("gains", &g, sizeof(g));
+  p.putBytes("cal", cal, sizeof(cal));
+  p.end();
+
+  setup();
+  TEST_ASSERT_TRUE(settings.writable());
+  TEST_ASSERT_EQUAL(220, constTemp);
+  TEST_ASSERT_EQUAL(36000, constDuration);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, constRampCps);
+  TEST_ASSERT_EQUAL_FLOAT(1000.0f, g_remoteGains.P);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, g_remoteGains.I);
+  TEST_ASSERT_EQUAL_FLOAT(10000.0f, g_remoteGains.D);
+  TEST_ASSERT_EQUAL_FLOAT(1000.0f, g_remoteGains.iMax);
+  TEST_ASSERT_EQUAL_FLOAT(-200.0f, g_calOffset[0]);
+  TEST_ASSERT_EQUAL_FLOAT(12.5f, g_calOffset[1]);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_loads_and_commits_after_debounce);
+  RUN_TEST(test_newer_schema_is_read_only);
+  RUN_TEST(test_station_clamps_loaded_values);
+  return UNITY_END();
+}
@@ -0,0 +1,370 @@
+// Station state machine (Station.h) on the host: the firmware's setup()
+// runs once, then each test walks the tables with the same events the
+// encoder, the remote commands and the run ticks raise. Sensors read the
+// shim's room-temperature ADC value unless a test pulls a thermistor open.
+#include <unity.h>
+#include "HostArduino.h"
+#include "Boards.h"
+#include "HeaterController.h"
+#include "PlantCharacterizer.h"
+#include "SensorManager.h"
+#include "Station.h"
+
+extern HeaterController heater;
+extern int constTemp;
+extern int constDuration;
+extern SensorManager sensors;
+extern PlantModel plantModel;
+extern bool plantModelValid;
+void applyPlantModel();
+
+static bool booted = false;
+
+static const char* name(uint8_t s) { return fsm.stateName(s); }
+
+static void expectState(uint8_t want) {
+  char msg[64];
+  snprintf(msg, sizeof(msg), "in %s, expected %s", name(fsm.state()), name(want));
+  TEST_ASSERT_EQUAL_UINT8_MESSAGE(want, fsm.state(), msg);
+}
+
+// Whatever the test left behind, back to MENU the way a user would
+static void toMenu() {
+  for (int i = 0; i < 4 && fsm.state() != ST_MENU; i++)
+    fsm.dispatch(fsm.state() == ST_FAULT ? EV_CLICK : EV_ABORT);
+  heatSelection = HEAT_BOTH;
+}
+
+static void click(int index) {
+  menuIndex = index;
+  fsm.dispatch(EV_CLICK);
+}
+
+static void startProfile() {
+  click(1);
+  expectState(ST_PROF_SETUP);
+  fsm.dispatch(EV_CLICK);
+  expectState(ST_PREHEAT);
+}
+
+static void startConst() {
+  click(2);
+  expectState(ST_CONST_SETUP);
+  for (int field = 0; field < 3; field++) fsm.dispatch(EV_CLICK);
+  expectState(ST_CONST);
+}
+
+static void startTest(int pct) {
+  click(4);
+  expectState(ST_TEST);
+  encoderSteps = pct / 5;
+  fsm.dispatch(EV_TURN);
+  TEST_ASSERT_EQUAL(pct, testPct);
+}
+
+static void setThermistors(uint16_t raw) {
+  hostSetAnalog(board.thermFront, raw);
+  hostSetAnalog(board.thermBack, raw);
+}
+
+void setUp(void) {
+  if (!booted) {
+    setup();
+    booted = true;
+  }
+  setThermistors(2000);
+  toMenu();
+}
+
+void tearDown(void) {}
+
+void test_boots_to_menu(void) {
+  expectState(ST_MENU);
+  TEST_ASSERT_EQUAL(MENU, currentMode);
+}
+
+// ---- Guards ----
+
+void test_runs_refused_without_heaters(void) {
+  heatSelection = HEAT_OFF;
+  click(1);
+  expectState(ST_MENU);
+  click(2);
+  expectState(ST_MENU);
+  heatSelection = HEAT_FRONT;
+  click(2);
+  expectState(ST_CONST_SETUP);
+}
+
+void test_const_setup_walks_every_field(void) {
+  click(2);
+  for (uint8_t field = 0; field < 2; field++) {
+    fsm.dispatch(EV_CLICK);
+    expectState(ST_CONST_SETUP);
+    TEST_ASSERT_EQUAL(field + 1, constField);
+  }
+  fsm.dispatch(EV_CLICK);
+  expectState(ST_CONST);
+  TEST_ASSERT_EQUAL(CONST_RUN, currentMode);
+}
+
+void test_long_press_in_test_goes_by_duty(void) {
+  startTest(95);
+  fsm.dispatch(EV_LONG);
+  expectState(ST_CT_HEAT);
+  toMenu();
+  startTest(100);
+  fsm.dispatch(EV_LONG);
+  expectState(ST_CHAR);
+}
+
+// A measured plant too weak for the profile's peak: neither the encoder
+// nor `start` may begin it, and it runs again once the limits allow
+void test_infeasible_profile_is_refused(void) {
+  PlantParams f = sensors.plantFront(), b = sensors.plantBack();
+  plantModel = PlantModel{};
+  plantModel.ambientC = 25.0f;
+  for (int p = 0; p < 2; p++) plantModel.fit[p][PLANT_ALL] = FopdtFit{0.1f, 0.0017f, 4.0f, 0.99f, 500};
+  plantModelValid = true;
+  applyPlantModel();
+
+  click(1);
+  expectState(ST_PROF_SETUP);
+  TEST_ASSERT_FALSE(fsm.dispatch(EV_CLICK));
+  expectState(ST_PROF_SETUP);
+  fsm.dispatch(EV_ABORT);
+  hostSerialInput("start\n");
+  for (int i = 0; i < 20; i++) loop();
+  expectState(ST_MENU);
+
+  plantModelValid = false;
+  sensors.setPlantParams(f, b);
+  applyPlantModel();
+  startProfile();
+}
+
+// ---- Profile phases ----
+
+void test_phase_events_move_between_phases(void) {
+  startProfile();
+  const uint8_t order[] = {ST_SOAK, ST_REFLOW, ST_COOL, ST_PREHEAT};
+  for (uint8_t st : order) {
+    TEST_ASSERT_TRUE(fsm.dispatch(EV_PHASE_PREHEAT + (st - ST_PREHEAT)));
+    expectState(st);
+    TEST_ASSERT_TRUE(fsm.in(ST_PROFILE));
+    TEST_ASSERT_EQUAL(PROFILE_RUN, currentMode);
+  }
+}
+
+void test_phase_events_ignored_outside_a_profile(void) {
+  for (uint8_t ev = EV_PHASE_PREHEAT; ev <= EV_PHASE_COOL; ev++)
+    TEST_ASSERT_FALSE(fsm.dispatch(ev));
+  expectState(ST_MENU);
+  startConst();
+  for (uint8_t ev = EV_PHASE_PREHEAT; ev <= EV_PHASE_COOL; ev++)
+    TEST_ASSERT_FALSE(fsm.dispatch(ev));
+  expectState(ST_CONST);
+}
+
+// Ticks alone carry a profile through its phases in order to DONE
+void test_ticks_walk_the_phases(void) {
+  startProfile();
+  uint8_t seen[8], n = 0;
+  seen[n++] = fsm.state();
+  for (int sec = 0; sec < 4 * 3600 && fsm.in(ST_RUN); sec++) {
+    hostAdvanceMs(1000);
+    fsm.dispatch(EV_TICK);
+    if (fsm.state() != seen[n - 1] && n < sizeof(seen)) seen[n++] = fsm.state();
+  }
+  const uint8_t want[] = {ST_PREHEAT, ST_SOAK, ST_REFLOW, ST_COOL, ST_DONE};
+  TEST_ASSERT_EQUAL(sizeof(want), n);
+  TEST_ASSERT_EQUAL_MEMORY(want, seen, sizeof(want));
+  TEST_ASSERT_FALSE(runAborted);
+  TEST_ASSERT_EQUAL(PROFILE_RUN, currentMode);
+}
+
+// Turning during a long hold caps held + left at 10 h; the sum used to
+// wrap in the uint16 hold and end the run early
+void test_hold_edit_is_capped(void) {
+  int temp = constTemp, secs = constDuration;
+  constTemp = 0;
+  constDuration = 36000;
+  startConst();
+  // A lower target the plates never reach: timed from the reach timeout
+  for (int i = 0; i < 3; i++) {
+    hostAdvanceMs(601 * 1000UL);
+    fsm.dispatch(EV_TICK);
+  }
+  hostAdvanceMs(30000 * 1000UL);
+  fsm.dispatch(EV_TICK);
+  encoderSteps = 1000;
+  fsm.dispatch(EV_TURN);
+  TEST_ASSERT_EQUAL(36000, constDuration);
+  hostAdvanceMs(1000);
+  fsm.dispatch(EV_TICK);
+  expectState(ST_CONST);
+  encoderSteps = -1000;
+  fsm.dispatch(EV_TURN);
+  TEST_ASSERT_GREATER_THAN(30000, constDuration);   // never below the time already held
+  TEST_ASSERT_LESS_THAN(32000, constDuration);
+  constTemp = temp;
+  constDuration = secs;
+}
+
+// ---- Abort paths ----
+
+void test_click_aborts_a_run_to_done(void) {
+  startProfile();
+  fsm.dispatch(EV_PHASE_REFLOW);
+  fsm.dispatch(EV_CLICK);
+  expectState(ST_DONE);
+  TEST_ASSERT_TRUE(runAborted);
+  TEST_ASSERT_EQUAL(0, heater.dutyFrontPct());
+  TEST_ASSERT_EQUAL(0, heater.dutyBackPct());
+  fsm.dispatch(EV_CLICK);
+  expectState(ST_MENU);
+}
+
+void test_remote_abort_from_each_state(void) {
+  startConst();
+  hostAdvanceMs(1000);
+  fsm.dispatch(EV_TICK);
+  fsm.dispatch(EV_ABORT);
+  expectState(ST_DONE);
+  TEST_ASSERT_TRUE(runAborted);
+  TEST_ASSERT_EQUAL(CONST_RUN, currentMode);   // DONE keeps the run's mode
+  fsm.dispatch(EV_ABORT);
+  expectState(ST_MENU);
+
+  click(1);
+  fsm.dispatch(EV_ABORT);
+  expectState(ST_MENU);
+  click(2);
+  fsm.dispatch(EV_ABORT);
+  expectState(ST_MENU);
+
+  startTest(50);
+  fsm.dispatch(EV_ABORT);
+  expectState(ST_MENU);
+  TEST_ASSERT_EQUAL(0, heater.dutyFrontPct());
+
+  startTest(95);
+  fsm.dispatch(EV_LONG);
+  fsm.dispatch(EV_ABORT);
+  expectState(ST_MENU);
+
+  startTest(100);
+  fsm.dispatch(EV_LONG);
+  fsm.dispatch(EV_ABORT);
+  expectState(ST_MENU);
+}
+
+void test_long_press_leaves_a_run_for_the_menu(void) {
+  heatSelection = HEAT_FRONT;
+  startProfile();
+  fsm.dispatch(EV_LONG);
+  expectState(ST_MENU);
+  TEST_ASSERT_EQUAL(HEAT_BOTH, heatSelection);   // longPressReset
+  startConst();
+  fsm.dispatch(EV_LONG);
+  expectState(ST_MENU);
+}
+
+void test_abort_in_menu_stays(void) {
+  fsm.dispatch(EV_ABORT);
+  expectState(ST_MENU);
+}
+
+// ---- Faults ----
+
+static void enterAndFault(uint8_t target) {
+  toMenu();
+  switch (target) {
+    case ST_PREHEAT: case ST_SOAK: case ST_REFLOW: case ST_COOL:
+      startProfile();
+      if (target != ST_PREHEAT) fsm.dispatch(EV_PHASE_PREHEAT + (target - ST_PREHEAT));
+      break;
+    case ST_CONST:
+      startConst();
+      break;
+    case ST_TEST:
+      startTest(50);
+      break;
+    case ST_CT_HEAT:
+    case ST_CT_COOL:
+      startTest(50);
+      fsm.dispatch(EV_LONG);
+      if (target == ST_CT_COOL) fsm.dispatch(EV_AT_TEMP);
+      break;
+    case ST_CHAR:
+      startTest(100);
+      fsm.dispatch(EV_LONG);
+      break;
+  }
+  expectState(target);
+  TEST_ASSERT_TRUE(fsm.dispatch(EV_FAULT));
+  expectState(ST_FAULT);
+  TEST_ASSERT_EQUAL(FAULT, currentMode);
+  TEST_ASSERT_EQUAL(0, heater.dutyFrontPct());
+  TEST_ASSERT_EQUAL(0, heater.dutyBackPct());
+}
+
+void test_fault_from_every_heating_state(void) {
+  const uint8_t states[] = {ST_PREHEAT, ST_SOAK, ST_REFLOW, ST_COOL, ST_CONST,
+                            ST_TEST, ST_CT_HEAT, ST_CT_COOL, ST_CHAR};
+  for (uint8_t st : states) {
+    enterAndFault(st);
+    fsm.dispatch(EV_CLICK);   // sensors are fine: the fault clears
+    expectState(ST_MENU);
+  }
+}
+
+void test_fault_ignored_while_nothing_heats(void) {
+  TEST_ASSERT_FALSE(fsm.dispatch(EV_FAULT));
+  expectState(ST_MENU);
+  click(1);
+  TEST_ASSERT_FALSE(fsm.dispatch(EV_FAULT));
+  expectState(ST_PROF_SETUP);
+}
+
+// An open thermistor faults the run from loop(); the fault holds until it reads again
+void test_sensor_fault_holds_until_cleared(void) {
+  startConst();
+  setThermistors(0);
+  for (int i = 0; i < 50 && fsm.state() != ST_FAULT; i++) loop();
+  expectState(ST_FAULT);
+
+  fsm.dispatch(EV_CLICK);
+  expectState(ST_FAULT);
+  fsm.dispatch(EV_LONG);
+  expectState(ST_FAULT);
+  TEST_ASSERT_FALSE(fsm.dispatch(EV_ABORT));
+  expectState(ST_FAULT);
+
+  setThermistors(2000);
+  for (int i = 0; i < 50; i++) loop();
+  expectState(ST_FAULT);   // clearing needs the user
+  fsm.dispatch(EV_CLICK);
+  expectState(ST_MENU);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_boots_to_menu);
+  RUN_TEST(test_runs_refused_without_heaters);
+  RUN_TEST(test_const_setup_walks_every_field);
+  RUN_TEST(test_long_press_in_test_goes_by_duty);
+  RUN_TEST(test_infeasible_profile_is_refused);
+  RUN_TEST(test_phase_events_move_between_phases);
+  RUN_TEST(test_phase_events_ignored_outside_a_profile);
+  RUN_TEST(test_ticks_walk_the_phases);
+  RUN_TEST(test_hold_edit_is_capped);
+  RUN_TEST(test_click_aborts_a_run_to_done);
+  RUN_TEST(test_remote_abort_from_each_state);
+  RUN_TEST(test_long_press_leaves_a_run_for_the_menu);
+  RUN_TEST(test_abort_in_menu_stays);
+  RUN_TEST(test_fault_from_every_heating_state);
+  RUN_TEST(test_fault_ignored_while_nothing_heats);
+  RUN_TEST(test_sensor_fault_holds_until_cleared);
+  return UNITY_END();
+}
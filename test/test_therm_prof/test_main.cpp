@@ -0,0 +1,60 @@
+// The segment-encoded plate trace against the original recording
+#include <unity.h>
+#include "thermProf.h"
+#include "thermProfRecorded.h"
+
+static const size_t RECORDED_LENGTH = sizeof(THERM_PROF_RECORDED) / sizeof(THERM_PROF_RECORDED[0]);
+static const float TOLERANCE_C = 0.05f;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_length_matches(void) {
+  TEST_ASSERT_EQUAL(RECORDED_LENGTH, THERM_PROF_LENGTH);
+  uint32_t n = 0;
+  for (uint8_t k = 0; k < THERM_PROF_SEGMENT_COUNT; k++) n += THERM_PROF_SEGMENTS[k].count;
+  TEST_ASSERT_EQUAL_UINT32(THERM_PROF_LENGTH, n);
+}
+
+void test_streamed_samples_match(void) {
+  ThermProfReader r;
+  float t, worst = 0;
+  size_t i = 0, worstAt = 0;
+  while (r.next(t)) {
+    TEST_ASSERT_LESS_THAN(RECORDED_LENGTH, i);
+    float err = fabsf(t - THERM_PROF_RECORDED[i]);
+    if (err > worst) { worst = err; worstAt = i; }
+    i++;
+  }
+  TEST_ASSERT_EQUAL(RECORDED_LENGTH, i);
+
+  char msg[64];
+  snprintf(msg, sizeof(msg), "worst error %.4f C at sample %u", worst, (unsigned)worstAt);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_TRUE_MESSAGE(worst <= TOLERANCE_C, msg);
+}
+
+void test_random_access_matches(void) {
+  for (uint16_t i = 0; i < THERM_PROF_LENGTH; i++)
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE_C, THERM_PROF_RECORDED[i], ThermProfReader::at(i));
+  TEST_ASSERT_TRUE(isnan(ThermProfReader::at(THERM_PROF_LENGTH)));
+}
+
+void test_rewind_restarts(void) {
+  ThermProfReader r;
+  float a, b;
+  r.next(a);
+  for (int i = 0; i < 100; i++) r.next(b);
+  r.rewind();
+  r.next(b);
+  TEST_ASSERT_EQUAL_FLOAT(a, b);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_length_matches);
+  RUN_TEST(test_streamed_samples_match);
+  RUN_TEST(test_random_access_matches);
+  RUN_TEST(test_rewind_restarts);
+  return UNITY_END();
+}
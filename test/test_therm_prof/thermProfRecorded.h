@@ -0,0 +1,4017 @@
+// The plate trace as originally recorded (one sample per 250 ms, °C),
+// kept verbatim so the segment table in src/thermProf.cpp can be checked
+// against it.
+#pragma once
+
+static const float THERM_PROF_RECORDED[] = {
+23,
+23.4545454545455,
+23.9090909090909,
+24.3636363636364,
+24.8181818181818,
+25.2727272727273,
+25.7272727272727,
+26.1818181818182,
+26.6363636363636,
+27.0909090909091,
+27.5454545454545,
+24,
+24.7142857142857,
+25.4285714285714,
+26.1428571428571,
+26.8571428571429,
+27.5714285714286,
+28.2857142857143,
+25,
+25.4166666666667,
+25.8333333333333,
+26.25,
+26.6666666666667,
+27.0833333333333,
+27.5,
+27.9166666666667,
+28.3333333333333,
+28.75,
+29.1666666666667,
+29.5833333333333,
+26,
+26.3846153846154,
+26.7692307692308,
+27.1538461538462,
+27.5384615384615,
+27.9230769230769,
+28.3076923076923,
+28.6923076923077,
+29.0769230769231,
+29.4615384615385,
+29.8461538461538,
+30.2307692307692,
+30.6153846153846,
+27,
+27.4166666666667,
+27.8333333333333,
+28.25,
+28.6666666666667,
+29.0833333333333,
+29.5,
+29.9166666666667,
+30.3333333333333,
+30.75,
+31.1666666666667,
+31.5833333333333,
+28,
+28.5,
+29,
+29.5,
+30,
+30.5,
+30,
+30.7142857142857,
+31.4285714285714,
+32.1428571428571,
+29,
+27.75,
+26.5,
+31,
+31.5555555555556,
+32.1111111111111,
+32.6666666666667,
+33.2222222222222,
+33.7777777777778,
+34.3333333333333,
+34.8888888888889,
+35.4444444444444,
+32,
+32.5,
+33,
+33.5,
+34,
+34.5,
+35,
+35.5,
+36,
+36.5,
+33,
+33.5,
+34,
+34.5,
+35,
+35.5,
+36,
+36.5,
+37,
+37.5,
+34,
+34.5,
+35,
+35.5,
+36,
+36.5,
+37,
+37.5,
+38,
+38.5,
+35,
+35.0892857142857,
+35.1785714285714,
+35.2678571428571,
+35.3571428571429,
+35.4464285714286,
+35.5357142857143,
+35.625,
+35.7142857142857,
+35.8035714285714,
+35.8928571428571,
+35.9821428571429,
+36.0714285714286,
+36.1607142857143,
+36.25,
+36.3392857142857,
+36.4285714285714,
+36.5178571428571,
+36.6071428571429,
+36.6964285714286,
+36.7857142857143,
+36.875,
+36.9642857142857,
+37.0535714285714,
+37.1428571428571,
+37.2321428571429,
+37.3214285714286,
+37.4107142857143,
+37.5,
+37.5892857142857,
+37.6785714285714,
+37.7678571428571,
+37.8571428571429,
+37.9464285714286,
+38.0357142857143,
+38.125,
+38.2142857142857,
+38.3035714285714,
+38.3928571428571,
+38.4821428571429,
+38.5714285714286,
+38.6607142857143,
+38.75,
+38.8392857142857,
+38.9285714285714,
+39.0178571428571,
+39.1071428571429,
+39.1964285714286,
+39.2857142857143,
+39.375,
+39.4642857142857,
+39.5535714285714,
+39.6428571428571,
+39.7321428571429,
+39.8214285714286,
+39.9107142857143,
+40,
+40.0675675675676,
+40.1351351351351,
+40.2027027027027,
+40.2702702702703,
+40.3378378378378,
+40.4054054054054,
+40.472972972973,
+40.5405405405405,
+40.6081081081081,
+40.6756756756757,
+40.7432432432432,
+40.8108108108108,
+40.8783783783784,
+40.9459459459459,
+41.0135135135135,
+41.0810810810811,
+41.1486486486486,
+41.2162162162162,
+41.2837837837838,
+41.3513513513514,
+41.4189189189189,
+41.4864864864865,
+41.5540540540541,
+41.6216216216216,
+41.6891891891892,
+41.7567567567568,
+41.8243243243243,
+41.8918918918919,
+41.9594594594595,
+42.027027027027,
+42.0945945945946,
+42.1621621621622,
+42.2297297297297,
+42.2972972972973,
+42.3648648648649,
+42.4324324324324,
+42.5,
+42.5675675675676,
+42.6351351351351,
+42.7027027027027,
+42.7702702702703,
+42.8378378378378,
+42.9054054054054,
+42.972972972973,
+43.0405405405405,
+43.1081081081081,
+43.1756756756757,
+43.2432432432432,
+43.3108108108108,
+43.3783783783784,
+43.4459459459459,
+43.5135135135135,
+43.5810810810811,
+43.6486486486486,
+43.7162162162162,
+43.7837837837838,
+43.8513513513514,
+43.9189189189189,
+43.9864864864865,
+44.0540540540541,
+44.1216216216216,
+44.1891891891892,
+44.2567567567568,
+44.3243243243243,
+44.3918918918919,
+44.4594594594595,
+44.527027027027,
+44.5945945945946,
+44.6621621621622,
+44.7297297297297,
+44.7972972972973,
+44.8648648648649,
+44.9324324324324,
+45,
+45.0833333333333,
+45.1666666666667,
+45.25,
+45.3333333333333,
+45.4166666666667,
+45.5,
+45.5833333333333,
+45.6666666666667,
+45.75,
+45.8333333333333,
+45.9166666666667,
+46,
+46.0833333333333,
+46.1666666666667,
+46.25,
+46.3333333333333,
+46.4166666666667,
+46.5,
+46.5833333333333,
+46.6666666666667,
+46.75,
+46.8333333333333,
+46.9166666666667,
+47,
+47.0833333333333,
+47.1666666666667,
+47.25,
+47.3333333333333,
+47.4166666666667,
+47.5,
+47.5833333333333,
+47.6666666666667,
+47.75,
+47.8333333333333,
+47.9166666666667,
+48,
+48.0833333333333,
+48.1666666666667,
+48.25,
+48.3333333333333,
+48.4166666666667,
+48.5,
+48.5833333333333,
+48.6666666666667,
+48.75,
+48.8333333333333,
+48.9166666666667,
+49,
+49.0833333333333,
+49.1666666666667,
+49.25,
+49.3333333333333,
+49.4166666666667,
+49.5,
+49.5833333333333,
+49.6666666666667,
+49.75,
+49.8333333333333,
+49.9166666666667,
+50,
+50.0793650793651,
+50.1587301587302,
+50.2380952380952,
+50.3174603174603,
+50.3968253968254,
+50.4761904761905,
+50.5555555555556,
+50.6349206349206,
+50.7142857142857,
+50.7936507936508,
+50.8730158730159,
+50.9523809523809,
+51.031746031746,
+51.1111111111111,
+51.1904761904762,
+51.2698412698413,
+51.3492063492063,
+51.4285714285714,
+51.5079365079365,
+51.5873015873016,
+51.6666666666667,
+51.7460317460317,
+51.8253968253968,
+51.9047619047619,
+51.984126984127,
+52.0634920634921,
+52.1428571428571,
+52.2222222222222,
+52.3015873015873,
+52.3809523809524,
+52.4603174603175,
+52.5396825396825,
+52.6190476190476,
+52.6984126984127,
+52.7777777777778,
+52.8571428571429,
+52.9365079365079,
+53.015873015873,
+53.0952380952381,
+53.1746031746032,
+53.2539682539683,
+53.3333333333333,
+53.4126984126984,
+53.4920634920635,
+53.5714285714286,
+53.6507936507937,
+53.7301587301587,
+53.8095238095238,
+53.8888888888889,
+53.968253968254,
+54.0476190476191,
+54.1269841269841,
+54.2063492063492,
+54.2857142857143,
+54.3650793650794,
+54.4444444444444,
+54.5238095238095,
+54.6031746031746,
+54.6825396825397,
+54.7619047619048,
+54.8412698412698,
+54.9206349206349,
+55,
+55.0454545454545,
+55.0909090909091,
+55.1363636363636,
+55.1818181818182,
+55.2272727272727,
+55.2727272727273,
+55.3181818181818,
+55.3636363636364,
+55.4090909090909,
+55.4545454545455,
+55.5,
+55.5454545454545,
+55.5909090909091,
+55.6363636363636,
+55.6818181818182,
+55.7272727272727,
+55.7727272727273,
+55.8181818181818,
+55.8636363636364,
+55.9090909090909,
+55.9545454545455,
+56,
+56.0454545454545,
+56.0909090909091,
+56.1363636363636,
+56.1818181818182,
+56.2272727272727,
+56.2727272727273,
+56.3181818181818,
+56.3636363636364,
+56.4090909090909,
+56.4545454545455,
+56.5,
+56.5454545454545,
+56.5909090909091,
+56.6363636363636,
+56.6818181818182,
+56.7272727272727,
+56.7727272727273,
+56.8181818181818,
+56.8636363636364,
+56.9090909090909,
+56.9545454545455,
+57,
+57.0454545454545,
+57.0909090909091,
+57.1363636363636,
+57.1818181818182,
+57.2272727272727,
+57.2727272727273,
+57.3181818181818,
+57.3636363636364,
+57.4090909090909,
+57.4545454545455,
+57.5,
+57.5454545454545,
+57.5909090909091,
+57.6363636363636,
+57.6818181818182,
+57.7272727272727,
+57.7727272727273,
+57.8181818181818,
+57.8636363636364,
+57.9090909090909,
+57.9545454545455,
+58,
+58.0454545454545,
+58.0909090909091,
+58.1363636363636,
+58.1818181818182,
+58.2272727272727,
+58.2727272727273,
+58.3181818181818,
+58.3636363636364,
+58.4090909090909,
+58.4545454545455,
+58.5,
+58.5454545454545,
+58.5909090909091,
+58.6363636363636,
+58.6818181818182,
+58.7272727272727,
+58.7727272727273,
+58.8181818181818,
+58.8636363636364,
+58.9090909090909,
+58.9545454545455,
+59,
+59.0454545454545,
+59.0909090909091,
+59.1363636363636,
+59.1818181818182,
+59.2272727272727,
+59.2727272727273,
+59.3181818181818,
+59.3636363636364,
+59.4090909090909,
+59.4545454545455,
+59.5,
+59.5454545454545,
+59.5909090909091,
+59.6363636363636,
+59.6818181818182,
+59.7272727272727,
+59.7727272727273,
+59.8181818181818,
+59.8636363636364,
+59.9090909090909,
+59.9545454545455,
+60,
+60.0684931506849,
+60.1369863013699,
+60.2054794520548,
+60.2739726027397,
+60.3424657534247,
+60.4109589041096,
+60.4794520547945,
+60.5479452054795,
+60.6164383561644,
+60.6849315068493,
+60.7534246575342,
+60.8219178082192,
+60.8904109589041,
+60.958904109589,
+61.027397260274,
+61.0958904109589,
+61.1643835616438,
+61.2328767123288,
+61.3013698630137,
+61.3698630136986,
+61.4383561643836,
+61.5068493150685,
+61.5753424657534,
+61.6438356164384,
+61.7123287671233,
+61.7808219178082,
+61.8493150684931,
+61.9178082191781,
+61.986301369863,
+62.0547945205479,
+62.1232876712329,
+62.1917808219178,
+62.2602739726027,
+62.3287671232877,
+62.3972602739726,
+62.4657534246575,
+62.5342465753425,
+62.6027397260274,
+62.6712328767123,
+62.7397260273973,
+62.8082191780822,
+62.8767123287671,
+62.9452054794521,
+63.013698630137,
+63.0821917808219,
+63.1506849315069,
+63.2191780821918,
+63.2876712328767,
+63.3561643835616,
+63.4246575342466,
+63.4931506849315,
+63.5616438356164,
+63.6301369863014,
+63.6986301369863,
+63.7671232876712,
+63.8356164383562,
+63.9041095890411,
+63.972602739726,
+64.041095890411,
+64.1095890410959,
+64.1780821917808,
+64.2465753424657,
+64.3150684931507,
+64.3835616438356,
+64.4520547945205,
+64.5205479452055,
+64.5890410958904,
+64.6575342465753,
+64.7260273972603,
+64.7945205479452,
+64.8630136986301,
+64.9315068493151,
+65,
+65.045045045045,
+65.0900900900901,
+65.1351351351351,
+65.1801801801802,
+65.2252252252252,
+65.2702702702703,
+65.3153153153153,
+65.3603603603604,
+65.4054054054054,
+65.4504504504504,
+65.4954954954955,
+65.5405405405405,
+65.5855855855856,
+65.6306306306306,
+65.6756756756757,
+65.7207207207207,
+65.7657657657658,
+65.8108108108108,
+65.8558558558559,
+65.9009009009009,
+65.945945945946,
+65.990990990991,
+66.036036036036,
+66.0810810810811,
+66.1261261261261,
+66.1711711711712,
+66.2162162162162,
+66.2612612612613,
+66.3063063063063,
+66.3513513513514,
+66.3963963963964,
+66.4414414414414,
+66.4864864864865,
+66.5315315315315,
+66.5765765765766,
+66.6216216216216,
+66.6666666666667,
+66.7117117117117,
+66.7567567567568,
+66.8018018018018,
+66.8468468468468,
+66.8918918918919,
+66.9369369369369,
+66.981981981982,
+67.027027027027,
+67.0720720720721,
+67.1171171171171,
+67.1621621621622,
+67.2072072072072,
+67.2522522522522,
+67.2972972972973,
+67.3423423423423,
+67.3873873873874,
+67.4324324324324,
+67.4774774774775,
+67.5225225225225,
+67.5675675675676,
+67.6126126126126,
+67.6576576576577,
+67.7027027027027,
+67.7477477477478,
+67.7927927927928,
+67.8378378378378,
+67.8828828828829,
+67.9279279279279,
+67.972972972973,
+68.018018018018,
+68.0630630630631,
+68.1081081081081,
+68.1531531531532,
+68.1981981981982,
+68.2432432432432,
+68.2882882882883,
+68.3333333333333,
+68.3783783783784,
+68.4234234234234,
+68.4684684684685,
+68.5135135135135,
+68.5585585585586,
+68.6036036036036,
+68.6486486486486,
+68.6936936936937,
+68.7387387387387,
+68.7837837837838,
+68.8288288288288,
+68.8738738738739,
+68.9189189189189,
+68.963963963964,
+69.009009009009,
+69.054054054054,
+69.0990990990991,
+69.1441441441441,
+69.1891891891892,
+69.2342342342342,
+69.2792792792793,
+69.3243243243243,
+69.3693693693694,
+69.4144144144144,
+69.4594594594595,
+69.5045045045045,
+69.5495495495496,
+69.5945945945946,
+69.6396396396396,
+69.6846846846847,
+69.7297297297297,
+69.7747747747748,
+69.8198198198198,
+69.8648648648649,
+69.9099099099099,
+69.954954954955,
+70,
+70.0420168067227,
+70.0840336134454,
+70.1260504201681,
+70.1680672268908,
+70.2100840336134,
+70.2521008403361,
+70.2941176470588,
+70.3361344537815,
+70.3781512605042,
+70.4201680672269,
+70.4621848739496,
+70.5042016806723,
+70.546218487395,
+70.5882352941177,
+70.6302521008403,
+70.672268907563,
+70.7142857142857,
+70.7563025210084,
+70.7983193277311,
+70.8403361344538,
+70.8823529411765,
+70.9243697478992,
+70.9663865546218,
+71.0084033613445,
+71.0504201680672,
+71.0924369747899,
+71.1344537815126,
+71.1764705882353,
+71.218487394958,
+71.2605042016807,
+71.3025210084034,
+71.344537815126,
+71.3865546218487,
+71.4285714285714,
+71.4705882352941,
+71.5126050420168,
+71.5546218487395,
+71.5966386554622,
+71.6386554621849,
+71.6806722689076,
+71.7226890756303,
+71.7647058823529,
+71.8067226890756,
+71.8487394957983,
+71.890756302521,
+71.9327731092437,
+71.9747899159664,
+72.0168067226891,
+72.0588235294118,
+72.1008403361345,
+72.1428571428571,
+72.1848739495798,
+72.2268907563025,
+72.2689075630252,
+72.3109243697479,
+72.3529411764706,
+72.3949579831933,
+72.436974789916,
+72.4789915966387,
+72.5210084033613,
+72.563025210084,
+72.6050420168067,
+72.6470588235294,
+72.6890756302521,
+72.7310924369748,
+72.7731092436975,
+72.8151260504202,
+72.8571428571429,
+72.8991596638655,
+72.9411764705882,
+72.9831932773109,
+73.0252100840336,
+73.0672268907563,
+73.109243697479,
+73.1512605042017,
+73.1932773109244,
+73.2352941176471,
+73.2773109243697,
+73.3193277310924,
+73.3613445378151,
+73.4033613445378,
+73.4453781512605,
+73.4873949579832,
+73.5294117647059,
+73.5714285714286,
+73.6134453781513,
+73.655462184874,
+73.6974789915966,
+73.7394957983193,
+73.781512605042,
+73.8235294117647,
+73.8655462184874,
+73.9075630252101,
+73.9495798319328,
+73.9915966386555,
+74.0336134453782,
+74.0756302521008,
+74.1176470588235,
+74.1596638655462,
+74.2016806722689,
+74.2436974789916,
+74.2857142857143,
+74.327731092437,
+74.3697478991597,
+74.4117647058823,
+74.453781512605,
+74.4957983193277,
+74.5378151260504,
+74.5798319327731,
+74.6218487394958,
+74.6638655462185,
+74.7058823529412,
+74.7478991596639,
+74.7899159663866,
+74.8319327731092,
+74.8739495798319,
+74.9159663865546,
+74.9579831932773,
+75,
+75.036496350365,
+75.0729927007299,
+75.1094890510949,
+75.1459854014599,
+75.1824817518248,
+75.2189781021898,
+75.2554744525548,
+75.2919708029197,
+75.3284671532847,
+75.3649635036496,
+75.4014598540146,
+75.4379562043796,
+75.4744525547445,
+75.5109489051095,
+75.5474452554745,
+75.5839416058394,
+75.6204379562044,
+75.6569343065693,
+75.6934306569343,
+75.7299270072993,
+75.7664233576642,
+75.8029197080292,
+75.8394160583942,
+75.8759124087591,
+75.9124087591241,
+75.948905109489,
+75.985401459854,
+76.021897810219,
+76.0583941605839,
+76.0948905109489,
+76.1313868613139,
+76.1678832116788,
+76.2043795620438,
+76.2408759124088,
+76.2773722627737,
+76.3138686131387,
+76.3503649635037,
+76.3868613138686,
+76.4233576642336,
+76.4598540145985,
+76.4963503649635,
+76.5328467153285,
+76.5693430656934,
+76.6058394160584,
+76.6423357664234,
+76.6788321167883,
+76.7153284671533,
+76.7518248175183,
+76.7883211678832,
+76.8248175182482,
+76.8613138686131,
+76.8978102189781,
+76.9343065693431,
+76.970802919708,
+77.007299270073,
+77.043795620438,
+77.0802919708029,
+77.1167883211679,
+77.1532846715328,
+77.1897810218978,
+77.2262773722628,
+77.2627737226277,
+77.2992700729927,
+77.3357664233577,
+77.3722627737226,
+77.4087591240876,
+77.4452554744526,
+77.4817518248175,
+77.5182481751825,
+77.5547445255474,
+77.5912408759124,
+77.6277372262774,
+77.6642335766423,
+77.7007299270073,
+77.7372262773723,
+77.7737226277372,
+77.8102189781022,
+77.8467153284672,
+77.8832116788321,
+77.9197080291971,
+77.956204379562,
+77.992700729927,
+78.029197080292,
+78.0656934306569,
+78.1021897810219,
+78.1386861313869,
+78.1751824817518,
+78.2116788321168,
+78.2481751824818,
+78.2846715328467,
+78.3211678832117,
+78.3576642335766,
+78.3941605839416,
+78.4306569343066,
+78.4671532846715,
+78.5036496350365,
+78.5401459854015,
+78.5766423357664,
+78.6131386861314,
+78.6496350364963,
+78.6861313868613,
+78.7226277372263,
+78.7591240875912,
+78.7956204379562,
+78.8321167883212,
+78.8686131386861,
+78.9051094890511,
+78.9416058394161,
+78.978102189781,
+79.014598540146,
+79.051094890511,
+79.0875912408759,
+79.1240875912409,
+79.1605839416058,
+79.1970802919708,
+79.2335766423358,
+79.2700729927007,
+79.3065693430657,
+79.3430656934307,
+79.3795620437956,
+79.4160583941606,
+79.4525547445255,
+79.4890510948905,
+79.5255474452555,
+79.5620437956204,
+79.5985401459854,
+79.6350364963504,
+79.6715328467153,
+79.7080291970803,
+79.7445255474452,
+79.7810218978102,
+79.8175182481752,
+79.8540145985401,
+79.8905109489051,
+79.9270072992701,
+79.963503649635,
+80,
+80.0423728813559,
+80.0847457627119,
+80.1271186440678,
+80.1694915254237,
+80.2118644067797,
+80.2542372881356,
+80.2966101694915,
+80.3389830508475,
+80.3813559322034,
+80.4237288135593,
+80.4661016949153,
+80.5084745762712,
+80.5508474576271,
+80.593220338983,
+80.635593220339,
+80.6779661016949,
+80.7203389830509,
+80.7627118644068,
+80.8050847457627,
+80.8474576271186,
+80.8898305084746,
+80.9322033898305,
+80.9745762711864,
+81.0169491525424,
+81.0593220338983,
+81.1016949152542,
+81.1440677966102,
+81.1864406779661,
+81.228813559322,
+81.271186440678,
+81.3135593220339,
+81.3559322033898,
+81.3983050847458,
+81.4406779661017,
+81.4830508474576,
+81.5254237288136,
+81.5677966101695,
+81.6101694915254,
+81.6525423728814,
+81.6949152542373,
+81.7372881355932,
+81.7796610169491,
+81.8220338983051,
+81.864406779661,
+81.906779661017,
+81.9491525423729,
+81.9915254237288,
+82.0338983050847,
+82.0762711864407,
+82.1186440677966,
+82.1610169491525,
+82.2033898305085,
+82.2457627118644,
+82.2881355932203,
+82.3305084745763,
+82.3728813559322,
+82.4152542372881,
+82.4576271186441,
+82.5,
+82.5423728813559,
+82.5847457627119,
+82.6271186440678,
+82.6694915254237,
+82.7118644067797,
+82.7542372881356,
+82.7966101694915,
+82.8389830508475,
+82.8813559322034,
+82.9237288135593,
+82.9661016949153,
+83.0084745762712,
+83.0508474576271,
+83.093220338983,
+83.135593220339,
+83.1779661016949,
+83.2203389830509,
+83.2627118644068,
+83.3050847457627,
+83.3474576271186,
+83.3898305084746,
+83.4322033898305,
+83.4745762711864,
+83.5169491525424,
+83.5593220338983,
+83.6016949152542,
+83.6440677966102,
+83.6864406779661,
+83.728813559322,
+83.771186440678,
+83.8135593220339,
+83.8559322033898,
+83.8983050847458,
+83.9406779661017,
+83.9830508474576,
+84.0254237288136,
+84.0677966101695,
+84.1101694915254,
+84.1525423728814,
+84.1949152542373,
+84.2372881355932,
+84.2796610169491,
+84.3220338983051,
+84.364406779661,
+84.406779661017,
+84.4491525423729,
+84.4915254237288,
+84.5338983050847,
+84.5762711864407,
+84.6186440677966,
+84.6610169491525,
+84.7033898305085,
+84.7457627118644,
+84.7881355932203,
+84.8305084745763,
+84.8728813559322,
+84.9152542372881,
+84.9576271186441,
+85,
+85.045871559633,
+85.0917431192661,
+85.1376146788991,
+85.1834862385321,
+85.2293577981651,
+85.2752293577982,
+85.3211009174312,
+85.3669724770642,
+85.4128440366973,
+85.4587155963303,
+85.5045871559633,
+85.5504587155963,
+85.5963302752294,
+85.6422018348624,
+85.6880733944954,
+85.7339449541284,
+85.7798165137615,
+85.8256880733945,
+85.8715596330275,
+85.9174311926605,
+85.9633027522936,
+86.0091743119266,
+86.0550458715596,
+86.1009174311927,
+86.1467889908257,
+86.1926605504587,
+86.2385321100917,
+86.2844036697248,
+86.3302752293578,
+86.3761467889908,
+86.4220183486239,
+86.4678899082569,
+86.5137614678899,
+86.5596330275229,
+86.605504587156,
+86.651376146789,
+86.697247706422,
+86.743119266055,
+86.7889908256881,
+86.8348623853211,
+86.8807339449541,
+86.9266055045872,
+86.9724770642202,
+87.0183486238532,
+87.0642201834862,
+87.1100917431193,
+87.1559633027523,
+87.2018348623853,
+87.2477064220184,
+87.2935779816514,
+87.3394495412844,
+87.3853211009174,
+87.4311926605505,
+87.4770642201835,
+87.5229357798165,
+87.5688073394495,
+87.6146788990826,
+87.6605504587156,
+87.7064220183486,
+87.7522935779816,
+87.7981651376147,
+87.8440366972477,
+87.8899082568807,
+87.9357798165138,
+87.9816513761468,
+88.0275229357798,
+88.0733944954128,
+88.1192660550459,
+88.1651376146789,
+88.2110091743119,
+88.256880733945,
+88.302752293578,
+88.348623853211,
+88.394495412844,
+88.4403669724771,
+88.4862385321101,
+88.5321100917431,
+88.5779816513761,
+88.6238532110092,
+88.6697247706422,
+88.7155963302752,
+88.7614678899083,
+88.8073394495413,
+88.8532110091743,
+88.8990825688073,
+88.9449541284404,
+88.9908256880734,
+89.0366972477064,
+89.0825688073394,
+89.1284403669725,
+89.1743119266055,
+89.2201834862385,
+89.2660550458716,
+89.3119266055046,
+89.3577981651376,
+89.4036697247706,
+89.4495412844037,
+89.4954128440367,
+89.5412844036697,
+89.5871559633027,
+89.6330275229358,
+89.6788990825688,
+89.7247706422018,
+89.7706422018349,
+89.8165137614679,
+89.8623853211009,
+89.9082568807339,
+89.954128440367,
+90,
+90.036231884058,
+90.0724637681159,
+90.1086956521739,
+90.1449275362319,
+90.1811594202899,
+90.2173913043478,
+90.2536231884058,
+90.2898550724638,
+90.3260869565217,
+90.3623188405797,
+90.3985507246377,
+90.4347826086957,
+90.4710144927536,
+90.5072463768116,
+90.5434782608696,
+90.5797101449275,
+90.6159420289855,
+90.6521739130435,
+90.6884057971015,
+90.7246376811594,
+90.7608695652174,
+90.7971014492754,
+90.8333333333333,
+90.8695652173913,
+90.9057971014493,
+90.9420289855072,
+90.9782608695652,
+91.0144927536232,
+91.0507246376812,
+91.0869565217391,
+91.1231884057971,
+91.1594202898551,
+91.195652173913,
+91.231884057971,
+91.268115942029,
+91.304347826087,
+91.3405797101449,
+91.3768115942029,
+91.4130434782609,
+91.4492753623188,
+91.4855072463768,
+91.5217391304348,
+91.5579710144928,
+91.5942028985507,
+91.6304347826087,
+91.6666666666667,
+91.7028985507246,
+91.7391304347826,
+91.7753623188406,
+91.8115942028985,
+91.8478260869565,
+91.8840579710145,
+91.9202898550725,
+91.9565217391304,
+91.9927536231884,
+92.0289855072464,
+92.0652173913043,
+92.1014492753623,
+92.1376811594203,
+92.1739130434783,
+92.2101449275362,
+92.2463768115942,
+92.2826086956522,
+92.3188405797101,
+92.3550724637681,
+92.3913043478261,
+92.4275362318841,
+92.463768115942,
+92.5,
+92.536231884058,
+92.5724637681159,
+92.6086956521739,
+92.6449275362319,
+92.6811594202899,
+92.7173913043478,
+92.7536231884058,
+92.7898550724638,
+92.8260869565217,
+92.8623188405797,
+92.8985507246377,
+92.9347826086957,
+92.9710144927536,
+93.0072463768116,
+93.0434782608696,
+93.0797101449275,
+93.1159420289855,
+93.1521739130435,
+93.1884057971015,
+93.2246376811594,
+93.2608695652174,
+93.2971014492754,
+93.3333333333333,
+93.3695652173913,
+93.4057971014493,
+93.4420289855072,
+93.4782608695652,
+93.5144927536232,
+93.5507246376812,
+93.5869565217391,
+93.6231884057971,
+93.6594202898551,
+93.695652173913,
+93.731884057971,
+93.768115942029,
+93.804347826087,
+93.8405797101449,
+93.8768115942029,
+93.9130434782609,
+93.9492753623188,
+93.9855072463768,
+94.0217391304348,
+94.0579710144928,
+94.0942028985507,
+94.1304347826087,
+94.1666666666667,
+94.2028985507246,
+94.2391304347826,
+94.2753623188406,
+94.3115942028985,
+94.3478260869565,
+94.3840579710145,
+94.4202898550725,
+94.4565217391304,
+94.4927536231884,
+94.5289855072464,
+94.5652173913043,
+94.6014492753623,
+94.6376811594203,
+94.6739130434783,
+94.7101449275362,
+94.7463768115942,
+94.7826086956522,
+94.8188405797101,
+94.8550724637681,
+94.8913043478261,
+94.9275362318841,
+94.963768115942,
+95,
+95.036231884058,
+95.0724637681159,
+95.1086956521739,
+95.1449275362319,
+95.1811594202899,
+95.2173913043478,
+95.2536231884058,
+95.2898550724638,
+95.3260869565217,
+95.3623188405797,
+95.3985507246377,
+95.4347826086957,
+95.4710144927536,
+95.5072463768116,
+95.5434782608696,
+95.5797101449275,
+95.6159420289855,
+95.6521739130435,
+95.6884057971015,
+95.7246376811594,
+95.7608695652174,
+95.7971014492754,
+95.8333333333333,
+95.8695652173913,
+95.9057971014493,
+95.9420289855072,
+95.9782608695652,
+96.0144927536232,
+96.0507246376812,
+96.0869565217391,
+96.1231884057971,
+96.1594202898551,
+96.195652173913,
+96.231884057971,
+96.268115942029,
+96.304347826087,
+96.3405797101449,
+96.3768115942029,
+96.4130434782609,
+96.4492753623188,
+96.4855072463768,
+96.5217391304348,
+96.5579710144928,
+96.5942028985507,
+96.6304347826087,
+96.6666666666667,
+96.7028985507246,
+96.7391304347826,
+96.7753623188406,
+96.8115942028985,
+96.8478260869565,
+96.8840579710145,
+96.9202898550725,
+96.9565217391304,
+96.9927536231884,
+97.0289855072464,
+97.0652173913043,
+97.1014492753623,
+97.1376811594203,
+97.1739130434783,
+97.2101449275362,
+97.2463768115942,
+97.2826086956522,
+97.3188405797101,
+97.3550724637681,
+97.3913043478261,
+97.4275362318841,
+97.463768115942,
+97.5,
+97.536231884058,
+97.5724637681159,
+97.6086956521739,
+97.6449275362319,
+97.6811594202899,
+97.7173913043478,
+97.7536231884058,
+97.7898550724638,
+97.8260869565217,
+97.8623188405797,
+97.8985507246377,
+97.9347826086957,
+97.9710144927536,
+98.0072463768116,
+98.0434782608696,
+98.0797101449275,
+98.1159420289855,
+98.1521739130435,
+98.1884057971015,
+98.2246376811594,
+98.2608695652174,
+98.2971014492754,
+98.3333333333333,
+98.3695652173913,
+98.4057971014493,
+98.4420289855072,
+98.4782608695652,
+98.5144927536232,
+98.5507246376812,
+98.5869565217391,
+98.6231884057971,
+98.6594202898551,
+98.695652173913,
+98.731884057971,
+98.768115942029,
+98.804347826087,
+98.8405797101449,
+98.8768115942029,
+98.9130434782609,
+98.9492753623188,
+98.9855072463768,
+99.0217391304348,
+99.0579710144928,
+99.0942028985507,
+99.1304347826087,
+99.1666666666667,
+99.2028985507246,
+99.2391304347826,
+99.2753623188406,
+99.3115942028985,
+99.3478260869565,
+99.3840579710145,
+99.4202898550725,
+99.4565217391304,
+99.4927536231884,
+99.5289855072464,
+99.5652173913043,
+99.6014492753623,
+99.6376811594203,
+99.6739130434783,
+99.7101449275362,
+99.7463768115942,
+99.7826086956522,
+99.8188405797101,
+99.8550724637681,
+99.8913043478261,
+99.9275362318841,
+99.963768115942,
+100,
+100.032051282051,
+100.064102564103,
+100.096153846154,
+100.128205128205,
+100.160256410256,
+100.192307692308,
+100.224358974359,
+100.25641025641,
+100.288461538462,
+100.320512820513,
+100.352564102564,
+100.384615384615,
+100.416666666667,
+100.448717948718,
+100.480769230769,
+100.512820512821,
+100.544871794872,
+100.576923076923,
+100.608974358974,
+100.641025641026,
+100.673076923077,
+100.705128205128,
+100.737179487179,
+100.769230769231,
+100.801282051282,
+100.833333333333,
+100.865384615385,
+100.897435897436,
+100.929487179487,
+100.961538461538,
+100.99358974359,
+101.025641025641,
+101.057692307692,
+101.089743589744,
+101.121794871795,
+101.153846153846,
+101.185897435897,
+101.217948717949,
+101.25,
+101.282051282051,
+101.314102564103,
+101.346153846154,
+101.378205128205,
+101.410256410256,
+101.442307692308,
+101.474358974359,
+101.50641025641,
+101.538461538462,
+101.570512820513,
+101.602564102564,
+101.634615384615,
+101.666666666667,
+101.698717948718,
+101.730769230769,
+101.762820512821,
+101.794871794872,
+101.826923076923,
+101.858974358974,
+101.891025641026,
+101.923076923077,
+101.955128205128,
+101.987179487179,
+102.019230769231,
+102.051282051282,
+102.083333333333,
+102.115384615385,
+102.147435897436,
+102.179487179487,
+102.211538461538,
+102.24358974359,
+102.275641025641,
+102.307692307692,
+102.339743589744,
+102.371794871795,
+102.403846153846,
+102.435897435897,
+102.467948717949,
+102.5,
+102.532051282051,
+102.564102564103,
+102.596153846154,
+102.628205128205,
+102.660256410256,
+102.692307692308,
+102.724358974359,
+102.75641025641,
+102.788461538462,
+102.820512820513,
+102.852564102564,
+102.884615384615,
+102.916666666667,
+102.948717948718,
+102.980769230769,
+103.012820512821,
+103.044871794872,
+103.076923076923,
+103.108974358974,
+103.141025641026,
+103.173076923077,
+103.205128205128,
+103.237179487179,
+103.269230769231,
+103.301282051282,
+103.333333333333,
+103.365384615385,
+103.397435897436,
+103.429487179487,
+103.461538461538,
+103.49358974359,
+103.525641025641,
+103.557692307692,
+103.589743589744,
+103.621794871795,
+103.653846153846,
+103.685897435897,
+103.717948717949,
+103.75,
+103.782051282051,
+103.814102564103,
+103.846153846154,
+103.878205128205,
+103.910256410256,
+103.942307692308,
+103.974358974359,
+104.00641025641,
+104.038461538462,
+104.070512820513,
+104.102564102564,
+104.134615384615,
+104.166666666667,
+104.198717948718,
+104.230769230769,
+104.262820512821,
+104.294871794872,
+104.326923076923,
+104.358974358974,
+104.391025641026,
+104.423076923077,
+104.455128205128,
+104.487179487179,
+104.519230769231,
+104.551282051282,
+104.583333333333,
+104.615384615385,
+104.647435897436,
+104.679487179487,
+104.711538461538,
+104.74358974359,
+104.775641025641,
+104.807692307692,
+104.839743589744,
+104.871794871795,
+104.903846153846,
+104.935897435897,
+104.967948717949,
+105,
+105.064935064935,
+105.12987012987,
+105.194805194805,
+105.25974025974,
+105.324675324675,
+105.38961038961,
+105.454545454545,
+105.519480519481,
+105.584415584416,
+105.649350649351,
+105.714285714286,
+105.779220779221,
+105.844155844156,
+105.909090909091,
+105.974025974026,
+106.038961038961,
+106.103896103896,
+106.168831168831,
+106.233766233766,
+106.298701298701,
+106.363636363636,
+106.428571428571,
+106.493506493506,
+106.558441558442,
+106.623376623377,
+106.688311688312,
+106.753246753247,
+106.818181818182,
+106.883116883117,
+106.948051948052,
+107.012987012987,
+107.077922077922,
+107.142857142857,
+107.207792207792,
+107.272727272727,
+107.337662337662,
+107.402597402597,
+107.467532467532,
+107.532467532468,
+107.597402597403,
+107.662337662338,
+107.727272727273,
+107.792207792208,
+107.857142857143,
+107.922077922078,
+107.987012987013,
+108.051948051948,
+108.116883116883,
+108.181818181818,
+108.246753246753,
+108.311688311688,
+108.376623376623,
+108.441558441558,
+108.506493506494,
+108.571428571429,
+108.636363636364,
+108.701298701299,
+108.766233766234,
+108.831168831169,
+108.896103896104,
+108.961038961039,
+109.025974025974,
+109.090909090909,
+109.155844155844,
+109.220779220779,
+109.285714285714,
+109.350649350649,
+109.415584415584,
+109.480519480519,
+109.545454545455,
+109.61038961039,
+109.675324675325,
+109.74025974026,
+109.805194805195,
+109.87012987013,
+109.935064935065,
+110,
+110.04132231405,
+110.082644628099,
+110.123966942149,
+110.165289256198,
+110.206611570248,
+110.247933884298,
+110.289256198347,
+110.330578512397,
+110.371900826446,
+110.413223140496,
+110.454545454545,
+110.495867768595,
+110.537190082645,
+110.578512396694,
+110.619834710744,
+110.661157024793,
+110.702479338843,
+110.743801652893,
+110.785123966942,
+110.826446280992,
+110.867768595041,
+110.909090909091,
+110.950413223141,
+110.99173553719,
+111.03305785124,
+111.074380165289,
+111.115702479339,
+111.157024793388,
+111.198347107438,
+111.239669421488,
+111.280991735537,
+111.322314049587,
+111.363636363636,
+111.404958677686,
+111.446280991736,
+111.487603305785,
+111.528925619835,
+111.570247933884,
+111.611570247934,
+111.652892561983,
+111.694214876033,
+111.735537190083,
+111.776859504132,
+111.818181818182,
+111.859504132231,
+111.900826446281,
+111.942148760331,
+111.98347107438,
+112.02479338843,
+112.066115702479,
+112.107438016529,
+112.148760330579,
+112.190082644628,
+112.231404958678,
+112.272727272727,
+112.314049586777,
+112.355371900826,
+112.396694214876,
+112.438016528926,
+112.479338842975,
+112.520661157025,
+112.561983471074,
+112.603305785124,
+112.644628099174,
+112.685950413223,
+112.727272727273,
+112.768595041322,
+112.809917355372,
+112.851239669421,
+112.892561983471,
+112.933884297521,
+112.97520661157,
+113.01652892562,
+113.057851239669,
+113.099173553719,
+113.140495867769,
+113.181818181818,
+113.223140495868,
+113.264462809917,
+113.305785123967,
+113.347107438017,
+113.388429752066,
+113.429752066116,
+113.471074380165,
+113.512396694215,
+113.553719008264,
+113.595041322314,
+113.636363636364,
+113.677685950413,
+113.719008264463,
+113.760330578512,
+113.801652892562,
+113.842975206612,
+113.884297520661,
+113.925619834711,
+113.96694214876,
+114.00826446281,
+114.049586776859,
+114.090909090909,
+114.132231404959,
+114.173553719008,
+114.214876033058,
+114.256198347107,
+114.297520661157,
+114.338842975207,
+114.380165289256,
+114.421487603306,
+114.462809917355,
+114.504132231405,
+114.545454545455,
+114.586776859504,
+114.628099173554,
+114.669421487603,
+114.710743801653,
+114.752066115702,
+114.793388429752,
+114.834710743802,
+114.876033057851,
+114.917355371901,
+114.95867768595,
+115,
+115.043103448276,
+115.086206896552,
+115.129310344828,
+115.172413793103,
+115.215517241379,
+115.258620689655,
+115.301724137931,
+115.344827586207,
+115.387931034483,
+115.431034482759,
+115.474137931034,
+115.51724137931,
+115.560344827586,
+115.603448275862,
+115.646551724138,
+115.689655172414,
+115.73275862069,
+115.775862068966,
+115.818965517241,
+115.862068965517,
+115.905172413793,
+115.948275862069,
+115.991379310345,
+116.034482758621,
+116.077586206897,
+116.120689655172,
+116.163793103448,
+116.206896551724,
+116.25,
+116.293103448276,
+116.336206896552,
+116.379310344828,
+116.422413793103,
+116.465517241379,
+116.508620689655,
+116.551724137931,
+116.594827586207,
+116.637931034483,
+116.681034482759,
+116.724137931034,
+116.76724137931,
+116.810344827586,
+116.853448275862,
+116.896551724138,
+116.939655172414,
+116.98275862069,
+117.025862068966,
+117.068965517241,
+117.112068965517,
+117.155172413793,
+117.198275862069,
+117.241379310345,
+117.284482758621,
+117.327586206897,
+117.370689655172,
+117.413793103448,
+117.456896551724,
+117.5,
+117.543103448276,
+117.586206896552,
+117.629310344828,
+117.672413793103,
+117.715517241379,
+117.758620689655,
+117.801724137931,
+117.844827586207,
+117.887931034483,
+117.931034482759,
+117.974137931034,
+118.01724137931,
+118.060344827586,
+118.103448275862,
+118.146551724138,
+118.189655172414,
+118.23275862069,
+118.275862068966,
+118.318965517241,
+118.362068965517,
+118.405172413793,
+118.448275862069,
+118.491379310345,
+118.534482758621,
+118.577586206897,
+118.620689655172,
+118.663793103448,
+118.706896551724,
+118.75,
+118.793103448276,
+118.836206896552,
+118.879310344828,
+118.922413793103,
+118.965517241379,
+119.008620689655,
+119.051724137931,
+119.094827586207,
+119.137931034483,
+119.181034482759,
+119.224137931034,
+119.26724137931,
+119.310344827586,
+119.353448275862,
+119.396551724138,
+119.439655172414,
+119.48275862069,
+119.525862068966,
+119.568965517241,
+119.612068965517,
+119.655172413793,
+119.698275862069,
+119.741379310345,
+119.784482758621,
+119.827586206897,
+119.870689655172,
+119.913793103448,
+119.956896551724,
+120,
+120.035211267606,
+120.070422535211,
+120.105633802817,
+120.140845070423,
+120.176056338028,
+120.211267605634,
+120.246478873239,
+120.281690140845,
+120.316901408451,
+120.352112676056,
+120.387323943662,
+120.422535211268,
+120.457746478873,
+120.492957746479,
+120.528169014085,
+120.56338028169,
+120.598591549296,
+120.633802816901,
+120.669014084507,
+120.704225352113,
+120.739436619718,
+120.774647887324,
+120.80985915493,
+120.845070422535,
+120.880281690141,
+120.915492957746,
+120.950704225352,
+120.985915492958,
+121.021126760563,
+121.056338028169,
+121.091549295775,
+121.12676056338,
+121.161971830986,
+121.197183098592,
+121.232394366197,
+121.267605633803,
+121.302816901408,
+121.338028169014,
+121.37323943662,
+121.408450704225,
+121.443661971831,
+121.478873239437,
+121.514084507042,
+121.549295774648,
+121.584507042254,
+121.619718309859,
+121.654929577465,
+121.69014084507,
+121.725352112676,
+121.760563380282,
+121.795774647887,
+121.830985915493,
+121.866197183099,
+121.901408450704,
+121.93661971831,
+121.971830985915,
+122.007042253521,
+122.042253521127,
+122.077464788732,
+122.112676056338,
+122.147887323944,
+122.183098591549,
+122.218309859155,
+122.253521126761,
+122.288732394366,
+122.323943661972,
+122.359154929577,
+122.394366197183,
+122.429577464789,
+122.464788732394,
+122.5,
+122.535211267606,
+122.570422535211,
+122.605633802817,
+122.640845070423,
+122.676056338028,
+122.711267605634,
+122.746478873239,
+122.781690140845,
+122.816901408451,
+122.852112676056,
+122.887323943662,
+122.922535211268,
+122.957746478873,
+122.992957746479,
+123.028169014085,
+123.06338028169,
+123.098591549296,
+123.133802816901,
+123.169014084507,
+123.204225352113,
+123.239436619718,
+123.274647887324,
+123.30985915493,
+123.345070422535,
+123.380281690141,
+123.415492957746,
+123.450704225352,
+123.485915492958,
+123.521126760563,
+123.556338028169,
+123.591549295775,
+123.62676056338,
+123.661971830986,
+123.697183098592,
+123.732394366197,
+123.767605633803,
+123.802816901408,
+123.838028169014,
+123.87323943662,
+123.908450704225,
+123.943661971831,
+123.978873239437,
+124.014084507042,
+124.049295774648,
+124.084507042254,
+124.119718309859,
+124.154929577465,
+124.19014084507,
+124.225352112676,
+124.260563380282,
+124.295774647887,
+124.330985915493,
+124.366197183099,
+124.401408450704,
+124.43661971831,
+124.471830985915,
+124.507042253521,
+124.542253521127,
+124.577464788732,
+124.612676056338,
+124.647887323944,
+124.683098591549,
+124.718309859155,
+124.753521126761,
+124.788732394366,
+124.823943661972,
+124.859154929577,
+124.894366197183,
+124.929577464789,
+124.964788732394,
+125,
+125.031847133758,
+125.063694267516,
+125.095541401274,
+125.127388535032,
+125.15923566879,
+125.191082802548,
+125.222929936306,
+125.254777070064,
+125.286624203822,
+125.31847133758,
+125.350318471338,
+125.382165605096,
+125.414012738854,
+125.445859872611,
+125.477707006369,
+125.509554140127,
+125.541401273885,
+125.573248407643,
+125.605095541401,
+125.636942675159,
+125.668789808917,
+125.700636942675,
+125.732484076433,
+125.764331210191,
+125.796178343949,
+125.828025477707,
+125.859872611465,
+125.891719745223,
+125.923566878981,
+125.955414012739,
+125.987261146497,
+126.019108280255,
+126.050955414013,
+126.082802547771,
+126.114649681529,
+126.146496815287,
+126.178343949045,
+126.210191082803,
+126.242038216561,
+126.273885350318,
+126.305732484076,
+126.337579617834,
+126.369426751592,
+126.40127388535,
+126.433121019108,
+126.464968152866,
+126.496815286624,
+126.528662420382,
+126.56050955414,
+126.592356687898,
+126.624203821656,
+126.656050955414,
+126.687898089172,
+126.71974522293,
+126.751592356688,
+126.783439490446,
+126.815286624204,
+126.847133757962,
+126.87898089172,
+126.910828025478,
+126.942675159236,
+126.974522292994,
+127.006369426752,
+127.03821656051,
+127.070063694268,
+127.101910828025,
+127.133757961783,
+127.165605095541,
+127.197452229299,
+127.229299363057,
+127.261146496815,
+127.292993630573,
+127.324840764331,
+127.356687898089,
+127.388535031847,
+127.420382165605,
+127.452229299363,
+127.484076433121,
+127.515923566879,
+127.547770700637,
+127.579617834395,
+127.611464968153,
+127.643312101911,
+127.675159235669,
+127.707006369427,
+127.738853503185,
+127.770700636943,
+127.802547770701,
+127.834394904459,
+127.866242038217,
+127.898089171975,
+127.929936305732,
+127.96178343949,
+127.993630573248,
+128.025477707006,
+128.057324840764,
+128.089171974522,
+128.12101910828,
+128.152866242038,
+128.184713375796,
+128.216560509554,
+128.248407643312,
+128.28025477707,
+128.312101910828,
+128.343949044586,
+128.375796178344,
+128.407643312102,
+128.43949044586,
+128.471337579618,
+128.503184713376,
+128.535031847134,
+128.566878980892,
+128.59872611465,
+128.630573248408,
+128.662420382166,
+128.694267515924,
+128.726114649682,
+128.757961783439,
+128.789808917197,
+128.821656050955,
+128.853503184713,
+128.885350318471,
+128.917197452229,
+128.949044585987,
+128.980891719745,
+129.012738853503,
+129.044585987261,
+129.076433121019,
+129.108280254777,
+129.140127388535,
+129.171974522293,
+129.203821656051,
+129.235668789809,
+129.267515923567,
+129.299363057325,
+129.331210191083,
+129.363057324841,
+129.394904458599,
+129.426751592357,
+129.458598726115,
+129.490445859873,
+129.522292993631,
+129.554140127389,
+129.585987261146,
+129.617834394904,
+129.649681528662,
+129.68152866242,
+129.713375796178,
+129.745222929936,
+129.777070063694,
+129.808917197452,
+129.84076433121,
+129.872611464968,
+129.904458598726,
+129.936305732484,
+129.968152866242,
+130,
+130.057471264368,
+130.114942528736,
+130.172413793103,
+130.229885057471,
+130.287356321839,
+130.344827586207,
+130.402298850575,
+130.459770114943,
+130.51724137931,
+130.574712643678,
+130.632183908046,
+130.689655172414,
+130.747126436782,
+130.804597701149,
+130.862068965517,
+130.919540229885,
+130.977011494253,
+131.034482758621,
+131.091954022989,
+131.149425287356,
+131.206896551724,
+131.264367816092,
+131.32183908046,
+131.379310344828,
+131.436781609195,
+131.494252873563,
+131.551724137931,
+131.609195402299,
+131.666666666667,
+131.724137931034,
+131.781609195402,
+131.83908045977,
+131.896551724138,
+131.954022988506,
+132.011494252874,
+132.068965517241,
+132.126436781609,
+132.183908045977,
+132.241379310345,
+132.298850574713,
+132.35632183908,
+132.413793103448,
+132.471264367816,
+132.528735632184,
+132.586206896552,
+132.64367816092,
+132.701149425287,
+132.758620689655,
+132.816091954023,
+132.873563218391,
+132.931034482759,
+132.988505747126,
+133.045977011494,
+133.103448275862,
+133.16091954023,
+133.218390804598,
+133.275862068966,
+133.333333333333,
+133.390804597701,
+133.448275862069,
+133.505747126437,
+133.563218390805,
+133.620689655172,
+133.67816091954,
+133.735632183908,
+133.793103448276,
+133.850574712644,
+133.908045977011,
+133.965517241379,
+134.022988505747,
+134.080459770115,
+134.137931034483,
+134.195402298851,
+134.252873563218,
+134.310344827586,
+134.367816091954,
+134.425287356322,
+134.48275862069,
+134.540229885057,
+134.597701149425,
+134.655172413793,
+134.712643678161,
+134.770114942529,
+134.827586206897,
+134.885057471264,
+134.942528735632,
+135,
+135.0390625,
+135.078125,
+135.1171875,
+135.15625,
+135.1953125,
+135.234375,
+135.2734375,
+135.3125,
+135.3515625,
+135.390625,
+135.4296875,
+135.46875,
+135.5078125,
+135.546875,
+135.5859375,
+135.625,
+135.6640625,
+135.703125,
+135.7421875,
+135.78125,
+135.8203125,
+135.859375,
+135.8984375,
+135.9375,
+135.9765625,
+136.015625,
+136.0546875,
+136.09375,
+136.1328125,
+136.171875,
+136.2109375,
+136.25,
+136.2890625,
+136.328125,
+136.3671875,
+136.40625,
+136.4453125,
+136.484375,
+136.5234375,
+136.5625,
+136.6015625,
+136.640625,
+136.6796875,
+136.71875,
+136.7578125,
+136.796875,
+136.8359375,
+136.875,
+136.9140625,
+136.953125,
+136.9921875,
+137.03125,
+137.0703125,
+137.109375,
+137.1484375,
+137.1875,
+137.2265625,
+137.265625,
+137.3046875,
+137.34375,
+137.3828125,
+137.421875,
+137.4609375,
+137.5,
+137.5390625,
+137.578125,
+137.6171875,
+137.65625,
+137.6953125,
+137.734375,
+137.7734375,
+137.8125,
+137.8515625,
+137.890625,
+137.9296875,
+137.96875,
+138.0078125,
+138.046875,
+138.0859375,
+138.125,
+138.1640625,
+138.203125,
+138.2421875,
+138.28125,
+138.3203125,
+138.359375,
+138.3984375,
+138.4375,
+138.4765625,
+138.515625,
+138.5546875,
+138.59375,
+138.6328125,
+138.671875,
+138.7109375,
+138.75,
+138.7890625,
+138.828125,
+138.8671875,
+138.90625,
+138.9453125,
+138.984375,
+139.0234375,
+139.0625,
+139.1015625,
+139.140625,
+139.1796875,
+139.21875,
+139.2578125,
+139.296875,
+139.3359375,
+139.375,
+139.4140625,
+139.453125,
+139.4921875,
+139.53125,
+139.5703125,
+139.609375,
+139.6484375,
+139.6875,
+139.7265625,
+139.765625,
+139.8046875,
+139.84375,
+139.8828125,
+139.921875,
+139.9609375,
+140,
+140.051020408163,
+140.102040816327,
+140.15306122449,
+140.204081632653,
+140.255102040816,
+140.30612244898,
+140.357142857143,
+140.408163265306,
+140.459183673469,
+140.510204081633,
+140.561224489796,
+140.612244897959,
+140.663265306122,
+140.714285714286,
+140.765306122449,
+140.816326530612,
+140.867346938776,
+140.918367346939,
+140.969387755102,
+141.020408163265,
+141.071428571429,
+141.122448979592,
+141.173469387755,
+141.224489795918,
+141.275510204082,
+141.326530612245,
+141.377551020408,
+141.428571428571,
+141.479591836735,
+141.530612244898,
+141.581632653061,
+141.632653061224,
+141.683673469388,
+141.734693877551,
+141.785714285714,
+141.836734693878,
+141.887755102041,
+141.938775510204,
+141.989795918367,
+142.040816326531,
+142.091836734694,
+142.142857142857,
+142.19387755102,
+142.244897959184,
+142.295918367347,
+142.34693877551,
+142.397959183673,
+142.448979591837,
+142.5,
+142.551020408163,
+142.602040816327,
+142.65306122449,
+142.704081632653,
+142.755102040816,
+142.80612244898,
+142.857142857143,
+142.908163265306,
+142.959183673469,
+143.010204081633,
+143.061224489796,
+143.112244897959,
+143.163265306122,
+143.214285714286,
+143.265306122449,
+143.316326530612,
+143.367346938776,
+143.418367346939,
+143.469387755102,
+143.520408163265,
+143.571428571429,
+143.622448979592,
+143.673469387755,
+143.724489795918,
+143.775510204082,
+143.826530612245,
+143.877551020408,
+143.928571428571,
+143.979591836735,
+144.030612244898,
+144.081632653061,
+144.132653061224,
+144.183673469388,
+144.234693877551,
+144.285714285714,
+144.336734693878,
+144.387755102041,
+144.438775510204,
+144.489795918367,
+144.540816326531,
+144.591836734694,
+144.642857142857,
+144.69387755102,
+144.744897959184,
+144.795918367347,
+144.84693877551,
+144.897959183673,
+144.948979591837,
+145,
+145.069444444444,
+145.138888888889,
+145.208333333333,
+145.277777777778,
+145.347222222222,
+145.416666666667,
+145.486111111111,
+145.555555555556,
+145.625,
+145.694444444444,
+145.763888888889,
+145.833333333333,
+145.902777777778,
+145.972222222222,
+146.041666666667,
+146.111111111111,
+146.180555555556,
+146.25,
+146.319444444444,
+146.388888888889,
+146.458333333333,
+146.527777777778,
+146.597222222222,
+146.666666666667,
+146.736111111111,
+146.805555555556,
+146.875,
+146.944444444444,
+147.013888888889,
+147.083333333333,
+147.152777777778,
+147.222222222222,
+147.291666666667,
+147.361111111111,
+147.430555555556,
+147.5,
+147.569444444444,
+147.638888888889,
+147.708333333333,
+147.777777777778,
+147.847222222222,
+147.916666666667,
+147.986111111111,
+148.055555555556,
+148.125,
+148.194444444444,
+148.263888888889,
+148.333333333333,
+148.402777777778,
+148.472222222222,
+148.541666666667,
+148.611111111111,
+148.680555555556,
+148.75,
+148.819444444444,
+148.888888888889,
+148.958333333333,
+149.027777777778,
+149.097222222222,
+149.166666666667,
+149.236111111111,
+149.305555555556,
+149.375,
+149.444444444444,
+149.513888888889,
+149.583333333333,
+149.652777777778,
+149.722222222222,
+149.791666666667,
+149.861111111111,
+149.930555555556,
+150,
+150.029069767442,
+150.058139534884,
+150.087209302326,
+150.116279069767,
+150.145348837209,
+150.174418604651,
+150.203488372093,
+150.232558139535,
+150.261627906977,
+150.290697674419,
+150.31976744186,
+150.348837209302,
+150.377906976744,
+150.406976744186,
+150.436046511628,
+150.46511627907,
+150.494186046512,
+150.523255813953,
+150.552325581395,
+150.581395348837,
+150.610465116279,
+150.639534883721,
+150.668604651163,
+150.697674418605,
+150.726744186047,
+150.755813953488,
+150.78488372093,
+150.813953488372,
+150.843023255814,
+150.872093023256,
+150.901162790698,
+150.93023255814,
+150.959302325581,
+150.988372093023,
+151.017441860465,
+151.046511627907,
+151.075581395349,
+151.104651162791,
+151.133720930233,
+151.162790697674,
+151.191860465116,
+151.220930232558,
+151.25,
+151.279069767442,
+151.308139534884,
+151.337209302326,
+151.366279069767,
+151.395348837209,
+151.424418604651,
+151.453488372093,
+151.482558139535,
+151.511627906977,
+151.540697674419,
+151.56976744186,
+151.598837209302,
+151.627906976744,
+151.656976744186,
+151.686046511628,
+151.71511627907,
+151.744186046512,
+151.773255813953,
+151.802325581395,
+151.831395348837,
+151.860465116279,
+151.889534883721,
+151.918604651163,
+151.947674418605,
+151.976744186047,
+152.005813953488,
+152.03488372093,
+152.063953488372,
+152.093023255814,
+152.122093023256,
+152.151162790698,
+152.18023255814,
+152.209302325581,
+152.238372093023,
+152.267441860465,
+152.296511627907,
+152.325581395349,
+152.354651162791,
+152.383720930233,
+152.412790697674,
+152.441860465116,
+152.470930232558,
+152.5,
+152.529069767442,
+152.558139534884,
+152.587209302326,
+152.616279069767,
+152.645348837209,
+152.674418604651,
+152.703488372093,
+152.732558139535,
+152.761627906977,
+152.790697674419,
+152.81976744186,
+152.848837209302,
+152.877906976744,
+152.906976744186,
+152.936046511628,
+152.96511627907,
+152.994186046512,
+153.023255813953,
+153.052325581395,
+153.081395348837,
+153.110465116279,
+153.139534883721,
+153.168604651163,
+153.197674418605,
+153.226744186047,
+153.255813953488,
+153.28488372093,
+153.313953488372,
+153.343023255814,
+153.372093023256,
+153.401162790698,
+153.43023255814,
+153.459302325581,
+153.488372093023,
+153.517441860465,
+153.546511627907,
+153.575581395349,
+153.604651162791,
+153.633720930233,
+153.662790697674,
+153.691860465116,
+153.720930232558,
+153.75,
+153.779069767442,
+153.808139534884,
+153.837209302326,
+153.866279069767,
+153.895348837209,
+153.924418604651,
+153.953488372093,
+153.982558139535,
+154.011627906977,
+154.040697674419,
+154.06976744186,
+154.098837209302,
+154.127906976744,
+154.156976744186,
+154.186046511628,
+154.21511627907,
+154.244186046512,
+154.273255813953,
+154.302325581395,
+154.331395348837,
+154.360465116279,
+154.389534883721,
+154.418604651163,
+154.447674418605,
+154.476744186047,
+154.505813953488,
+154.53488372093,
+154.563953488372,
+154.593023255814,
+154.622093023256,
+154.651162790698,
+154.68023255814,
+154.709302325581,
+154.738372093023,
+154.767441860465,
+154.796511627907,
+154.825581395349,
+154.854651162791,
+154.883720930233,
+154.912790697674,
+154.941860465116,
+154.970930232558,
+155,
+155.075757575758,
+155.151515151515,
+155.227272727273,
+155.30303030303,
+155.378787878788,
+155.454545454545,
+155.530303030303,
+155.606060606061,
+155.681818181818,
+155.757575757576,
+155.833333333333,
+155.909090909091,
+155.984848484848,
+156.060606060606,
+156.136363636364,
+156.212121212121,
+156.287878787879,
+156.363636363636,
+156.439393939394,
+156.515151515152,
+156.590909090909,
+156.666666666667,
+156.742424242424,
+156.818181818182,
+156.893939393939,
+156.969696969697,
+157.045454545455,
+157.121212121212,
+157.19696969697,
+157.272727272727,
+157.348484848485,
+157.424242424242,
+157.5,
+157.575757575758,
+157.651515151515,
+157.727272727273,
+157.80303030303,
+157.878787878788,
+157.954545454545,
+158.030303030303,
+158.106060606061,
+158.181818181818,
+158.257575757576,
+158.333333333333,
+158.409090909091,
+158.484848484848,
+158.560606060606,
+158.636363636364,
+158.712121212121,
+158.787878787879,
+158.863636363636,
+158.939393939394,
+159.015151515152,
+159.090909090909,
+159.166666666667,
+159.242424242424,
+159.318181818182,
+159.393939393939,
+159.469696969697,
+159.545454545455,
+159.621212121212,
+159.69696969697,
+159.772727272727,
+159.848484848485,
+159.924242424242,
+160,
+160.044247787611,
+160.088495575221,
+160.132743362832,
+160.176991150442,
+160.221238938053,
+160.265486725664,
+160.309734513274,
+160.353982300885,
+160.398230088496,
+160.442477876106,
+160.486725663717,
+160.530973451327,
+160.575221238938,
+160.619469026549,
+160.663716814159,
+160.70796460177,
+160.752212389381,
+160.796460176991,
+160.840707964602,
+160.884955752212,
+160.929203539823,
+160.973451327434,
+161.017699115044,
+161.061946902655,
+161.106194690265,
+161.150442477876,
+161.194690265487,
+161.238938053097,
+161.283185840708,
+161.327433628319,
+161.371681415929,
+161.41592920354,
+161.46017699115,
+161.504424778761,
+161.548672566372,
+161.592920353982,
+161.637168141593,
+161.681415929204,
+161.725663716814,
+161.769911504425,
+161.814159292035,
+161.858407079646,
+161.902654867257,
+161.946902654867,
+161.991150442478,
+162.035398230089,
+162.079646017699,
+162.12389380531,
+162.16814159292,
+162.212389380531,
+162.256637168142,
+162.300884955752,
+162.345132743363,
+162.389380530973,
+162.433628318584,
+162.477876106195,
+162.522123893805,
+162.566371681416,
+162.610619469027,
+162.654867256637,
+162.699115044248,
+162.743362831858,
+162.787610619469,
+162.83185840708,
+162.87610619469,
+162.920353982301,
+162.964601769911,
+163.008849557522,
+163.053097345133,
+163.097345132743,
+163.141592920354,
+163.185840707965,
+163.230088495575,
+163.274336283186,
+163.318584070796,
+163.362831858407,
+163.407079646018,
+163.451327433628,
+163.495575221239,
+163.53982300885,
+163.58407079646,
+163.628318584071,
+163.672566371681,
+163.716814159292,
+163.761061946903,
+163.805309734513,
+163.849557522124,
+163.893805309735,
+163.938053097345,
+163.982300884956,
+164.026548672566,
+164.070796460177,
+164.115044247788,
+164.159292035398,
+164.203539823009,
+164.247787610619,
+164.29203539823,
+164.336283185841,
+164.380530973451,
+164.424778761062,
+164.469026548673,
+164.513274336283,
+164.557522123894,
+164.601769911504,
+164.646017699115,
+164.690265486726,
+164.734513274336,
+164.778761061947,
+164.823008849558,
+164.867256637168,
+164.911504424779,
+164.955752212389,
+165,
+165.135135135135,
+165.27027027027,
+165.405405405405,
+165.540540540541,
+165.675675675676,
+165.810810810811,
+165.945945945946,
+166.081081081081,
+166.216216216216,
+166.351351351351,
+166.486486486486,
+166.621621621622,
+166.756756756757,
+166.891891891892,
+167.027027027027,
+167.162162162162,
+167.297297297297,
+167.432432432432,
+167.567567567568,
+167.702702702703,
+167.837837837838,
+167.972972972973,
+168.108108108108,
+168.243243243243,
+168.378378378378,
+168.513513513514,
+168.648648648649,
+168.783783783784,
+168.918918918919,
+169.054054054054,
+169.189189189189,
+169.324324324324,
+169.459459459459,
+169.594594594595,
+169.72972972973,
+169.864864864865,
+170,
+170.048076923077,
+170.096153846154,
+170.144230769231,
+170.192307692308,
+170.240384615385,
+170.288461538462,
+170.336538461538,
+170.384615384615,
+170.432692307692,
+170.480769230769,
+170.528846153846,
+170.576923076923,
+170.625,
+170.673076923077,
+170.721153846154,
+170.769230769231,
+170.817307692308,
+170.865384615385,
+170.913461538462,
+170.961538461538,
+171.009615384615,
+171.057692307692,
+171.105769230769,
+171.153846153846,
+171.201923076923,
+171.25,
+171.298076923077,
+171.346153846154,
+171.394230769231,
+171.442307692308,
+171.490384615385,
+171.538461538462,
+171.586538461538,
+171.634615384615,
+171.682692307692,
+171.730769230769,
+171.778846153846,
+171.826923076923,
+171.875,
+171.923076923077,
+171.971153846154,
+172.019230769231,
+172.067307692308,
+172.115384615385,
+172.163461538462,
+172.211538461538,
+172.259615384615,
+172.307692307692,
+172.355769230769,
+172.403846153846,
+172.451923076923,
+172.5,
+172.548076923077,
+172.596153846154,
+172.644230769231,
+172.692307692308,
+172.740384615385,
+172.788461538462,
+172.836538461538,
+172.884615384615,
+172.932692307692,
+172.980769230769,
+173.028846153846,
+173.076923076923,
+173.125,
+173.173076923077,
+173.221153846154,
+173.269230769231,
+173.317307692308,
+173.365384615385,
+173.413461538462,
+173.461538461538,
+173.509615384615,
+173.557692307692,
+173.605769230769,
+173.653846153846,
+173.701923076923,
+173.75,
+173.798076923077,
+173.846153846154,
+173.894230769231,
+173.942307692308,
+173.990384615385,
+174.038461538462,
+174.086538461538,
+174.134615384615,
+174.182692307692,
+174.230769230769,
+174.278846153846,
+174.326923076923,
+174.375,
+174.423076923077,
+174.471153846154,
+174.519230769231,
+174.567307692308,
+174.615384615385,
+174.663461538462,
+174.711538461538,
+174.759615384615,
+174.807692307692,
+174.855769230769,
+174.903846153846,
+174.951923076923,
+175,
+175.08064516129,
+175.161290322581,
+175.241935483871,
+175.322580645161,
+175.403225806452,
+175.483870967742,
+175.564516129032,
+175.645161290323,
+175.725806451613,
+175.806451612903,
+175.887096774194,
+175.967741935484,
+176.048387096774,
+176.129032258065,
+176.209677419355,
+176.290322580645,
+176.370967741935,
+176.451612903226,
+176.532258064516,
+176.612903225806,
+176.693548387097,
+176.774193548387,
+176.854838709677,
+176.935483870968,
+177.016129032258,
+177.096774193548,
+177.177419354839,
+177.258064516129,
+177.338709677419,
+177.41935483871,
+177.5,
+177.58064516129,
+177.661290322581,
+177.741935483871,
+177.822580645161,
+177.903225806452,
+177.983870967742,
+178.064516129032,
+178.145161290323,
+178.225806451613,
+178.306451612903,
+178.387096774194,
+178.467741935484,
+178.548387096774,
+178.629032258065,
+178.709677419355,
+178.790322580645,
+178.870967741935,
+178.951612903226,
+179.032258064516,
+179.112903225806,
+179.193548387097,
+179.274193548387,
+179.354838709677,
+179.435483870968,
+179.516129032258,
+179.596774193548,
+179.677419354839,
+179.758064516129,
+179.838709677419,
+179.91935483871,
+180,
+180.063291139241,
+180.126582278481,
+180.189873417722,
+180.253164556962,
+180.316455696203,
+180.379746835443,
+180.443037974684,
+180.506329113924,
+180.569620253165,
+180.632911392405,
+180.696202531646,
+180.759493670886,
+180.822784810127,
+180.886075949367,
+180.949367088608,
+181.012658227848,
+181.075949367089,
+181.139240506329,
+181.20253164557,
+181.26582278481,
+181.329113924051,
+181.392405063291,
+181.455696202532,
+181.518987341772,
+181.582278481013,
+181.645569620253,
+181.708860759494,
+181.772151898734,
+181.835443037975,
+181.898734177215,
+181.962025316456,
+182.025316455696,
+182.088607594937,
+182.151898734177,
+182.215189873418,
+182.278481012658,
+182.341772151899,
+182.405063291139,
+182.46835443038,
+182.53164556962,
+182.594936708861,
+182.658227848101,
+182.721518987342,
+182.784810126582,
+182.848101265823,
+182.911392405063,
+182.974683544304,
+183.037974683544,
+183.101265822785,
+183.164556962025,
+183.227848101266,
+183.291139240506,
+183.354430379747,
+183.417721518987,
+183.481012658228,
+183.544303797468,
+183.607594936709,
+183.670886075949,
+183.73417721519,
+183.79746835443,
+183.860759493671,
+183.924050632911,
+183.987341772152,
+184.050632911392,
+184.113924050633,
+184.177215189873,
+184.240506329114,
+184.303797468354,
+184.367088607595,
+184.430379746835,
+184.493670886076,
+184.556962025316,
+184.620253164557,
+184.683544303797,
+184.746835443038,
+184.810126582278,
+184.873417721519,
+184.936708860759,
+185,
+185.049019607843,
+185.098039215686,
+185.147058823529,
+185.196078431373,
+185.245098039216,
+185.294117647059,
+185.343137254902,
+185.392156862745,
+185.441176470588,
+185.490196078431,
+185.539215686275,
+185.588235294118,
+185.637254901961,
+185.686274509804,
+185.735294117647,
+185.78431372549,
+185.833333333333,
+185.882352941176,
+185.93137254902,
+185.980392156863,
+186.029411764706,
+186.078431372549,
+186.127450980392,
+186.176470588235,
+186.225490196078,
+186.274509803922,
+186.323529411765,
+186.372549019608,
+186.421568627451,
+186.470588235294,
+186.519607843137,
+186.56862745098,
+186.617647058824,
+186.666666666667,
+186.71568627451,
+186.764705882353,
+186.813725490196,
+186.862745098039,
+186.911764705882,
+186.960784313725,
+187.009803921569,
+187.058823529412,
+187.107843137255,
+187.156862745098,
+187.205882352941,
+187.254901960784,
+187.303921568627,
+187.352941176471,
+187.401960784314,
+187.450980392157,
+187.5,
+187.549019607843,
+187.598039215686,
+187.647058823529,
+187.696078431373,
+187.745098039216,
+187.794117647059,
+187.843137254902,
+187.892156862745,
+187.941176470588,
+187.990196078431,
+188.039215686275,
+188.088235294118,
+188.137254901961,
+188.186274509804,
+188.235294117647,
+188.28431372549,
+188.333333333333,
+188.382352941176,
+188.43137254902,
+188.480392156863,
+188.529411764706,
+188.578431372549,
+188.627450980392,
+188.676470588235,
+188.725490196078,
+188.774509803922,
+188.823529411765,
+188.872549019608,
+188.921568627451,
+188.970588235294,
+189.019607843137,
+189.06862745098,
+189.117647058824,
+189.166666666667,
+189.21568627451,
+189.264705882353,
+189.313725490196,
+189.362745098039,
+189.411764705882,
+189.460784313725,
+189.509803921569,
+189.558823529412,
+189.607843137255,
+189.656862745098,
+189.705882352941,
+189.754901960784,
+189.803921568627,
+189.852941176471,
+189.901960784314,
+189.950980392157,
+190,
+190.044247787611,
+190.088495575221,
+190.132743362832,
+190.176991150442,
+190.221238938053,
+190.265486725664,
+190.309734513274,
+190.353982300885,
+190.398230088496,
+190.442477876106,
+190.486725663717,
+190.530973451327,
+190.575221238938,
+190.619469026549,
+190.663716814159,
+190.70796460177,
+190.752212389381,
+190.796460176991,
+190.840707964602,
+190.884955752212,
+190.929203539823,
+190.973451327434,
+191.017699115044,
+191.061946902655,
+191.106194690265,
+191.150442477876,
+191.194690265487,
+191.238938053097,
+191.283185840708,
+191.327433628319,
+191.371681415929,
+191.41592920354,
+191.46017699115,
+191.504424778761,
+191.548672566372,
+191.592920353982,
+191.637168141593,
+191.681415929204,
+191.725663716814,
+191.769911504425,
+191.814159292035,
+191.858407079646,
+191.902654867257,
+191.946902654867,
+191.991150442478,
+192.035398230089,
+192.079646017699,
+192.12389380531,
+192.16814159292,
+192.212389380531,
+192.256637168142,
+192.300884955752,
+192.345132743363,
+192.389380530973,
+192.433628318584,
+192.477876106195,
+192.522123893805,
+192.566371681416,
+192.610619469027,
+192.654867256637,
+192.699115044248,
+192.743362831858,
+192.787610619469,
+192.83185840708,
+192.87610619469,
+192.920353982301,
+192.964601769911,
+193.008849557522,
+193.053097345133,
+193.097345132743,
+193.141592920354,
+193.185840707965,
+193.230088495575,
+193.274336283186,
+193.318584070796,
+193.362831858407,
+193.407079646018,
+193.451327433628,
+193.495575221239,
+193.53982300885,
+193.58407079646,
+193.628318584071,
+193.672566371681,
+193.716814159292,
+193.761061946903,
+193.805309734513,
+193.849557522124,
+193.893805309735,
+193.938053097345,
+193.982300884956,
+194.026548672566,
+194.070796460177,
+194.115044247788,
+194.159292035398,
+194.203539823009,
+194.247787610619,
+194.29203539823,
+194.336283185841,
+194.380530973451,
+194.424778761062,
+194.469026548673,
+194.513274336283,
+194.557522123894,
+194.601769911504,
+194.646017699115,
+194.690265486726,
+194.734513274336,
+194.778761061947,
+194.823008849558,
+194.867256637168,
+194.911504424779,
+194.955752212389,
+195,
+195.009433962264,
+195.018867924528,
+195.028301886792,
+195.037735849057,
+195.047169811321,
+195.056603773585,
+195.066037735849,
+195.075471698113,
+195.084905660377,
+195.094339622642,
+195.103773584906,
+195.11320754717,
+195.122641509434,
+195.132075471698,
+195.141509433962,
+195.150943396226,
+195.160377358491,
+195.169811320755,
+195.179245283019,
+195.188679245283,
+195.198113207547,
+195.207547169811,
+195.216981132075,
+195.22641509434,
+195.235849056604,
+195.245283018868,
+195.254716981132,
+195.264150943396,
+195.27358490566,
+195.283018867925,
+195.292452830189,
+195.301886792453,
+195.311320754717,
+195.320754716981,
+195.330188679245,
+195.339622641509,
+195.349056603774,
+195.358490566038,
+195.367924528302,
+195.377358490566,
+195.38679245283,
+195.396226415094,
+195.405660377358,
+195.415094339623,
+195.424528301887,
+195.433962264151,
+195.443396226415,
+195.452830188679,
+195.462264150943,
+195.471698113208,
+195.481132075472,
+195.490566037736,
+195.5,
+195.509433962264,
+195.518867924528,
+195.528301886792,
+195.537735849057,
+195.547169811321,
+195.556603773585,
+195.566037735849,
+195.575471698113,
+195.584905660377,
+195.594339622642,
+195.603773584906,
+195.61320754717,
+195.622641509434,
+195.632075471698,
+195.641509433962,
+195.650943396226,
+195.660377358491,
+195.669811320755,
+195.679245283019,
+195.688679245283,
+195.698113207547,
+195.707547169811,
+195.716981132075,
+195.72641509434,
+195.735849056604,
+195.745283018868,
+195.754716981132,
+195.764150943396,
+195.77358490566,
+195.783018867925,
+195.792452830189,
+195.801886792453,
+195.811320754717,
+195.820754716981,
+195.830188679245,
+195.839622641509,
+195.849056603774,
+195.858490566038,
+195.867924528302,
+195.877358490566,
+195.88679245283,
+195.896226415094,
+195.905660377358,
+195.915094339623,
+195.924528301887,
+195.933962264151,
+195.943396226415,
+195.952830188679,
+195.962264150943,
+195.971698113208,
+195.981132075472,
+195.990566037736,
+196,
+196.009433962264,
+196.018867924528,
+196.028301886792,
+196.037735849057,
+196.047169811321,
+196.056603773585,
+196.066037735849,
+196.075471698113,
+196.084905660377,
+196.094339622642,
+196.103773584906,
+196.11320754717,
+196.122641509434,
+196.132075471698,
+196.141509433962,
+196.150943396226,
+196.160377358491,
+196.169811320755,
+196.179245283019,
+196.188679245283,
+196.198113207547,
+196.207547169811,
+196.216981132075,
+196.22641509434,
+196.235849056604,
+196.245283018868,
+196.254716981132,
+196.264150943396,
+196.27358490566,
+196.283018867925,
+196.292452830189,
+196.301886792453,
+196.311320754717,
+196.320754716981,
+196.330188679245,
+196.339622641509,
+196.349056603774,
+196.358490566038,
+196.367924528302,
+196.377358490566,
+196.38679245283,
+196.396226415094,
+196.405660377358,
+196.415094339623,
+196.424528301887,
+196.433962264151,
+196.443396226415,
+196.452830188679,
+196.462264150943,
+196.471698113208,
+196.481132075472,
+196.490566037736,
+196.5,
+196.509433962264,
+196.518867924528,
+196.528301886792,
+196.537735849057,
+196.547169811321,
+196.556603773585,
+196.566037735849,
+196.575471698113,
+196.584905660377,
+196.594339622642,
+196.603773584906,
+196.61320754717,
+196.622641509434,
+196.632075471698,
+196.641509433962,
+196.650943396226,
+196.660377358491,
+196.669811320755,
+196.679245283019,
+196.688679245283,
+196.698113207547,
+196.707547169811,
+196.716981132075,
+196.72641509434,
+196.735849056604,
+196.745283018868,
+196.754716981132,
+196.764150943396,
+196.77358490566,
+196.783018867925,
+196.792452830189,
+196.801886792453,
+196.811320754717,
+196.820754716981,
+196.830188679245,
+196.839622641509,
+196.849056603774,
+196.858490566038,
+196.867924528302,
+196.877358490566,
+196.88679245283,
+196.896226415094,
+196.905660377358,
+196.915094339623,
+196.924528301887,
+196.933962264151,
+196.943396226415,
+196.952830188679,
+196.962264150943,
+196.971698113208,
+196.981132075472,
+196.990566037736,
+197,
+197.009433962264,
+197.018867924528,
+197.028301886792,
+197.037735849057,
+197.047169811321,
+197.056603773585,
+197.066037735849,
+197.075471698113,
+197.084905660377,
+197.094339622642,
+197.103773584906,
+197.11320754717,
+197.122641509434,
+197.132075471698,
+197.141509433962,
+197.150943396226,
+197.160377358491,
+197.169811320755,
+197.179245283019,
+197.188679245283,
+197.198113207547,
+197.207547169811,
+197.216981132075,
+197.22641509434,
+197.235849056604,
+197.245283018868,
+197.254716981132,
+197.264150943396,
+197.27358490566,
+197.283018867925,
+197.292452830189,
+197.301886792453,
+197.311320754717,
+197.320754716981,
+197.330188679245,
+197.339622641509,
+197.349056603774,
+197.358490566038,
+197.367924528302,
+197.377358490566,
+197.38679245283,
+197.396226415094,
+197.405660377358,
+197.415094339623,
+197.424528301887,
+197.433962264151,
+197.443396226415,
+197.452830188679,
+197.462264150943,
+197.471698113208,
+197.481132075472,
+197.490566037736,
+197.5,
+197.509433962264,
+197.518867924528,
+197.528301886792,
+197.537735849057,
+197.547169811321,
+197.556603773585,
+197.566037735849,
+197.575471698113,
+197.584905660377,
+197.594339622642,
+197.603773584906,
+197.61320754717,
+197.622641509434,
+197.632075471698,
+197.641509433962,
+197.650943396226,
+197.660377358491,
+197.669811320755,
+197.679245283019,
+197.688679245283,
+197.698113207547,
+197.707547169811,
+197.716981132075,
+197.72641509434,
+197.735849056604,
+197.745283018868,
+197.754716981132,
+197.764150943396,
+197.77358490566,
+197.783018867925,
+197.792452830189,
+197.801886792453,
+197.811320754717,
+197.820754716981,
+197.830188679245,
+197.839622641509,
+197.849056603774,
+197.858490566038,
+197.867924528302,
+197.877358490566,
+197.88679245283,
+197.896226415094,
+197.905660377358,
+197.915094339623,
+197.924528301887,
+197.933962264151,
+197.943396226415,
+197.952830188679,
+197.962264150943,
+197.971698113208,
+197.981132075472,
+197.990566037736,
+198,
+198.009433962264,
+198.018867924528,
+198.028301886792,
+198.037735849057,
+198.047169811321,
+198.056603773585,
+198.066037735849,
+198.075471698113,
+198.084905660377,
+198.094339622642,
+198.103773584906,
+198.11320754717,
+198.122641509434,
+198.132075471698,
+198.141509433962,
+198.150943396226,
+198.160377358491,
+198.169811320755,
+198.179245283019,
+198.188679245283,
+198.198113207547,
+198.207547169811,
+198.216981132075,
+198.22641509434,
+198.235849056604,
+198.245283018868,
+198.254716981132,
+198.264150943396,
+198.27358490566,
+198.283018867925,
+198.292452830189,
+198.301886792453,
+198.311320754717,
+198.320754716981,
+198.330188679245,
+198.339622641509,
+198.349056603774,
+198.358490566038,
+198.367924528302,
+198.377358490566,
+198.38679245283,
+198.396226415094,
+198.405660377358,
+198.415094339623,
+198.424528301887,
+198.433962264151,
+198.443396226415,
+198.452830188679,
+198.462264150943,
+198.471698113208,
+198.481132075472,
+198.490566037736,
+198.5,
+198.509433962264,
+198.518867924528,
+198.528301886792,
+198.537735849057,
+198.547169811321,
+198.556603773585,
+198.566037735849,
+198.575471698113,
+198.584905660377,
+198.594339622642,
+198.603773584906,
+198.61320754717,
+198.622641509434,
+198.632075471698,
+198.641509433962,
+198.650943396226,
+198.660377358491,
+198.669811320755,
+198.679245283019,
+198.688679245283,
+198.698113207547,
+198.707547169811,
+198.716981132075,
+198.72641509434,
+198.735849056604,
+198.745283018868,
+198.754716981132,
+198.764150943396,
+198.77358490566,
+198.783018867925,
+198.792452830189,
+198.801886792453,
+198.811320754717,
+198.820754716981,
+198.830188679245,
+198.839622641509,
+198.849056603774,
+198.858490566038,
+198.867924528302,
+198.877358490566,
+198.88679245283,
+198.896226415094,
+198.905660377358,
+198.915094339623,
+198.924528301887,
+198.933962264151,
+198.943396226415,
+198.952830188679,
+198.962264150943,
+198.971698113208,
+198.981132075472,
+198.990566037736,
+199,
+199.009433962264,
+199.018867924528,
+199.028301886792,
+199.037735849057,
+199.047169811321,
+199.056603773585,
+199.066037735849,
+199.075471698113,
+199.084905660377,
+199.094339622642,
+199.103773584906,
+199.11320754717,
+199.122641509434,
+199.132075471698,
+199.141509433962,
+199.150943396226,
+199.160377358491,
+199.169811320755,
+199.179245283019,
+199.188679245283,
+199.198113207547,
+199.207547169811,
+199.216981132075,
+199.22641509434,
+199.235849056604,
+199.245283018868,
+199.254716981132,
+199.264150943396,
+199.27358490566,
+199.283018867925,
+199.292452830189,
+199.301886792453,
+199.311320754717,
+199.320754716981,
+199.330188679245,
+199.339622641509,
+199.349056603774,
+199.358490566038,
+199.367924528302,
+199.377358490566,
+199.38679245283,
+199.396226415094,
+199.405660377358,
+199.415094339623,
+199.424528301887,
+199.433962264151,
+199.443396226415,
+199.452830188679,
+199.462264150943,
+199.471698113208,
+199.481132075472,
+199.490566037736,
+199.5,
+199.509433962264,
+199.518867924528,
+199.528301886792,
+199.537735849057,
+199.547169811321,
+199.556603773585,
+199.566037735849,
+199.575471698113,
+199.584905660377,
+199.594339622642,
+199.603773584906,
+199.61320754717,
+199.622641509434,
+199.632075471698,
+199.641509433962,
+199.650943396226,
+199.660377358491,
+199.669811320755,
+199.679245283019,
+199.688679245283,
+199.698113207547,
+199.707547169811,
+199.716981132075,
+199.72641509434,
+199.735849056604,
+199.745283018868,
+199.754716981132,
+199.764150943396,
+199.77358490566,
+199.783018867925,
+199.792452830189,
+199.801886792453,
+199.811320754717,
+199.820754716981,
+199.830188679245,
+199.839622641509,
+199.849056603774,
+199.858490566038,
+199.867924528302,
+199.877358490566,
+199.88679245283,
+199.896226415094,
+199.905660377358,
+199.915094339623,
+199.924528301887,
+199.933962264151,
+199.943396226415,
+199.952830188679,
+199.962264150943,
+199.971698113208,
+199.981132075472,
+199.990566037736,
+200,
+200.166666666667,
+200.333333333333,
+200.5,
+200.666666666667,
+200.833333333333,
+201,
+201.166666666667,
+201.333333333333,
+201.5,
+201.666666666667,
+201.833333333333,
+202,
+202.166666666667,
+202.333333333333,
+202.5,
+202.666666666667,
+202.833333333333,
+203,
+203.166666666667,
+203.333333333333,
+203.5,
+203.666666666667,
+203.833333333333,
+204,
+204.166666666667,
+204.333333333333,
+204.5,
+204.666666666667,
+204.833333333333,
+205,
+205.138888888889,
+205.277777777778,
+205.416666666667,
+205.555555555556,
+205.694444444444,
+205.833333333333,
+205.972222222222,
+206.111111111111,
+206.25,
+206.388888888889,
+206.527777777778,
+206.666666666667,
+206.805555555556,
+206.944444444444,
+207.083333333333,
+207.222222222222,
+207.361111111111,
+207.5,
+207.638888888889,
+207.777777777778,
+207.916666666667,
+208.055555555556,
+208.194444444444,
+208.333333333333,
+208.472222222222,
+208.611111111111,
+208.75,
+208.888888888889,
+209.027777777778,
+209.166666666667,
+209.305555555556,
+209.444444444444,
+209.583333333333,
+209.722222222222
+};
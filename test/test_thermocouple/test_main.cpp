@@ -0,0 +1,184 @@
+// MAX31855 / MAX6675 decoding and read scheduling against a fake SPI bus
+#include <unity.h>
+#include "ThermocoupleSensor.h"
+
+class FakeBus : public ThermoBus {
+public:
+  uint32_t word = 0;
+  int      reads = 0, begins = 0;
+  uint8_t  lastCs = 0, lastBits = 0;
+
+  void begin(uint8_t cs) override { begins++; lastCs = cs; }
+  uint32_t read(uint8_t cs, uint8_t bits) override {
+    reads++; lastCs = cs; lastBits = bits;
+    return word;
+  }
+};
+
+// MAX31855 word from quarter degrees (TC) and 1/16 degrees (cold junction)
+static uint32_t max31855Word(int tcQuarters, int cjSixteenths, uint8_t faults = 0) {
+  uint32_t w = ((uint32_t)(tcQuarters & 0x3FFF) << 18) | ((uint32_t)(cjSixteenths & 0xFFF) << 4);
+  if (faults) w |= 0x00010000UL | faults;
+  return w;
+}
+
+static uint16_t max6675Word(int tcQuarters, bool open = false) {
+  return (uint16_t)((tcQuarters & 0xFFF) << 3) | (open ? 0x0004 : 0);
+}
+
+static FakeBus bus;
+
+void setUp(void) { bus = FakeBus(); }
+void tearDown(void) {}
+
+void test_max31855_positive(void) {
+  float t, cj;
+  uint8_t f;
+  TEST_ASSERT_TRUE(Max31855Sensor::decode(max31855Word(403, 401), t, cj, f));
+  TEST_ASSERT_EQUAL_FLOAT(100.75f, t);
+  TEST_ASSERT_EQUAL_FLOAT(25.0625f, cj);
+  TEST_ASSERT_EQUAL_UINT8(0, f);
+}
+
+void test_max31855_negative(void) {
+  float t, cj;
+  uint8_t f;
+  TEST_ASSERT_TRUE(Max31855Sensor::decode(max31855Word(-41, -88), t, cj, f));
+  TEST_ASSERT_EQUAL_FLOAT(-10.25f, t);
+  TEST_ASSERT_EQUAL_FLOAT(-5.5f, cj);
+  TEST_ASSERT_TRUE(Max31855Sensor::decode(max31855Word(-1000, 0), t, cj, f));
+  TEST_ASSERT_EQUAL_FLOAT(-250.0f, t);
+  TEST_ASSERT_TRUE(Max31855Sensor::decode(max31855Word(-1, -1), t, cj, f));
+  TEST_ASSERT_EQUAL_FLOAT(-0.25f, t);
+  TEST_ASSERT_EQUAL_FLOAT(-0.0625f, cj);
+}
+
+void test_max31855_fault_bits(void) {
+  float t = 1, cj = 1;
+  uint8_t f;
+  const uint8_t causes[] = {0x01, 0x02, 0x04, 0x07};   // OC, SCG, SCV, all
+  for (uint8_t c : causes) {
+    TEST_ASSERT_FALSE(Max31855Sensor::decode(max31855Word(400, 400, c), t, cj, f));
+    TEST_ASSERT_EQUAL_UINT8(c, f);
+  }
+  // D16 with no cause is a floating or stuck-high MISO
+  TEST_ASSERT_FALSE(Max31855Sensor::decode(0x00010000UL, t, cj, f));
+  TEST_ASSERT_EQUAL_UINT8(0x80, f);
+  TEST_ASSERT_FALSE(Max31855Sensor::decode(0xFFFFFFFFUL, t, cj, f));
+  TEST_ASSERT_EQUAL_UINT8(0x07, f);
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, t);   // outputs untouched on a fault
+}
+
+void test_max6675_decode(void) {
+  float t;
+  uint8_t f;
+  TEST_ASSERT_TRUE(Max6675Sensor::decode(max6675Word(800), t, f));
+  TEST_ASSERT_EQUAL_FLOAT(200.0f, t);
+  TEST_ASSERT_TRUE(Max6675Sensor::decode(max6675Word(0), t, f));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, t);
+  TEST_ASSERT_TRUE(Max6675Sensor::decode(max6675Word(4095), t, f));
+  TEST_ASSERT_EQUAL_FLOAT(1023.75f, t);
+}
+
+void test_max6675_open_and_missing(void) {
+  float t;
+  uint8_t f;
+  TEST_ASSERT_FALSE(Max6675Sensor::decode(max6675Word(800, true), t, f));
+  TEST_ASSERT_EQUAL_UINT8(0x01, f);
+  TEST_ASSERT_FALSE(Max6675Sensor::decode(0xFFFF, t, f));   // MISO pulled high, no chip
+  TEST_ASSERT_EQUAL_UINT8(0x80, f);
+  TEST_ASSERT_FALSE(Max6675Sensor::decode(0x0002, t, f));   // device id bit set
+  TEST_ASSERT_EQUAL_UINT8(0x80, f);
+}
+
+// A fault flags the sensor and keeps the last good reading
+void test_sensor_open_thermocouple_holds_last_reading(void) {
+  Max31855Sensor s(bus, 16);
+  s.begin();
+  TEST_ASSERT_EQUAL_UINT8(16, bus.lastCs);
+  bus.word = max31855Word(4 * 150, 400);
+  TEST_ASSERT_TRUE(s.poll(1000));
+  TEST_ASSERT_EQUAL_UINT8(32, bus.lastBits);
+  TEST_ASSERT_EQUAL_FLOAT(150.0f, s.tempC());
+
+  bus.word = max31855Word(0, 400, 0x01);
+  TEST_ASSERT_FALSE(s.poll(1100));
+  TEST_ASSERT_TRUE(s.fault());
+  TEST_ASSERT_EQUAL_UINT8(0x01, s.faultBits());
+  TEST_ASSERT_EQUAL_FLOAT(150.0f, s.tempC());
+
+  bus.word = max31855Word(4 * 151, 400);
+  TEST_ASSERT_TRUE(s.poll(1200));
+  TEST_ASSERT_FALSE(s.fault());
+  TEST_ASSERT_EQUAL_UINT8(0, s.faultBits());
+}
+
+// Below -40 °C is not a plate reading
+void test_sensor_rejects_implausible_negative(void) {
+  Max31855Sensor s(bus, 16);
+  s.begin();
+  bus.word = max31855Word(-4 * 10, 0);
+  TEST_ASSERT_TRUE(s.poll(0));
+  TEST_ASSERT_EQUAL_FLOAT(-10.0f, s.tempC());
+  bus.word = max31855Word(-4 * 100, 0);
+  TEST_ASSERT_FALSE(s.poll(100));
+  TEST_ASSERT_TRUE(s.fault());
+  TEST_ASSERT_EQUAL_FLOAT(-10.0f, s.tempC());
+}
+
+// Reads never come faster than the conversion time, however often poll() runs
+static void checkSchedule(ThermocoupleSensor& s, uint16_t periodMs, uint32_t t0) {
+  s.begin();
+  int readings = 0;
+  for (uint32_t ms = 0; ms < 2000; ms += 10) readings += s.poll(t0 + ms);
+  TEST_ASSERT_EQUAL_INT(2000 / periodMs, bus.reads);
+  TEST_ASSERT_EQUAL_INT(bus.reads, readings);
+}
+
+void test_max31855_schedule(void) {
+  Max31855Sensor s(bus, 16);
+  bus.word = max31855Word(400, 400);
+  checkSchedule(s, 100, 5000);
+}
+
+void test_max6675_schedule(void) {
+  Max6675Sensor s(bus, 17);
+  bus.word = max6675Word(400);
+  checkSchedule(s, 250, 5000);
+  TEST_ASSERT_EQUAL_UINT8(16, bus.lastBits);
+}
+
+void test_schedule_across_millis_wrap(void) {
+  Max31855Sensor s(bus, 16);
+  bus.word = max31855Word(400, 400);
+  checkSchedule(s, 100, 0xFFFFFFFFUL - 1000);
+}
+
+// The first poll after begin() reads at once, then the period applies
+void test_first_poll_reads_immediately(void) {
+  Max6675Sensor s(bus, 17);
+  bus.word = max6675Word(400);
+  s.begin();
+  TEST_ASSERT_TRUE(s.poll(0));
+  TEST_ASSERT_FALSE(s.poll(249));
+  TEST_ASSERT_TRUE(s.poll(250));
+  s.begin();
+  TEST_ASSERT_TRUE(s.poll(260));
+  TEST_ASSERT_EQUAL_INT(3, bus.reads);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_max31855_positive);
+  RUN_TEST(test_max31855_negative);
+  RUN_TEST(test_max31855_fault_bits);
+  RUN_TEST(test_max6675_decode);
+  RUN_TEST(test_max6675_open_and_missing);
+  RUN_TEST(test_sensor_open_thermocouple_holds_last_reading);
+  RUN_TEST(test_sensor_rejects_implausible_negative);
+  RUN_TEST(test_max31855_schedule);
+  RUN_TEST(test_max6675_schedule);
+  RUN_TEST(test_schedule_across_millis_wrap);
+  RUN_TEST(test_first_poll_reads_immediately);
+  return UNITY_END();
+}
@@ -0,0 +1,166 @@
+// UI screens against the golden captures in golden/ next to this file.
+// uiCaptureScenes() renders every scene as the ui-capture build does; each
+// frame must match its reference PBM pixel for pixel, and its draw counts
+// may not grow more than 10% over stats.csv. The references are host
+// renders (lib/HostArduino GFX); to accept an intended change run
+//   pio run -e native-ui-capture
+//   .pio/build/native-ui-capture/program > screens.txt
+//   tools/screen_capture.py screens.txt --golden test/test_ui_golden/golden --update
+#include <unity.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "HostArduino.h"
+#include "DisplayUI.h"
+#include "UiScenes.h"
+
+static const float GROWTH_PCT = 10.0f;
+
+struct Screen {
+  uint32_t prims = 0, glyphs = 0, pixels = 0;
+  std::string crc;
+  std::string pbm;   // the 64 rows, concatenated
+};
+
+class StringPrint : public Print {
+public:
+  std::string s;
+  size_t write(uint8_t c) override { s += (char)c; return 1; }
+};
+
+static std::map<std::string, Screen> captured;
+
+static std::string goldenDir() {
+  std::string f = __FILE__;
+  size_t slash = f.find_last_of('/');
+  return (slash == std::string::npos ? std::string(".") : f.substr(0, slash)) + "/golden/";
+}
+
+static std::vector<std::string> lines(const std::string& text) {
+  std::vector<std::string> out;
+  size_t at = 0;
+  while (at < text.size()) {
+    size_t nl = text.find('\n', at);
+    if (nl == std::string::npos) nl = text.size();
+    std::string l = text.substr(at, nl - at);
+    if (!l.empty() && l.back() == '\r') l.pop_back();
+    out.push_back(l);
+    at = nl + 1;
+  }
+  return out;
+}
+
+// PBM body of a plain P1 file with the header stripped, whitespace removed
+static bool readPbm(const std::string& path, std::string& bits) {
+  FILE* f = fopen(path.c_str(), "r");
+  if (!f) return false;
+  char magic[4] = {};
+  int w = 0, h = 0;
+  bool ok = fscanf(f, "%3s %d %d", magic, &w, &h) == 3 && !strcmp(magic, "P1") && w == 128 && h == 64;
+  int c;
+  while (ok && (c = fgetc(f)) != EOF)
+    if (c == '0' || c == '1') bits += (char)c;
+  fclose(f);
+  return ok;
+}
+
+static std::map<std::string, Screen> readStats() {
+  std::map<std::string, Screen> out;
+  FILE* f = fopen((goldenDir() + "stats.csv").c_str(), "r");
+  if (!f) return out;
+  char line[128];
+  fgets(line, sizeof(line), f);   // header
+  while (fgets(line, sizeof(line), f)) {
+    char name[32], crc[16];
+    unsigned long p, g, px;
+    if (sscanf(line, "%31[^,],%lu,%lu,%lu,%15s", name, &p, &g, &px, crc) != 5) continue;
+    Screen& s = out[name];
+    s.prims = p; s.glyphs = g; s.pixels = px; s.crc = crc;
+  }
+  fclose(f);
+  return out;
+}
+
+void setUp(void) {
+  if (!captured.empty()) return;
+  // The ui-capture setup() waits 1.5 s first; ProfileRunner reads a start
+  // time of 0 as "not started", so the clock must not be at 0 either
+  hostAdvanceMs(1500);
+  static DisplayUI ui;
+  ui.begin(21, 22);
+  ui.setOutputEnabled(false);
+  StringPrint out;
+  uiCaptureScenes(ui, out);
+
+  std::vector<std::string> l = lines(out.s);
+  for (size_t i = 0; i + 66 < l.size(); i++) {
+    char name[32], crc[16];
+    unsigned long p, g, px;
+    if (sscanf(l[i].c_str(), "SCREEN,%31[^,],%lu,%lu,%lu,%15s", name, &p, &g, &px, crc) != 5) continue;
+    Screen& s = captured[name];
+    s.prims = p; s.glyphs = g; s.pixels = px; s.crc = crc;
+    for (size_t r = 0; r < 64; r++) s.pbm += l[i + 3 + r];
+    i += 66;
+  }
+}
+
+void tearDown(void) {}
+
+void test_every_scene_is_captured(void) {
+  TEST_ASSERT_EQUAL(UI_SCENE_COUNT, captured.size());
+  for (uint8_t sc = 0; sc < UI_SCENE_COUNT; sc++)
+    TEST_ASSERT_TRUE_MESSAGE(captured.count(uiSceneName(sc)), uiSceneName(sc));
+}
+
+static void checkScreen(const char* name) {
+  TEST_ASSERT_TRUE_MESSAGE(captured.count(name), name);
+  const Screen& s = captured[name];
+  std::map<std::string, Screen> stats = readStats();
+  TEST_ASSERT_TRUE_MESSAGE(stats.count(name), "no row in golden/stats.csv");
+  const Screen& ref = stats[name];
+
+  std::string bits;
+  TEST_ASSERT_TRUE_MESSAGE(readPbm(goldenDir() + name + ".pbm", bits), "missing or bad golden PBM");
+  TEST_ASSERT_EQUAL(128 * 64, s.pbm.size());
+  TEST_ASSERT_EQUAL(bits.size(), s.pbm.size());
+  int diff = 0;
+  for (size_t i = 0; i < bits.size(); i++) diff += bits[i] != s.pbm[i];
+  char msg[96];
+  snprintf(msg, sizeof(msg), "%s: %d pixels differ from the golden PBM", name, diff);
+  TEST_ASSERT_EQUAL_INT_MESSAGE(0, diff, msg);
+  TEST_ASSERT_EQUAL_STRING_MESSAGE(ref.crc.c_str(), s.crc.c_str(), name);
+
+  snprintf(msg, sizeof(msg), "%s: prims %lu->%lu glyphs %lu->%lu pixels %lu->%lu", name,
+           (unsigned long)ref.prims, (unsigned long)s.prims, (unsigned long)ref.glyphs,
+           (unsigned long)s.glyphs, (unsigned long)ref.pixels, (unsigned long)s.pixels);
+  TEST_ASSERT_TRUE_MESSAGE(s.prims <= ref.prims * (1 + GROWTH_PCT / 100), msg);
+  TEST_ASSERT_TRUE_MESSAGE(s.glyphs <= ref.glyphs * (1 + GROWTH_PCT / 100), msg);
+  TEST_ASSERT_TRUE_MESSAGE(s.pixels <= ref.pixels * (1 + GROWTH_PCT / 100), msg);
+}
+
+void test_menu(void)          { checkScreen("menu"); }
+void test_profile_setup(void) { checkScreen("profile_setup"); }
+void test_profile_run(void)   { checkScreen("profile_run"); }
+void test_constant_run(void)  { checkScreen("run"); }
+void test_test(void)          { checkScreen("test"); }
+void test_cool_test(void)     { checkScreen("cool_test"); }
+
+// The rest of the scene set has references too
+void test_other_scenes(void) {
+  checkScreen("constant_setup");
+  checkScreen("profile_done");
+  checkScreen("fault");
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_every_scene_is_captured);
+  RUN_TEST(test_menu);
+  RUN_TEST(test_profile_setup);
+  RUN_TEST(test_profile_run);
+  RUN_TEST(test_constant_run);
+  RUN_TEST(test_test);
+  RUN_TEST(test_cool_test);
+  RUN_TEST(test_other_scenes);
+  return UNITY_END();
+}
@@ -0,0 +1,357 @@
+// WsProtocol byte for byte: the request head reader, the handshake key
+// (RFC 6455 section 1.3 example), server frames and the masked client
+// frame reader, fed one byte at a time as the network task does. The
+// loopback test puts the same code behind a real TCP socket.
+#include <unity.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "WsProtocol.h"
+
+static const char UPGRADE[] =
+    "GET /ws HTTP/1.1\r\n"
+    "Host: reflow.local\r\n"
+    "upgrade: WebSocket\r\n"
+    "Connection: Upgrade\r\n"
+    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+    "Sec-WebSocket-Version: 13\r\n\r\n";
+
+static bool feedAll(HttpRequest& r, const char* s) {
+  bool done = false;
+  for (; *s; s++) done = r.feed((uint8_t)*s);
+  return done;
+}
+
+// Feeds a frame; returns the last event and how many bytes it took
+static WsReader::Event feedFrame(WsReader& r, const uint8_t* b, size_t n, size_t* used = nullptr) {
+  WsReader::Event ev = WsReader::WS_MORE;
+  size_t i = 0;
+  while (i < n && ev == WsReader::WS_MORE) ev = r.feed(b[i++]);
+  if (used) *used = i;
+  return ev;
+}
+
+// A client frame with mask key 37 fa 21 3d (the RFC's example key)
+static size_t clientFrame(uint8_t first, const char* payload, uint8_t* out) {
+  static const uint8_t key[4] = {0x37, 0xfa, 0x21, 0x3d};
+  size_t n = strlen(payload);
+  out[0] = first;
+  out[1] = 0x80 | (uint8_t)n;
+  memcpy(out + 2, key, 4);
+  for (size_t i = 0; i < n; i++) out[6 + i] = (uint8_t)payload[i] ^ key[i & 3];
+  return 6 + n;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ---- Handshake ----
+
+void test_sha1_vectors(void) {
+  uint8_t d[20];
+  static const uint8_t abc[20] = {0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81, 0x6a, 0xba, 0x3e,
+                                  0x25, 0x71, 0x78, 0x50, 0xc2, 0x6c, 0x9c, 0xd0, 0xd8, 0x9d};
+  sha1((const uint8_t*)"abc", 3, d);
+  TEST_ASSERT_EQUAL_MEMORY(abc, d, 20);
+  // 56 bytes: the length no longer fits the first block
+  static const char two[] = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+  static const uint8_t twoHash[20] = {0x84, 0x98, 0x3e, 0x44, 0x1c, 0x3b, 0xd2, 0x6e, 0xba, 0xae,
+                                      0x4a, 0xa1, 0xf9, 0x51, 0x29, 0xe5, 0xe5, 0x46, 0x70, 0xf1};
+  sha1((const uint8_t*)two, strlen(two), d);
+  TEST_ASSERT_EQUAL_MEMORY(twoHash, d, 20);
+}
+
+void test_accept_key_rfc6455_example(void) {
+  char accept[29];
+  wsAcceptKey("dGhlIHNhbXBsZSBub25jZQ==", accept);
+  TEST_ASSERT_EQUAL_STRING("s3pPLMBiTxaQ9kYGzzhZRbK+xOo=", accept);
+}
+
+void test_handshake_response(void) {
+  char out[256];
+  size_t n = wsHandshake("dGhlIHNhbXBsZSBub25jZQ==", out, sizeof(out));
+  TEST_ASSERT_EQUAL(strlen(out), n);
+  TEST_ASSERT_EQUAL(0, strncmp(out, "HTTP/1.1 101 Switching Protocols\r\n", 34));
+  TEST_ASSERT_NOT_NULL(strstr(out, "\r\nSec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n\r\n"));
+  TEST_ASSERT_EQUAL(0, wsHandshake("dGhlIHNhbXBsZSBub25jZQ==", out, 64));
+}
+
+// ---- Request head ----
+
+void test_upgrade_request(void) {
+  HttpRequest r;
+  r.reset();
+  TEST_ASSERT_TRUE(feedAll(r, UPGRADE));
+  TEST_ASSERT_FALSE(r.error());
+  TEST_ASSERT_EQUAL_STRING("GET", r.method());
+  TEST_ASSERT_EQUAL_STRING("/ws", r.path());
+  TEST_ASSERT_TRUE(r.wantsWebSocket());
+  TEST_ASSERT_EQUAL_STRING("dGhlIHNhbXBsZSBub25jZQ==", r.wsKey());
+}
+
+void test_plain_get_and_reuse(void) {
+  HttpRequest r;
+  r.reset();
+  TEST_ASSERT_TRUE(feedAll(r, UPGRADE));
+  r.reset();
+  TEST_ASSERT_FALSE(feedAll(r, "GET / HTTP/1.1\r\nHost: x\r\n"));
+  TEST_ASSERT_TRUE(feedAll(r, "\r\n"));
+  TEST_ASSERT_EQUAL_STRING("/", r.path());
+  TEST_ASSERT_FALSE(r.wantsWebSocket());
+}
+
+void test_upgrade_needs_get_and_key(void) {
+  HttpRequest r;
+  r.reset();
+  TEST_ASSERT_TRUE(feedAll(r, "POST /ws HTTP/1.1\r\nUpgrade: websocket\r\nSec-WebSocket-Key: abc\r\n\r\n"));
+  TEST_ASSERT_FALSE(r.wantsWebSocket());
+  r.reset();
+  TEST_ASSERT_TRUE(feedAll(r, "GET /ws HTTP/1.1\r\nUpgrade: websocket\r\n\r\n"));
+  TEST_ASSERT_FALSE(r.wantsWebSocket());
+}
+
+void test_bad_requests(void) {
+  HttpRequest r;
+  r.reset();
+  TEST_ASSERT_FALSE(feedAll(r, "GARBAGE\r\n\r\n"));
+  TEST_ASSERT_TRUE(r.error());
+
+  r.reset();
+  feedAll(r, "GET / HTTP/1.1\r\n");
+  TEST_ASSERT_FALSE(r.feed(0));
+  TEST_ASSERT_TRUE(r.error());
+  TEST_ASSERT_FALSE(feedAll(r, "\r\n"));     // stays failed
+
+  r.reset();
+  feedAll(r, "GET / HTTP/1.1\r\nX: ");
+  for (int i = 0; i < HTTP_MAX_REQUEST && !r.error(); i++) r.feed('a');
+  TEST_ASSERT_TRUE(r.error());
+  TEST_ASSERT_FALSE(r.done());
+}
+
+// ---- Server frames ----
+
+void test_frame_lengths(void) {
+  static uint8_t payload[70000];
+  static uint8_t out[70016];
+  memset(payload, 'x', sizeof(payload));
+
+  TEST_ASSERT_EQUAL(2 + 5, wsFrame(WS_OP_TEXT, "Hello", 5, out, sizeof(out)));
+  static const uint8_t hello[] = {0x81, 0x05, 'H', 'e', 'l', 'l', 'o'};
+  TEST_ASSERT_EQUAL_MEMORY(hello, out, sizeof(hello));
+
+  TEST_ASSERT_EQUAL(2, wsFrame(WS_OP_PONG, nullptr, 0, out, sizeof(out)));
+  TEST_ASSERT_EQUAL_HEX8(0x8A, out[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, out[1]);
+
+  TEST_ASSERT_EQUAL(4 + 126, wsFrame(WS_OP_TEXT, payload, 126, out, sizeof(out)));
+  TEST_ASSERT_EQUAL_HEX8(126, out[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, out[2]);
+  TEST_ASSERT_EQUAL_HEX8(126, out[3]);
+
+  TEST_ASSERT_EQUAL(10 + 70000, wsFrame(WS_OP_TEXT, payload, 70000, out, sizeof(out)));
+  static const uint8_t len64[] = {127, 0, 0, 0, 0, 0, 0x01, 0x11, 0x70};
+  TEST_ASSERT_EQUAL_MEMORY(len64, out + 1, sizeof(len64));
+
+  TEST_ASSERT_EQUAL(0, wsFrame(WS_OP_TEXT, payload, 126, out, 129));
+  TEST_ASSERT_EQUAL(130, wsFrame(WS_OP_TEXT, payload, 126, out, 130));
+}
+
+// ---- Client frames ----
+
+void test_reader_rfc_hello(void) {
+  static const uint8_t frame[] = {0x81, 0x85, 0x37, 0xfa, 0x21, 0x3d, 0x7f, 0x9f, 0x4d, 0x51, 0x58};
+  WsReader r;
+  size_t used;
+  TEST_ASSERT_EQUAL(WsReader::WS_MESSAGE, feedFrame(r, frame, sizeof(frame), &used));
+  TEST_ASSERT_EQUAL(sizeof(frame), used);
+  TEST_ASSERT_EQUAL_STRING("Hello", r.message());
+  TEST_ASSERT_EQUAL(5, r.length());
+}
+
+void test_reader_back_to_back_frames(void) {
+  uint8_t buf[256];
+  size_t n = clientFrame(0x81, "status", buf);
+  n += clientFrame(0x89, "hb", buf + n);
+  n += clientFrame(0x8A, "", buf + n);
+  n += clientFrame(0x81, "", buf + n);
+  n += clientFrame(0x88, "", buf + n);
+
+  WsReader r;
+  const uint8_t* p = buf;
+  size_t used;
+  TEST_ASSERT_EQUAL(WsReader::WS_MESSAGE, feedFrame(r, p, n, &used));
+  TEST_ASSERT_EQUAL_STRING("status", r.message());
+  p += used; n -= used;
+  TEST_ASSERT_EQUAL(WsReader::WS_PING, feedFrame(r, p, n, &used));
+  TEST_ASSERT_EQUAL_STRING("hb", r.message());
+  p += used; n -= used;
+  // the pong is swallowed, so the empty text message ends this run
+  TEST_ASSERT_EQUAL(WsReader::WS_MESSAGE, feedFrame(r, p, n, &used));
+  TEST_ASSERT_EQUAL(0, r.length());
+  TEST_ASSERT_EQUAL_STRING("", r.message());
+  p += used; n -= used;
+  TEST_ASSERT_EQUAL(WsReader::WS_CLOSE, feedFrame(r, p, n, &used));
+  TEST_ASSERT_EQUAL(n, used);
+}
+
+void test_reader_extended_length(void) {
+  char text[WS_MAX_MESSAGE + 2];
+  memset(text, 'a', sizeof(text));
+  uint8_t buf[8 + sizeof(text)];
+  // 16-bit length up to the cap is fine
+  buf[0] = 0x81; buf[1] = 0x80 | 126; buf[2] = 0; buf[3] = WS_MAX_MESSAGE;
+  memset(buf + 4, 0, 4);
+  memcpy(buf + 8, text, WS_MAX_MESSAGE);
+  WsReader r;
+  TEST_ASSERT_EQUAL(WsReader::WS_MESSAGE, feedFrame(r, buf, 8 + WS_MAX_MESSAGE));
+  TEST_ASSERT_EQUAL(WS_MAX_MESSAGE, r.length());
+  // one more byte is refused before any payload arrives
+  buf[3] = WS_MAX_MESSAGE + 1;
+  r.reset();
+  size_t used;
+  TEST_ASSERT_EQUAL(WsReader::WS_ERROR, feedFrame(r, buf, sizeof(buf), &used));
+  TEST_ASSERT_EQUAL(4, used);
+  static const uint8_t huge[] = {0x81, 0x80 | 127, 0, 0, 0, 1, 0, 0, 0, 0};
+  r.reset();
+  TEST_ASSERT_EQUAL(WsReader::WS_ERROR, feedFrame(r, huge, sizeof(huge)));
+}
+
+void test_reader_refuses_what_it_does_not_handle(void) {
+  uint8_t buf[32];
+  WsReader r;
+  size_t n = clientFrame(0x01, "frag", buf);       // no FIN
+  TEST_ASSERT_EQUAL(WsReader::WS_ERROR, feedFrame(r, buf, n));
+  r.reset();
+  n = clientFrame(0x80, "cont", buf);
+  TEST_ASSERT_EQUAL(WsReader::WS_ERROR, feedFrame(r, buf, n));
+  r.reset();
+  n = clientFrame(0x82, "bin", buf);
+  TEST_ASSERT_EQUAL(WsReader::WS_ERROR, feedFrame(r, buf, n));
+  r.reset();
+  n = clientFrame(0xC1, "rsv", buf);               // compressed
+  TEST_ASSERT_EQUAL(WsReader::WS_ERROR, feedFrame(r, buf, n));
+  r.reset();
+  static const uint8_t unmasked[] = {0x81, 0x02, 'h', 'i'};
+  TEST_ASSERT_EQUAL(WsReader::WS_ERROR, feedFrame(r, unmasked, sizeof(unmasked)));
+}
+
+// ---- Loopback server ----
+
+// One connection, served as the network task does: the request head byte
+// by byte, the handshake, then echo text, answer pings and close
+static void serveOne(int listenFd) {
+  int c = accept(listenFd, nullptr, nullptr);
+  if (c < 0) return;
+  HttpRequest req;
+  req.reset();
+  uint8_t b;
+  bool head = false;
+  while (!head && !req.error() && recv(c, &b, 1, 0) == 1) head = req.feed(b);
+  char hs[256];
+  size_t n = head && req.wantsWebSocket() ? wsHandshake(req.wsKey(), hs, sizeof(hs)) : 0;
+  if (n && send(c, hs, n, 0) == (ssize_t)n) {
+    WsReader ws;
+    uint8_t out[WS_MAX_MESSAGE + 4];
+    bool open = true;
+    while (open && recv(c, &b, 1, 0) == 1) {
+      switch (ws.feed(b)) {
+        case WsReader::WS_MESSAGE: n = wsFrame(WS_OP_TEXT, ws.message(), ws.length(), out, sizeof(out)); break;
+        case WsReader::WS_PING:    n = wsFrame(WS_OP_PONG, ws.message(), ws.length(), out, sizeof(out)); break;
+        case WsReader::WS_CLOSE:   n = wsFrame(WS_OP_CLOSE, nullptr, 0, out, sizeof(out)); open = false; break;
+        case WsReader::WS_ERROR:   n = 0; open = false; break;
+        default:                   n = 0; break;
+      }
+      if (n) send(c, out, n, 0);
+    }
+  }
+  close(c);
+}
+
+static bool recvAll(int fd, void* buf, size_t n) {
+  for (size_t got = 0; got < n;) {
+    ssize_t r = recv(fd, (uint8_t*)buf + got, n - got, 0);
+    if (r <= 0) return false;
+    got += r;
+  }
+  return true;
+}
+
+void test_loopback_handshake_and_echo(void) {
+  int lfd = socket(AF_INET, SOCK_STREAM, 0);
+  TEST_ASSERT_TRUE(lfd >= 0);
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  TEST_ASSERT_EQUAL(0, bind(lfd, (sockaddr*)&addr, sizeof(addr)));   // any free port
+  TEST_ASSERT_EQUAL(0, listen(lfd, 1));
+  socklen_t alen = sizeof(addr);
+  TEST_ASSERT_EQUAL(0, getsockname(lfd, (sockaddr*)&addr, &alen));
+  pid_t server = fork();
+  TEST_ASSERT_TRUE(server >= 0);
+  if (server == 0) {
+    serveOne(lfd);
+    _exit(0);
+  }
+
+  int c = socket(AF_INET, SOCK_STREAM, 0);
+  timeval tv = {5, 0};                     // a stuck server fails the test, not the run
+  setsockopt(c, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  TEST_ASSERT_EQUAL(0, connect(c, (sockaddr*)&addr, sizeof(addr)));
+  TEST_ASSERT_EQUAL(strlen(UPGRADE), send(c, UPGRADE, strlen(UPGRADE), 0));
+
+  // The response head, up to its blank line
+  char head[256] = {};
+  size_t hn = 0;
+  while (hn < sizeof(head) - 1 && !strstr(head, "\r\n\r\n") && recv(c, head + hn, 1, 0) == 1) hn++;
+  TEST_ASSERT_EQUAL(0, strncmp(head, "HTTP/1.1 101 Switching Protocols\r\n", 34));
+  TEST_ASSERT_NOT_NULL(strstr(head, "\r\nSec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n\r\n"));
+
+  uint8_t frame[64], reply[64];
+  size_t n = clientFrame(0x81, "start 2", frame);
+  TEST_ASSERT_EQUAL(n, send(c, frame, n, 0));
+  TEST_ASSERT_TRUE(recvAll(c, reply, 2 + 7));
+  TEST_ASSERT_EQUAL_HEX8(0x81, reply[0]);
+  TEST_ASSERT_EQUAL(7, reply[1]);
+  TEST_ASSERT_EQUAL_MEMORY("start 2", reply + 2, 7);
+
+  n = clientFrame(0x89, "hb", frame);
+  TEST_ASSERT_EQUAL(n, send(c, frame, n, 0));
+  TEST_ASSERT_TRUE(recvAll(c, reply, 2 + 2));
+  TEST_ASSERT_EQUAL_HEX8(0x8A, reply[0]);
+  TEST_ASSERT_EQUAL_MEMORY("hb", reply + 2, 2);
+
+  n = clientFrame(0x88, "", frame);
+  TEST_ASSERT_EQUAL(n, send(c, frame, n, 0));
+  TEST_ASSERT_TRUE(recvAll(c, reply, 2));
+  TEST_ASSERT_EQUAL_HEX8(0x88, reply[0]);
+  TEST_ASSERT_EQUAL(0, reply[1]);
+  TEST_ASSERT_EQUAL(0, recv(c, reply, 1, 0));    // the server hung up
+
+  close(c);
+  close(lfd);
+  int status = -1;
+  waitpid(server, &status, 0);
+  TEST_ASSERT_EQUAL(0, status);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_sha1_vectors);
+  RUN_TEST(test_accept_key_rfc6455_example);
+  RUN_TEST(test_handshake_response);
+  RUN_TEST(test_upgrade_request);
+  RUN_TEST(test_plain_get_and_reuse);
+  RUN_TEST(test_upgrade_needs_get_and_key);
+  RUN_TEST(test_bad_requests);
+  RUN_TEST(test_frame_lengths);
+  RUN_TEST(test_reader_rfc_hello);
+  RUN_TEST(test_reader_back_to_back_frames);
+  RUN_TEST(test_reader_extended_length);
+  RUN_TEST(test_reader_refuses_what_it_does_not_handle);
+  RUN_TEST(test_loopback_handshake_and_echo);
+  return UNITY_END();
+}
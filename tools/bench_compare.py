@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Compare two `bench` env captures (see src/Bench.h) and flag regressions.
+
+Capture the boot output of the bench build on each commit, e.g.
+    pio run -e bench -t upload && pio device monitor > bench_<sha>.txt
+then
+    tools/bench_compare.py bench_old.txt bench_new.txt --threshold 10
+Exits non-zero if any kernel got slower than the threshold (percent), or if
+a kernel disappeared. Non-BENCH lines in the capture are ignored.
+"""
+import argparse
+import sys
+
+FORMAT = 1
+
+
+def parse(path):
+    results, mhz = {}, None
+    for line in open(path, errors="replace"):
+        parts = line.strip().split(",")
+        if parts[0] == "BENCH_BEGIN" and len(parts) == 3:
+            if int(parts[1]) != FORMAT:
+                raise ValueError("%s: bench format %s, expected %d" % (path, parts[1], FORMAT))
+            mhz = int(parts[2])
+        elif parts[0] == "BENCH" and len(parts) == 5:
+            name, iters, cycles, ns = parts[1], int(parts[2]), int(parts[3]), int(parts[4])
+            results[name] = {"iters": iters, "cycles": cycles, "ns": ns}
+    if not results:
+        raise ValueError("%s: no BENCH lines found" % path)
+    return mhz, results
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("old")
+    ap.add_argument("new")
+    ap.add_argument("--threshold", type=float, default=10.0, help="allowed slowdown in percent")
+    args = ap.parse_args()
+
+    old_mhz, old = parse(args.old)
+    new_mhz, new = parse(args.new)
+    if old_mhz != new_mhz:
+        print("# warning: CPU clock differs (%s vs %s MHz), comparing cycles" % (old_mhz, new_mhz),
+              file=sys.stderr)
+
+    failed = False
+    print("%-22s %10s %10s %8s" % ("kernel", "old_cyc", "new_cyc", "delta"))
+    for name in sorted(set(old) | set(new)):
+        if name not in new:
+            print("%-22s %10d %10s %8s  MISSING" % (name, old[name]["cycles"], "-", "-"))
+            failed = True
+            continue
+        if name not in old:
+            print("%-22s %10s %10d %8s  new" % (name, "-", new[name]["cycles"], "-"))
+            continue
+        a, b = old[name], new[name]
+        note = ""
+        if a["iters"] != b["iters"]:
+            note = "  iters changed"
+        delta = 100.0 * (b["cycles"] - a["cycles"]) / max(a["cycles"], 1)
+        if delta > args.threshold:
+            note += "  REGRESSION"
+            failed = True
+        print("%-22s %10d %10d %+7.1f%%%s" % (name, a["cycles"], b["cycles"], delta, note))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
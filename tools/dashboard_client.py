@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+"""Talk to the station's WiFi dashboard (see src/WebDashboard.h).
+
+    tools/dashboard_client.py 192.168.4.1                      # samples as CSV until Ctrl-C
+    tools/dashboard_client.py 192.168.4.1 --rate 200 --count 100 -o run.csv
+    tools/dashboard_client.py 192.168.4.1 --send "start 1"
+    tools/dashboard_client.py localhost:8080 --check           # protocol checks
+
+A minimal stdlib WebSocket client (RFC 6455), so it also serves as the
+test peer for src/WsProtocol.cpp: --check fetches the page, verifies the
+handshake, rate / command acks, ping-pong, the oversize-frame close and the
+sample stream, against a board or a Linux build of the protocol layer.
+"""
+import argparse
+import base64
+import csv
+import hashlib
+import json
+import os
+import socket
+import struct
+import sys
+import time
+
+GUID = b"258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+FIELDS = ["t", "m", "f", "b", "sp", "df", "db", "fan", "fl", "n"]
+
+
+def split_host(addr):
+    host, _, port = addr.partition(":")
+    return host, int(port or 80)
+
+
+def http_get(addr, path):
+    s = socket.create_connection(split_host(addr), timeout=5)
+    s.sendall(("GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n" % (path, addr)).encode())
+    data = b""
+    while True:
+        chunk = s.recv(4096)
+        if not chunk:
+            break
+        data += chunk
+    s.close()
+    head, _, body = data.partition(b"\r\n\r\n")
+    return head.decode("latin-1"), body
+
+
+class WebSocket:
+    def __init__(self, addr, path="/ws", timeout=5.0):
+        self.sock = socket.create_connection(split_host(addr), timeout=timeout)
+        key = base64.b64encode(os.urandom(16)).decode()
+        self.sock.sendall(("GET %s HTTP/1.1\r\nHost: %s\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                           "Sec-WebSocket-Key: %s\r\nSec-WebSocket-Version: 13\r\n\r\n" % (path, addr, key)).encode())
+        head = b""
+        while b"\r\n\r\n" not in head:
+            chunk = self.sock.recv(1)
+            if not chunk:
+                raise ConnectionError("closed during handshake")
+            head += chunk
+        lines = head.decode("latin-1").split("\r\n")
+        if " 101 " not in lines[0]:
+            raise ConnectionError("no upgrade: " + lines[0])
+        want = base64.b64encode(hashlib.sha1(key.encode() + GUID).digest()).decode()
+        got = [l.split(":", 1)[1].strip() for l in lines if l.lower().startswith("sec-websocket-accept:")]
+        if got != [want]:
+            raise ConnectionError("bad Sec-WebSocket-Accept %r, expected %r" % (got, want))
+
+    def send(self, payload, opcode=0x1):
+        if isinstance(payload, str):
+            payload = payload.encode()
+        mask = os.urandom(4)
+        n = len(payload)
+        if n < 126:
+            head = struct.pack("!BB", 0x80 | opcode, 0x80 | n)
+        elif n < 65536:
+            head = struct.pack("!BBH", 0x80 | opcode, 0x80 | 126, n)
+        else:
+            head = struct.pack("!BBQ", 0x80 | opcode, 0x80 | 127, n)
+        self.sock.sendall(head + mask + bytes(b ^ mask[i & 3] for i, b in enumerate(payload)))
+
+    def _exact(self, n):
+        data = b""
+        while len(data) < n:
+            chunk = self.sock.recv(n - len(data))
+            if not chunk:
+                raise ConnectionError("closed")
+            data += chunk
+        return data
+
+    def recv(self):
+        """Returns (opcode, payload bytes)."""
+        b0, b1 = self._exact(2)
+        n = b1 & 0x7F
+        if n == 126:
+            n = struct.unpack("!H", self._exact(2))[0]
+        elif n == 127:
+            n = struct.unpack("!Q", self._exact(8))[0]
+        if b1 & 0x80:
+            raise ConnectionError("server frames must not be masked")
+        return b0 & 0x0F, self._exact(n)
+
+    def recv_json(self, want=None):
+        """Next JSON text message (with key `want` if given); pongs etc. skipped."""
+        while True:
+            op, data = self.recv()
+            if op == 0x8:
+                raise ConnectionError("closed by the station")
+            if op == 0x1:
+                msg = json.loads(data)
+                if want is None or want in msg:
+                    return msg
+
+    def close(self):
+        try:
+            self.send(b"", 0x8)
+        finally:
+            self.sock.close()
+
+
+def run_check(addr):
+    results = []
+
+    def check(name, fn):
+        try:
+            detail = fn()
+            results.append(True)
+            print("ok   %-24s %s" % (name, detail or ""))
+        except Exception as e:                       # noqa: BLE001 - report and go on
+            results.append(False)
+            print("FAIL %-24s %s" % (name, e))
+
+    def page():
+        head, body = http_get(addr, "/")
+        assert " 200 " in head.split("\r\n")[0], head.split("\r\n")[0]
+        assert b"<html" in body and b"/ws" in body, "no dashboard page"
+        return "%d bytes" % len(body)
+
+    def missing():
+        head, _ = http_get(addr, "/nope")
+        assert " 404 " in head.split("\r\n")[0], head.split("\r\n")[0]
+
+    def stream():
+        ws = WebSocket(addr)
+        ws.send("rate 200")
+        assert ws.recv_json("ack")["ack"] == "rate 200"
+        t0 = time.monotonic()
+        samples = [ws.recv_json("t") for _ in range(5)]
+        dt = (time.monotonic() - t0) / 5
+        assert all(set(FIELDS) <= set(s) for s in samples), samples[0]
+        assert 0.1 < dt < 0.5, "push every %.2f s, asked for 0.2" % dt
+        ws.close()
+        return "5 samples, %.0f ms apart, %d ticks each" % (dt * 1000, samples[-1]["n"])
+
+    def commands():
+        ws = WebSocket(addr)
+        ws.send("launch")
+        assert "err" in ws.recv_json("err")
+        ws.send("abort")
+        assert ws.recv_json("ack")["ack"] == "abort"
+        ws.close()
+
+    def ping():
+        ws = WebSocket(addr)
+        ws.send(b"hello", 0x9)
+        while True:
+            op, data = ws.recv()
+            if op == 0xA:
+                assert data == b"hello", data
+                break
+        ws.close()
+
+    def oversize():
+        ws = WebSocket(addr)
+        ws.send("x" * 300)
+        while True:
+            op, _ = ws.recv()
+            if op == 0x8:
+                break
+        ws.sock.close()
+
+    check("page", page)
+    check("404", missing)
+    check("handshake + stream", stream)
+    check("commands", commands)
+    check("ping", ping)
+    check("oversize frame closes", oversize)
+    print("all checks passed" if all(results) else "%d checks failed" % results.count(False))
+    return all(results)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("addr", help="station address, host[:port]")
+    ap.add_argument("--rate", type=int, help="push interval, ms")
+    ap.add_argument("--send", action="append", default=[], help="command to send (start [n], abort)")
+    ap.add_argument("--count", type=int, help="stop after this many samples")
+    ap.add_argument("-o", "--csv", help="CSV output (default stdout)")
+    ap.add_argument("--check", action="store_true", help="run the protocol checks")
+    args = ap.parse_args()
+
+    if args.check:
+        sys.exit(0 if run_check(args.addr) else 1)
+
+    ws = WebSocket(args.addr)
+    if args.rate:
+        ws.send("rate %d" % args.rate)
+    for cmd in args.send:
+        ws.send(cmd)
+    out = open(args.csv, "w", newline="") if args.csv else sys.stdout
+    w = csv.DictWriter(out, fieldnames=FIELDS, extrasaction="ignore")
+    w.writeheader()
+    n = 0
+    try:
+        while args.count is None or n < args.count:
+            msg = ws.recv_json()
+            if "t" not in msg:
+                print("# %s" % json.dumps(msg), file=sys.stderr)
+                continue
+            w.writerow(msg)
+            out.flush()
+            n += 1
+    except KeyboardInterrupt:
+        pass
+    ws.close()
+
+
+if __name__ == "__main__":
+    main()
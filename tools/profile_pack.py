@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+"""Pack JSON reflow profiles into the station's library file (see src/ProfileLibrary.h).
+
+    tools/profile_pack.py tools/profiles.json -o data/profiles.bin
+    pio run -t uploadfs          # note: rewrites the whole LittleFS image
+    tools/profile_pack.py --dump data/profiles.bin   # back to JSON
+    tools/profile_pack.py tools/profiles.json --check  # validate only
+
+Every profile is validated first, with the same checks as the station
+(src/ProfileValidator.h): errors stop the pack, warnings are printed, and
+--stretch lengthens heating ramps the plates cannot follow.
+
+JSON: {"profiles": [{"name", "min", "max", "done", "cooling_slot",
+"pid_profile" and "smooth" (optional), "slots": [{"t", "c", "phase", "hold_tol",
+"hold_max"}]}]}. t is the slot end in seconds from start, c the target in
+°C, phase one of preheat/soak/reflow/cool; hold_tol/hold_max are optional
+(see ProfileEntry in src/Profiles.h). An optional top-level "limits" object
+overrides DEFAULT_LIMITS below with measured plate values.
+"""
+import argparse
+import json
+import math
+import os
+import struct
+import sys
+
+VERSION = 1
+MAX_PROFILES = 32
+MAX_SLOTS = 32          # MAXPRSLOTS
+HEADER = struct.Struct("<4sBBH")
+INDEX = struct.Struct("<16sIH")
+RECORD = struct.Struct("<BBBBhhh")
+SLOT = struct.Struct("<HHBBH")
+PHASES = ["preheat", "soak", "reflow", "cool"]
+PROF_SMOOTH = 0x01
+
+# Mirrors DEFAULT_PLATE_LIMITS / PLATE_MAX_C / HEAT_HEADROOM / HOLD_*
+PLATE_MAX_C = 250
+HEAT_HEADROOM = 1.10
+HOLD_TOL_MAX_C = 20
+HOLD_MAX_SECS = 600
+DEFAULT_LIMITS = {
+    "front": {"heat_gain": 2.0, "loss_coef": 0.0017, "ambient": 25.0},
+    "back": {"heat_gain": 2.0, "loss_coef": 0.0017, "ambient": 25.0},
+    "fan_loss_coef": 0.0055,
+    "max_output_pct": 90,
+}
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def heat_secs(lim, y0, y1):
+    worst = 0.0
+    for plate in ("front", "back"):
+        p = lim[plate]
+        g = p["heat_gain"] * lim["max_output_pct"] / 100.0
+        k, a = p["loss_coef"], p["ambient"]
+        if g - k * (y1 - a) <= 0:
+            return None
+        t = (y1 - y0) / g if k <= 0 else math.log((g - k * (y0 - a)) / (g - k * (y1 - a))) / k
+        worst = max(worst, t)
+    return worst
+
+
+def cool_secs(lim, y0, y1):
+    worst = 0.0
+    for plate in ("front", "back"):
+        p = lim[plate]
+        k, a = p["loss_coef"] + lim["fan_loss_coef"], p["ambient"]
+        if y1 <= a or k <= 0:
+            return None
+        worst = max(worst, math.log((y0 - a) / (y1 - a)) / k)
+    return worst
+
+
+def validate(p, lim, stretch=False):
+    """Return (errors, warnings) for one profile; with stretch, rewrite slot times in place."""
+    errors, warnings = [], []
+    slots = p["slots"]
+    if not 1 <= len(slots) <= MAX_SLOTS:
+        return ["%d slots, expected 1..%d" % (len(slots), MAX_SLOTS)], []
+    lo, hi = p["min"], p["max"]
+    if lo >= hi or hi > PLATE_MAX_C:
+        errors.append("temp range %d..%d C invalid (plate max %d)" % (lo, hi, PLATE_MAX_C))
+    if p["cooling_slot"] > len(slots):
+        warnings.append("cooling_slot %d past the last slot" % p["cooling_slot"])
+    if not lo <= p["done"] <= hi:
+        warnings.append("done %d C outside %d..%d" % (p["done"], lo, hi))
+
+    ambient = max(lim["front"]["ambient"], lim["back"]["ambient"])
+    prev_c, prev_t, shift = max(lo, ambient), 0, 0
+    for s, e in enumerate(slots):
+        t, y = e["t"], e["c"]
+        if t <= prev_t and (s or not t):
+            errors.append("slot %d: time %ds not after %ds" % (s, t, prev_t))
+        if not lo <= y <= hi:
+            errors.append("slot %d: target %d C outside %d..%d" % (s, y, lo, hi))
+        if e.get("phase", "preheat") not in PHASES:
+            errors.append("slot %d: phase %r, expected one of %s" % (s, e.get("phase"), "/".join(PHASES)))
+        tol, hmax = e.get("hold_tol", 0), e.get("hold_max", 0)
+        if tol > HOLD_TOL_MAX_C:
+            errors.append("slot %d: hold tolerance %d C above %d" % (s, tol, HOLD_TOL_MAX_C))
+        if tol and not 1 <= hmax <= HOLD_MAX_SECS:
+            errors.append("slot %d: hold limit %ds, expected 1..%d" % (s, hmax, HOLD_MAX_SECS))
+        if s == p["cooling_slot"] and y >= prev_c:
+            warnings.append("slot %d: cooling_slot does not fall (%.0f -> %d C)" % (s, prev_c, y))
+        dt = max(t - prev_t, 0)
+        if y > prev_c:
+            need = heat_secs(lim, prev_c, y)
+            if need is None:
+                errors.append("slot %d: %d C is beyond what the plates reach" % (s, y))
+            elif need * HEAT_HEADROOM > dt:
+                add = math.ceil(need * HEAT_HEADROOM - dt)
+                if stretch:
+                    shift += add
+                    warnings.append("slot %d: ramp to %d C stretched %ds -> %ds" % (s, y, dt, dt + add))
+                else:
+                    warnings.append("slot %d: ramp to %d C needs %ds, has %ds"
+                                    % (s, y, math.ceil(need * HEAT_HEADROOM), dt))
+        elif y < prev_c:
+            need = cool_secs(lim, prev_c, y)
+            if need is None:
+                warnings.append("slot %d: %d C is at or below ambient" % (s, y))
+            elif need > dt:
+                warnings.append("slot %d: cooling to %d C takes ~%ds, has %ds" % (s, y, math.ceil(need), dt))
+        if stretch:
+            e["t"] = t + shift
+        prev_t, prev_c = t, y
+    return errors, warnings
+
+
+def pack_profile(p):
+    name = p["name"].encode("ascii")
+    if len(name) > 16:
+        raise ValueError("name '%s' longer than 16 characters" % p["name"])
+    slots = p["slots"]
+    if not 1 <= len(slots) <= MAX_SLOTS:
+        raise ValueError("%s: %d slots, expected 1..%d" % (p["name"], len(slots), MAX_SLOTS))
+    flags = PROF_SMOOTH if p.get("smooth") else 0
+    body = RECORD.pack(p.get("pid_profile", 0), len(slots), p["cooling_slot"], flags,
+                       p["min"], p["max"], p["done"])
+    for s in slots:
+        body += SLOT.pack(s["t"], s["c"], PHASES.index(s.get("phase", "preheat")),
+                          s.get("hold_tol", 0), s.get("hold_max", 0))
+    return name, body + struct.pack("<H", crc16(body))
+
+
+def pack(profiles):
+    if not 1 <= len(profiles) <= MAX_PROFILES:
+        raise ValueError("%d profiles, expected 1..%d" % (len(profiles), MAX_PROFILES))
+    records = [pack_profile(p) for p in profiles]
+    offset = HEADER.size + INDEX.size * len(records)
+    index = b""
+    for name, rec in records:
+        index += INDEX.pack(name, offset, len(rec))
+        offset += len(rec)
+    head = HEADER.pack(b"RPLB", VERSION, len(records), crc16(index))
+    return head + index + b"".join(rec for _, rec in records)
+
+
+def unpack(data):
+    magic, version, count, index_crc = HEADER.unpack_from(data)
+    if magic != b"RPLB" or version != VERSION:
+        raise ValueError("not a profile library (magic %r, version %d)" % (magic, version))
+    index = data[HEADER.size:HEADER.size + INDEX.size * count]
+    if crc16(index) != index_crc:
+        raise ValueError("index CRC mismatch")
+    profiles = []
+    for k in range(count):
+        name, off, length = INDEX.unpack_from(index, k * INDEX.size)
+        rec = data[off:off + length]
+        if crc16(rec[:-2]) != struct.unpack_from("<H", rec, length - 2)[0]:
+            raise ValueError("record %d CRC mismatch" % k)
+        pid, n, cool, flags, lo, hi, done = RECORD.unpack_from(rec)
+        slots = []
+        for i in range(n):
+            t, c, ph, tol, hmax = SLOT.unpack_from(rec, RECORD.size + i * SLOT.size)
+            if ph >= len(PHASES):
+                raise ValueError("record %d slot %d: phase %d, expected 0..%d" % (k, i, ph, len(PHASES) - 1))
+            s = {"t": t, "c": c, "phase": PHASES[ph]}
+            if tol:
+                s.update(hold_tol=tol, hold_max=hmax)
+            slots.append(s)
+        profiles.append({"name": name.split(b"\0")[0].decode("ascii"), "pid_profile": pid,
+                         "smooth": bool(flags & PROF_SMOOTH), "cooling_slot": cool,
+                         "min": lo, "max": hi, "done": done, "slots": slots})
+    return profiles
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("input", help="profiles JSON (or a .bin with --dump)")
+    ap.add_argument("-o", "--output", default="data/profiles.bin")
+    ap.add_argument("--dump", action="store_true", help="decode a library file to JSON on stdout")
+    ap.add_argument("--check", action="store_true", help="validate only, exit 1 on errors")
+    ap.add_argument("--stretch", action="store_true", help="lengthen heating ramps the plates cannot follow")
+    args = ap.parse_args()
+
+    if args.dump:
+        json.dump({"profiles": unpack(open(args.input, "rb").read())}, sys.stdout, indent=2)
+        print()
+        return
+
+    doc = json.load(open(args.input))
+    profiles = doc["profiles"]
+    lim = dict(DEFAULT_LIMITS, **doc.get("limits", {}))
+    failed = False
+    for p in profiles:
+        errors, warnings = validate(p, lim, args.stretch)
+        for m in errors:
+            print("%s: error: %s" % (p["name"], m), file=sys.stderr)
+        for m in warnings:
+            print("%s: warning: %s" % (p["name"], m), file=sys.stderr)
+        failed |= bool(errors)
+    if failed or args.check:
+        sys.exit(1 if failed else 0)
+
+    data = pack(profiles)
+    if os.path.dirname(args.output):
+        os.makedirs(os.path.dirname(args.output), exist_ok=True)
+    with open(args.output, "wb") as f:
+        f.write(data)
+    print("%d profiles, %d bytes -> %s" % (len(profiles), len(data), args.output), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
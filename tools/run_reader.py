@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""Read run logs recorded on the station (see src/RunRecorder.h).
+
+Copy /runs off the device (e.g. via a LittleFS download or `pio run -t
+downloadfs` tooling), then
+    tools/run_reader.py run_00012.rec            # header + CSV to stdout
+    tools/run_reader.py run_00012.rec -o run.csv
+A chunk with a bad CRC or a truncated tail (power cut mid-write) is
+reported and skipped; the other chunks still decode.
+"""
+import argparse
+import csv
+import struct
+import sys
+
+HEADER = struct.Struct("<4sBBHI16sh4f4f")
+CHUNK_MAGIC = 0xC7A5
+FIELDS = ["dt_ds", "t_front_dc", "t_back_dc", "setpoint_dc",
+          "duty_front", "duty_back", "fan_pct", "flags"]
+KINDS = {1: "profile", 2: "constant", 3: "characterize"}
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def varints(buf):
+    i, n = 0, len(buf)
+    while i < n:
+        z = shift = 0
+        while True:
+            b = buf[i]
+            i += 1
+            z |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                break
+        yield (z >> 1) ^ -(z & 1)
+
+
+def read_run(data):
+    if len(data) < HEADER.size:
+        raise ValueError("file shorter than header")
+    (magic, version, kind, period, seq, name, const_c,
+     p, i, d, imax, off_f, sc_f, off_b, sc_b) = HEADER.unpack_from(data)
+    if magic != b"RRUN" or version != 1:
+        raise ValueError("not a run file (magic %r, version %d)" % (magic, version))
+    header = {
+        "seq": seq, "kind": KINDS.get(kind, kind), "period_ms": period,
+        "name": name.split(b"\0")[0].decode("ascii", "replace"), "const_c": const_c,
+        "gains": {"P": p, "I": i, "D": d, "iMax": imax},
+        "cal": {"front": (off_f, sc_f), "back": (off_b, sc_b)},
+    }
+
+    samples, errors = [], []
+    pos, t_ds = HEADER.size, 0
+    while pos + 6 <= len(data):
+        magic, length, count = struct.unpack_from("<HHH", data, pos)
+        if magic != CHUNK_MAGIC:
+            errors.append("bad chunk magic at %d" % pos)
+            break
+        payload = data[pos + 6:pos + 6 + length]
+        if len(payload) < length or pos + 8 + length > len(data):
+            errors.append("truncated chunk at %d" % pos)
+            break
+        (crc,) = struct.unpack_from("<H", data, pos + 6 + length)
+        pos += 8 + length
+        if crc16(payload) != crc:
+            errors.append("CRC mismatch in chunk ending at %d" % pos)
+            continue
+        vals = list(varints(payload))
+        if len(vals) != count * len(FIELDS):
+            errors.append("chunk at %d has %d values, expected %d" % (pos, len(vals), count * len(FIELDS)))
+            continue
+        prev = None
+        for k in range(count):
+            cur = vals[k * len(FIELDS):(k + 1) * len(FIELDS)]
+            if prev is not None:
+                cur = [a + b for a, b in zip(prev, cur)]
+            prev = cur
+            t_ds += cur[0]
+            samples.append([t_ds / 10.0] + [v / 10.0 for v in cur[1:4]] + cur[4:])
+    return header, samples, errors
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("file")
+    ap.add_argument("-o", "--csv", help="CSV output (default stdout)")
+    args = ap.parse_args()
+
+    header, samples, errors = read_run(open(args.file, "rb").read())
+    print("# run %(seq)d %(kind)s '%(name)s' period=%(period_ms)dms" % header, file=sys.stderr)
+    print("# gains %s cal %s" % (header["gains"], header["cal"]), file=sys.stderr)
+    for e in errors:
+        print("# warning: " + e, file=sys.stderr)
+
+    out = open(args.csv, "w", newline="") if args.csv else sys.stdout
+    w = csv.writer(out)
+    w.writerow(["t_s", "t_front", "t_back", "setpoint", "duty_front", "duty_back", "fan_pct", "flags"])
+    w.writerows(samples)
+    print("# %d samples" % len(samples), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
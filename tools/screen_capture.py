@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""Split a ui-capture boot log (see src/UiScenes.h) into images and check them.
+
+Flash the ui-capture env and save the serial output, e.g.
+    pio run -e ui-capture -t upload && pio device monitor > screens.txt
+then
+    tools/screen_capture.py screens.txt -o screens/                 # PBM + PNG + stats.csv
+    tools/screen_capture.py screens.txt -o screens/ --golden ref/   # compare to reference set
+    tools/screen_capture.py screens.txt --golden ref/ --update      # accept as new reference
+A comparison fails on any changed pixel, and on draw counts (primitives,
+glyphs, pixel writes) that grew by more than --threshold percent.
+
+The committed reference set is test/test_ui_golden/golden, rendered on the
+host (pio run -e native-ui-capture, then run the program it builds);
+`pio test -e native` checks the screens against it.
+"""
+import argparse
+import csv
+import os
+import struct
+import sys
+import zlib
+
+W, H = 128, 64
+STATS = ["primitives", "glyphs", "pixels"]
+
+
+def parse(lines):
+    screens, i = {}, 0
+    while i < len(lines):
+        parts = lines[i].strip().split(",")
+        i += 1
+        if parts[0] != "SCREEN" or len(parts) != 6:
+            continue
+        name = parts[1]
+        rec = {k: int(v) for k, v in zip(STATS, parts[2:5])}
+        rec["crc"] = parts[5]
+        if i + 2 + H > len(lines) or lines[i].strip() != "P1":
+            raise ValueError("screen %s: missing or truncated PBM" % name)
+        rows = [l.strip() for l in lines[i + 2:i + 2 + H]]
+        if any(len(r) != W for r in rows):
+            raise ValueError("screen %s: bad PBM row width" % name)
+        rec["rows"] = rows
+        screens[name] = rec
+        i += 2 + H
+    return screens
+
+
+def write_pbm(path, rows):
+    with open(path, "w") as f:
+        f.write("P1\n%d %d\n" % (W, H))
+        f.write("\n".join(rows) + "\n")
+
+
+def read_pbm(path):
+    tok = open(path).read().split()
+    if tok[0] != "P1" or int(tok[1]) != W or int(tok[2]) != H:
+        raise ValueError("%s: expected a %dx%d P1 PBM" % (path, W, H))
+    bits = "".join(tok[3:])
+    return [bits[y * W:(y + 1) * W] for y in range(H)]
+
+
+def write_png(path, rows, scale=4):
+    # Grayscale, white-on-black like the OLED, upscaled for viewing
+    raw = b""
+    for r in rows:
+        line = bytes(255 if c == "1" else 0 for c in r for _ in range(scale))
+        raw += (b"\x00" + line) * scale
+
+    def chunk(tag, data):
+        c = struct.pack(">I", len(data)) + tag + data
+        return c + struct.pack(">I", zlib.crc32(tag + data) & 0xFFFFFFFF)
+    png = b"\x89PNG\r\n\x1a\n"
+    png += chunk(b"IHDR", struct.pack(">IIBBBBB", W * scale, H * scale, 8, 0, 0, 0, 0))
+    png += chunk(b"IDAT", zlib.compress(raw, 9))
+    png += chunk(b"IEND", b"")
+    open(path, "wb").write(png)
+
+
+def write_stats(path, screens):
+    with open(path, "w", newline="") as f:
+        w = csv.writer(f)
+        w.writerow(["screen"] + STATS + ["crc"])
+        for name, s in screens.items():
+            w.writerow([name] + [s[k] for k in STATS] + [s["crc"]])
+
+
+def read_stats(path):
+    with open(path) as f:
+        return {r["screen"]: {k: int(r[k]) for k in STATS} for r in csv.DictReader(f)}
+
+
+def save(outdir, screens, png=True):
+    os.makedirs(outdir, exist_ok=True)
+    for name, s in screens.items():
+        write_pbm(os.path.join(outdir, name + ".pbm"), s["rows"])
+        if png:
+            write_png(os.path.join(outdir, name + ".png"), s["rows"])
+    write_stats(os.path.join(outdir, "stats.csv"), screens)
+
+
+def compare(screens, golden, threshold):
+    ref_stats = read_stats(os.path.join(golden, "stats.csv"))
+    failed = False
+    for name, s in screens.items():
+        ref_path = os.path.join(golden, name + ".pbm")
+        if not os.path.exists(ref_path):
+            print("%-16s no reference" % name)
+            continue
+        ref = read_pbm(ref_path)
+        diff = sum(a != b for ra, rb in zip(ref, s["rows"]) for a, b in zip(ra, rb))
+        notes = []
+        if diff:
+            notes.append("%d pixels differ" % diff)
+        for k in STATS:
+            old, new = ref_stats.get(name, {}).get(k), s[k]
+            if old and 100.0 * (new - old) / old > threshold:
+                notes.append("%s %d -> %d" % (k, old, new))
+        failed |= bool(notes)
+        print("%-16s %s" % (name, "; ".join(notes) if notes else "ok"))
+    for name in ref_stats:
+        if name not in screens:
+            print("%-16s missing from capture" % name)
+            failed = True
+    return not failed
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("capture")
+    ap.add_argument("-o", "--out", help="write PBM/PNG/stats.csv here")
+    ap.add_argument("--golden", help="reference directory to compare against")
+    ap.add_argument("--update", action="store_true", help="overwrite the reference set")
+    ap.add_argument("--threshold", type=float, default=10.0, help="allowed growth of draw counts, percent")
+    args = ap.parse_args()
+
+    screens = parse(open(args.capture, errors="replace").read().splitlines())
+    if not screens:
+        sys.exit("no SCREEN records in %s" % args.capture)
+    if args.out:
+        save(args.out, screens)
+    for name, s in screens.items():
+        print("# %-16s prims=%-4d glyphs=%-4d pixels=%d" % (name, s["primitives"], s["glyphs"], s["pixels"]),
+              file=sys.stderr)
+
+    if args.golden:
+        if args.update:
+            save(args.golden, screens, png=False)
+            print("reference updated: %d screens" % len(screens))
+        elif not compare(screens, args.golden, args.threshold):
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+"""Drive the station over its serial port (see src/CommandParser.h).
+
+    tools/station_cmd.py /dev/ttyUSB0 status
+    tools/station_cmd.py /dev/ttyUSB0 "heat both" "start 1"
+    tools/station_cmd.py /dev/ttyUSB0 "telemetry on 250" "start 1" --watch --csv run.csv
+    tools/station_cmd.py /dev/ttyUSB0 --check        # scripted session, exit 1 on a bad reply
+    tools/station_cmd.py --host --check              # the same against the native-station build
+
+Each command waits for its final "ok ..." / "err ..." line. Log lines
+("[TAG] ...") go to stderr with --log. Telemetry frames sharing the UART are
+decoded with tools/telemetry_decode.py; --watch keeps reading after the
+last command (Ctrl-C stops) and --csv writes the frames. The port is
+opened raw with termios, so no pyserial is needed and a pseudo-terminal
+works as well as the board's UART. --host starts the firmware built for the
+PC (pio run -e native-station) on a fresh pseudo-terminal and talks to that
+instead of a port, building it first if it is not there.
+The station must not be reset by opening the port: on boards that reset
+on DTR, open it once and keep it open (--watch), or cut the DTR line.
+"""
+import argparse
+import csv
+import os
+import select
+import subprocess
+import sys
+import termios
+import time
+import tty
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import telemetry_decode                  # noqa: E402
+
+
+class Link:
+    """Raw serial port split into text lines and telemetry frames."""
+
+    def __init__(self, path, baud=115200, log=None):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY | os.O_NONBLOCK)
+        tty.setraw(self.fd)
+        attrs = termios.tcgetattr(self.fd)
+        speed = getattr(termios, "B%d" % baud)
+        attrs[4] = attrs[5] = speed
+        termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+        self.buf = b""
+        self.log = log
+        self.frames = []
+
+    def write(self, data):
+        while data:
+            try:
+                data = data[os.write(self.fd, data):]
+            except BlockingIOError:
+                select.select([], [self.fd], [], 1.0)
+
+    def lines(self, timeout):
+        """Yield text lines until `timeout` seconds pass without one."""
+        end = time.monotonic() + timeout
+        while True:
+            line = self._next()
+            if line is not None:
+                end = time.monotonic() + timeout
+                yield line
+                continue
+            left = end - time.monotonic()
+            if left <= 0:
+                return
+            r, _, _ = select.select([self.fd], [], [], left)
+            if r:
+                try:
+                    self.buf += os.read(self.fd, 4096)
+                except (BlockingIOError, OSError):
+                    pass
+
+    def _next(self):
+        # Frames are 0x00, COBS, 0x00; text never contains a zero byte
+        while self.buf:
+            z, n = self.buf.find(b"\x00"), self.buf.find(b"\n")
+            if n >= 0 and (z < 0 or n < z):
+                line, self.buf = self.buf[:n], self.buf[n + 1:]
+                line = line.decode("ascii", "replace").rstrip("\r")
+                if line.startswith("[") and self.log:
+                    self.log.write(line + "\n")
+                    continue
+                return line
+            if z < 0:
+                return None
+            end = self.buf.find(b"\x00", z + 1)
+            if end < 0:
+                return None
+            if end == z + 1:                    # back-to-back: the second may open a frame
+                self.buf = self.buf[z + 1:]
+                continue
+            chunk, self.buf = self.buf[z:end + 1], self.buf[end + 1:]
+            self.frames.extend(telemetry_decode.to_row(r) for r in telemetry_decode.frames(chunk))
+        return None
+
+    def command(self, cmd, timeout=2.0):
+        """Send one command; returns (final line, detail lines) or (None, ...) on timeout."""
+        self.write(cmd.encode("ascii") + b"\n")
+        detail = []
+        for line in self.lines(timeout):
+            if line.startswith("ok") or line.startswith("err"):
+                return line, detail
+            if line.startswith("- "):
+                detail.append(line[2:])
+        return None, detail
+
+
+# Scripted session: (command, expected start of the reply). Byte strings
+# are written as-is to exercise split lines and CRLF; a number pauses.
+CHECK = [
+    ("help", "ok"),
+    ("status", "ok state=menu"),
+    ("bogus", "err unknown command"),
+    ("x" * 200, "err line too long"),
+    (b"sta", None),
+    (b"tus\r\n\r\n", "ok state=menu"),
+    ("profile 999", "err profile"),
+    ("profile 0", "ok 0"),
+    ("heat sideways", "err heat"),
+    ("heat both", "ok both"),
+    ("gains 1 2", "err gains"),
+    ("gains 3 0.1 8", "ok P=3.000 I=0.100 D=8.000"),
+    ("gains default", "ok"),
+    ("const 500", "err const"),
+    ("start 0", "ok preheat"),
+    ("status", "ok state=preheat"),
+    ("profile 1", "err busy"),
+    ("abort", "ok done"),
+    ("abort", "ok menu"),
+    ("const 120 60", "ok constant 120C for 60s"),
+    ("const 130", "ok constant 130C"),
+    ("abort", "ok done"),
+    ("telemetry on 200", "ok telemetry on"),
+    (1.0, None),
+    ("status", "ok"),
+    ("telemetry off", "ok telemetry off"),
+    ("abort", "ok menu"),
+]
+
+
+def run_check(link):
+    failed = 0
+    for cmd, want in CHECK:
+        if isinstance(cmd, float):
+            time.sleep(cmd)
+            continue
+        if isinstance(cmd, bytes):
+            link.write(cmd)
+            if want is None:
+                time.sleep(0.1)
+                continue
+            reply = next((l for l in link.lines(2.0) if l.startswith(("ok", "err"))), None)
+            shown = repr(cmd)
+        else:
+            reply, _ = link.command(cmd)
+            shown = cmd if len(cmd) < 40 else cmd[:37] + "..."
+        good = reply is not None and reply.startswith(want)
+        failed += not good
+        print("%-4s %-28s -> %s" % ("ok" if good else "FAIL", shown, reply))
+    frames = len(link.frames)
+    print("%-4s %d telemetry frames decoded" % ("ok" if frames else "FAIL", frames))
+    failed += not frames
+    print("%d checks failed" % failed if failed else "all checks passed")
+    return failed == 0
+
+
+REPO = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HOST_PROGRAM = os.path.join(REPO, ".pio", "build", "native-station", "program")
+
+
+def start_host(program):
+    """Run the native build with --pty; returns (process, pty path)."""
+    if program == HOST_PROGRAM and not os.path.exists(program):
+        subprocess.run(["pio", "run", "-e", "native-station"], check=True, cwd=REPO)
+    proc = subprocess.Popen([program, "--pty"], stdout=subprocess.PIPE)
+    r, _, _ = select.select([proc.stdout], [], [], 5.0)
+    path = proc.stdout.readline().decode().strip() if r else ""
+    if not path.startswith("/dev/"):
+        proc.kill()
+        sys.exit("%s did not report a pseudo-terminal" % program)
+    return proc, path
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("port", nargs="?", help="serial device, e.g. /dev/ttyUSB0 (or a pty)")
+    ap.add_argument("commands", nargs="*", help="commands, sent in order")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--log", action="store_true", help="echo station log lines to stderr")
+    ap.add_argument("--watch", action="store_true", help="keep reading after the commands")
+    ap.add_argument("--csv", help="write decoded telemetry frames here")
+    ap.add_argument("--check", action="store_true", help="run the scripted command session")
+    ap.add_argument("--host", action="store_true",
+                    help="start the native build on a pty instead of opening a port")
+    ap.add_argument("--program", default=HOST_PROGRAM, help="native build for --host")
+    args = ap.parse_args()
+    if args.host:
+        if args.port:                           # no port: the first word is a command
+            args.commands.insert(0, args.port)
+        host, args.port = start_host(args.program)
+    elif not args.port:
+        ap.error("a port or --host is needed")
+    else:
+        host = None
+
+    try:
+        link = Link(args.port, args.baud, sys.stderr if args.log else None)
+        if args.check:
+            sys.exit(0 if run_check(link) else 1)
+        run_commands(link, args)
+    finally:
+        if host:
+            host.kill()
+            host.wait()
+
+
+def run_commands(link, args):
+    ok = True
+    for cmd in args.commands:
+        reply, detail = link.command(cmd)
+        for d in detail:
+            print("  " + d)
+        print(reply if reply is not None else "(no reply to '%s')" % cmd)
+        ok = ok and reply is not None and reply.startswith("ok")
+    if args.watch:
+        try:
+            for line in link.lines(float("inf")):
+                print(line)
+        except KeyboardInterrupt:
+            pass
+    if args.csv and link.frames:
+        with open(args.csv, "w", newline="") as f:
+            w = csv.DictWriter(f, fieldnames=list(link.frames[0].keys()))
+            w.writeheader()
+            w.writerows(link.frames)
+        print("# %d frames -> %s" % (len(link.frames), args.csv), file=sys.stderr)
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
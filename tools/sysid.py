@@ -0,0 +1,409 @@
+#!/usr/bin/env python3
+"""Fit plate models to recorded runs (see src/PlateEstimator.h).
+
+    tools/sysid.py run_00012.rec                       # fit both plates, print the report
+    tools/sysid.py run.bin --header src/SysidPlant.h   # telemetry capture -> C++ header
+    tools/sysid.py run.csv --limits limits.json        # "limits" for profile_pack.py
+
+Input is a run file from /runs (tools/run_reader.py), a raw telemetry
+capture (tools/telemetry_decode.py) or a CSV written by either. Samples are
+averaged into --dt bins (1 s). Characterization runs (Test at 100%, hold)
+give the best data, but any run where the duty moves will do.
+
+Per plate, with u = duty 0..1, fan = fan duty 0..1, Ta = ambient:
+  fopdt  dT/dt = g*u(t - dead) - (k + kf*fan)*(T - Ta)     PlantParams form
+  arx    T[n] = sum a_i*T[n-i] + sum b_j*u[n-nk-j+1] + c*fan*(T[n-1] - Ta) + d
+  so     ARX(2,1) read as plate + sensor lag: two time constants
+Dead times are searched up to --max-dead. Each model is scored on a
+free-run simulation from the first sample: fit% = 100*(1 - |y-yhat|/|y-mean|),
+RMSE and worst error in C, plus R2 of the regression itself.
+
+--header writes SYSID_PLANT_FRONT/BACK as PlantParams (the better of fopdt
+and so, among fits with positive gain and loss that beat the run's mean;
+a plate with neither fails the run), the fan loss and the ARX coefficients. Build with -DPLANT_SYSID
+to start the estimator from them (a /plant.mdl measured on the station
+still wins) and to use them as the REPLAY_PLANT simulator plates.
+"""
+import argparse
+import csv
+import json
+import math
+import operator
+import os
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from run_reader import read_run          # noqa: E402
+import telemetry_decode                  # noqa: E402
+
+PLATES = ("front", "back")
+
+
+# ---- Input ----
+def load(path):
+    """Return rows (t_s, t_front, t_back, duty_front, duty_back, fan_pct)."""
+    data = open(path, "rb").read()
+    if data[:4] == b"RRUN":
+        header, samples, errors = read_run(data)
+        for e in errors:
+            print("# warning: " + e, file=sys.stderr)
+        return [(s[0], s[1], s[2], s[4], s[5], s[6]) for s in samples]
+    if path.endswith(".csv"):
+        rows = []
+        for r in csv.DictReader(data.decode("utf-8", "replace").splitlines()):
+            rows.append(tuple(float(r[k]) for k in
+                              ("t_s", "t_front", "t_back", "duty_front", "duty_back", "fan_pct")))
+        return rows
+    rows = []
+    for rec in telemetry_decode.frames(data):
+        r = telemetry_decode.to_row(rec)
+        rows.append((r["t_s"], r["t_front"], r["t_back"], r["duty_front"], r["duty_back"], r["fan_pct"]))
+    return rows
+
+
+def resample(rows, dt):
+    """Average into dt bins; empty bins repeat the previous one."""
+    rows = sorted(rows)
+    t0 = rows[0][0]
+    out, acc, n, cur = [], [0.0] * 5, 0, 0
+    for r in rows:
+        b = int((r[0] - t0) / dt)
+        while b > cur:
+            if n:
+                out.append([a / n for a in acc])
+            elif out:
+                out.append(list(out[-1]))
+            acc, n, cur = [0.0] * 5, 0, cur + 1
+        for i in range(5):
+            acc[i] += r[i + 1]
+        n += 1
+    if n:
+        out.append([a / n for a in acc])
+    return out
+
+
+# ---- Least squares ----
+def solve(A, b):
+    """Gaussian elimination with partial pivoting; None if singular."""
+    n = len(b)
+    M = [list(A[i]) + [b[i]] for i in range(n)]
+    for c in range(n):
+        p = max(range(c, n), key=lambda r: abs(M[r][c]))
+        if abs(M[p][c]) < 1e-12 * max(1.0, max(abs(v) for v in M[p][:n])):
+            return None
+        M[c], M[p] = M[p], M[c]
+        for r in range(c + 1, n):
+            f = M[r][c] / M[c][c]
+            for k in range(c, n + 1):
+                M[r][k] -= f * M[c][k]
+    x = [0.0] * n
+    for r in range(n - 1, -1, -1):
+        x[r] = (M[r][n] - sum(M[r][k] * x[k] for k in range(r + 1, n))) / M[r][r]
+    return x
+
+
+def dot(a, b):
+    return sum(map(operator.mul, a, b))
+
+
+dot = getattr(math, "sumprod", dot)      # Python 3.12+, same result in C
+
+
+def lstsq(cols, y, inst=None):
+    """Fit y ~ cols; drops all-zero columns (their coefficient is 0). Returns (coef, r2).
+    With `inst` (one instrument per column) this is the instrumental-variable
+    estimate, which noise on lagged outputs does not bias."""
+    inst = inst or cols
+    keep = [i for i, c in enumerate(cols) if dot(c, c) > 1e-12]
+    A = [[dot(inst[i], cols[j]) for j in keep] for i in keep]
+    x = solve(A, [dot(inst[i], y) for i in keep])
+    if x is None:
+        return None, 0.0
+    coef = [0.0] * len(cols)
+    for i, v in zip(keep, x):
+        coef[i] = v
+    yhat = [0.0] * len(y)
+    for c, v in zip(cols, coef):
+        if v:
+            yhat = [a + v * b for a, b in zip(yhat, c)]
+    mean = sum(y) / len(y)
+    sst = sum((v - mean) ** 2 for v in y)
+    sse = sum((a - b) ** 2 for a, b in zip(y, yhat))
+    return coef, (1.0 - sse / sst) if sst > 0 else 0.0
+
+
+def score(y, yhat):
+    mean = sum(y) / len(y)
+    err = [a - b for a, b in zip(y, yhat)]
+    norm = math.sqrt(sum((v - mean) ** 2 for v in y)) or 1.0
+    return {"fit": 100.0 * (1.0 - math.sqrt(sum(e * e for e in err)) / norm),
+            "rmse": math.sqrt(sum(e * e for e in err) / len(err)),
+            "max_err": max(abs(e) for e in err)}
+
+
+# ---- Models ----
+def fit_fopdt(T, u, fan, ta, dt, max_dead):
+    n, dmax = len(T), int(max_dead / dt)
+    idx = range(max(dmax, 1), n - 1)
+    y = [(T[i + 1] - T[i - 1]) / (2 * dt) for i in idx]
+    loss = [-(T[i] - ta) for i in idx]
+    fanl = [-fan[i] * (T[i] - ta) for i in idx]
+    best = None
+    for d in range(dmax + 1):
+        ud = [u[i - d] for i in idx]
+        coef, r2 = lstsq([ud, loss, fanl], y)
+        if coef and (best is None or r2 > best["r2"]):
+            best = {"g": coef[0], "k": coef[1], "kf": coef[2], "dead": d * dt, "r2": r2}
+    if best is None:
+        return None
+    d = int(round(best["dead"] / dt))
+    sim = [T[0]]
+    for i in range(n - 1):
+        x = sim[-1]
+        sim.append(x + dt * (best["g"] * u[max(i - d, 0)] - (best["k"] + best["kf"] * fan[i]) * (x - ta)))
+    best.update(score(T, sim))
+    return best
+
+
+def arx_cols(T, u, fan, ta, na, nb, nk, idx):
+    cols = [[T[i - a] for i in idx] for a in range(1, na + 1)]
+    cols += [[u[i - nk - j] for i in idx] for j in range(nb)]
+    cols.append([fan[i - 1] * (T[i - 1] - ta) for i in idx])
+    cols.append([1.0] * len(idx))
+    return cols
+
+
+def arx_sim(T, u, fan, ta, m, start):
+    na, nb, nk = m["na"], m["nb"], m["nk"]
+    a, c = m["a"], m["c"]
+    # input part does not depend on the simulated output: one pass up front
+    n = len(T)
+    drive = [m["d"] - c * ta * f for f in fan[start - 1:n - 1]]
+    for j, b in enumerate(m["b"]):
+        drive = [v + b * x for v, x in zip(drive, u[start - nk - j:n - nk - j])]
+    sim = list(T[:start])
+    for i, v in enumerate(drive, start):
+        for k in range(na):
+            v += a[k] * sim[i - 1 - k]
+        v += c * fan[i - 1] * sim[i - 1]
+        if abs(v) > 1e4:                # unstable model, score it out
+            sim += [v] * (n - i)
+            break
+        sim.append(v)
+    return sim
+
+
+def fit_arx(T, u, fan, ta, dt, na, nb, nks, iv_passes=2):
+    """Least squares, then instrumental-variable passes with the model's own
+    simulated output as instruments (sensor noise biases plain ARX fast)."""
+    n = len(T)
+    best = None
+    for nk in nks:
+        start = max(na, nk + nb - 1, 1)
+        idx = range(start, n)
+        cols = arx_cols(T, u, fan, ta, na, nb, nk, idx)
+        y = [T[i] for i in idx]
+        coef, r2 = lstsq(cols, y)
+        m = None
+        for p in range(iv_passes + 1):
+            if coef is None:
+                break
+            cand = {"na": na, "nb": nb, "nk": nk, "a": coef[:na], "b": coef[na:na + nb],
+                    "c": coef[na + nb], "d": coef[-1], "r2": r2}
+            sim = arx_sim(T, u, fan, ta, cand, start)
+            cand.update(score(T, sim))
+            if m is None or cand["fit"] > m["fit"]:
+                m = cand
+            if p < iv_passes:
+                coef, r2 = lstsq(cols, y, arx_cols(sim, u, fan, ta, na, nb, nk, idx))
+        if m and (best is None or m["fit"] > best["fit"]):
+            best = m
+    return best
+
+
+def so_params(arx, dt):
+    """ARX(2,1) as plate + sensor lag: PlantParams-style values, or None."""
+    a1, a2 = arx["a"]
+    disc = a1 * a1 + 4 * a2
+    if disc < 0:
+        return None
+    z = sorted(((a1 - math.sqrt(disc)) / 2, (a1 + math.sqrt(disc)) / 2))
+    if not (0 < z[0] < 1 and 0 < z[1] < 1):
+        return None
+    tau_fast, tau_slow = -dt / math.log(z[0]), -dt / math.log(z[1])
+    gain = sum(arx["b"]) / (1 - a1 - a2)          # C per unit duty, steady state
+    return {"g": gain / tau_slow, "k": 1 / tau_slow, "sensor_tau": tau_fast + (arx["nk"] - 1) * dt,
+            "tau_fast": tau_fast, "tau_slow": tau_slow}
+
+
+def fit_plate(T, u, fan, ta, dt, max_dead, arx_order):
+    fo = fit_fopdt(T, u, fan, ta, dt, max_dead)
+    nk0 = int(round(fo["dead"] / dt)) + 1 if fo else 1
+    nks = [k for k in range(nk0 - 2, nk0 + 3) if k >= 1]
+    arx = fit_arx(T, u, fan, ta, dt, arx_order[0], arx_order[1], nks)
+    so = fit_arx(T, u, fan, ta, dt, 2, 1, nks)
+    if so:
+        so["plant"] = so_params(so, dt)
+    return {"fopdt": fo, "arx": arx, "so": so}
+
+
+def physical(m, p):
+    """A plate heats with duty and loses heat to ambient, and the model
+    tracks the run better than its mean does."""
+    return p["g"] > 0 and p["k"] > 0 and m["fit"] > 0
+
+
+def plant_of(fit, ta):
+    """Best physical fopdt / so as (heatGain, lossCoef, sensorTau, ambientC, source)."""
+    fo, so = fit["fopdt"], fit["so"]
+    cands = []
+    if fo and physical(fo, fo):
+        cands.append((fo["fit"], (fo["g"], fo["k"], max(fo["dead"], 1.0), ta, "fopdt")))
+    if so and so.get("plant") and physical(so, so["plant"]):
+        p = so["plant"]
+        cands.append((so["fit"], (p["g"], p["k"], max(p["sensor_tau"], 1.0), ta, "so")))
+    return max(cands)[1] if cands else None
+
+
+# ---- Output ----
+def report(name, fit, ta):
+    fo, arx, so = fit["fopdt"], fit["arx"], fit["so"]
+    print("== %s plate (ambient %.1f C)" % (name, ta))
+    if fo:
+        if fo["k"] > 0:
+            lag = "K=%.0f C  tau=%.0f s" % (fo["g"] / fo["k"], 1 / fo["k"])
+        else:
+            lag = "K, tau: no heat loss"
+        print("  fopdt  g=%.3f C/s  k=%.5f /s  kf=%.5f /s  dead=%.0f s  %s"
+              % (fo["g"], fo["k"], fo["kf"], fo["dead"], lag))
+        print("         fit %.1f%%  rmse %.2f C  max %.1f C  R2 %.3f" % (fo["fit"], fo["rmse"], fo["max_err"], fo["r2"]))
+        if not physical(fo, fo):
+            print("         WARNING: not a physical plant, not used")
+    if arx:
+        print("  arx(%d,%d,%d) a=%s b=%s c=%.5f d=%.4f" % (arx["na"], arx["nb"], arx["nk"],
+              ["%.5f" % v for v in arx["a"]], ["%.5f" % v for v in arx["b"]], arx["c"], arx["d"]))
+        print("         fit %.1f%%  rmse %.2f C  max %.1f C  R2 %.5f" % (arx["fit"], arx["rmse"], arx["max_err"], arx["r2"]))
+    if so:
+        p = so.get("plant")
+        if p:
+            print("  so     taus %.1f / %.0f s  g=%.3f C/s  k=%.5f /s  sensor lag %.1f s"
+                  % (p["tau_fast"], p["tau_slow"], p["g"], p["k"], p["sensor_tau"]))
+        else:
+            print("  so     poles not two real lags, no plant form")
+        print("         fit %.1f%%  rmse %.2f C  max %.1f C" % (so["fit"], so["rmse"], so["max_err"]))
+        if p and not physical(so, p):
+            print("         WARNING: not a physical plant, not used")
+
+
+def c_float(v):
+    return "%.6gf" % v if "." in "%.6g" % v or "e" in "%.6g" % v else "%.6g.0f" % v
+
+
+def write_header(path, src, fits, plants, dt):
+    L = ["// Generated by tools/sysid.py from %s - regenerate rather than edit." % os.path.basename(src),
+         "// Used with -DPLANT_SYSID (estimator start values, REPLAY_PLANT plates).",
+         "#pragma once",
+         '#include "PlateEstimator.h"',
+         "",
+         "#define SYSID_DT_S %s" % c_float(dt),
+         "",
+         "// PlantParams {heatGain, lossCoef, sensorTau, ambientC}"]
+    for name in PLATES:
+        p = plants[name]
+        sc = fits[name][p[4]]
+        L.append("// %s: %s, fit %.1f%%, rmse %.2f C" % (name, p[4], sc["fit"], sc["rmse"]))
+    for name in PLATES:
+        p = plants[name]
+        L.append("static const PlantParams SYSID_PLANT_%s = {%s, %s, %s, %s};"
+                 % (name.upper(), c_float(p[0]), c_float(p[1]), c_float(p[2]), c_float(p[3])))
+    L.append("// 1/s added to lossCoef with the fan at 100%")
+    for name in PLATES:
+        fo = fits[name]["fopdt"]
+        L.append("static const float SYSID_FAN_LOSS_%s = %s;" % (name.upper(), c_float(max(fo["kf"], 0.0) if fo else 0.0)))
+    arx = fits[PLATES[0]]["arx"]
+    L += ["",
+          "// ARX at SYSID_DT_S, u = duty 0..1, fan 0..1:",
+          "//   T[n] = sum A[i]*T[n-1-i] + sum B[j]*u[n-NK-j] + C*fan*(T[n-1] - ambient) + D",
+          "#define SYSID_ARX_NA %d" % arx["na"],
+          "#define SYSID_ARX_NB %d" % arx["nb"]]
+    for name in PLATES:
+        a = fits[name]["arx"]
+        N = name.upper()
+        L += ["static const uint8_t SYSID_ARX_NK_%s = %d;" % (N, a["nk"]),
+              "static const float SYSID_ARX_A_%s[SYSID_ARX_NA] = {%s};" % (N, ", ".join(c_float(v) for v in a["a"])),
+              "static const float SYSID_ARX_B_%s[SYSID_ARX_NB] = {%s};" % (N, ", ".join(c_float(v) for v in a["b"])),
+              "static const float SYSID_ARX_C_%s = %s, SYSID_ARX_D_%s = %s;" % (N, c_float(a["c"]), N, c_float(a["d"]))]
+    with open(path, "w") as f:
+        f.write("\n".join(L) + "\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("input", help=".rec run file, raw telemetry capture or CSV")
+    ap.add_argument("--dt", type=float, default=1.0, help="sample period for the fit, s")
+    ap.add_argument("--ambient", type=float, help="ambient C (default: coldest early reading, else 25)")
+    ap.add_argument("--max-dead", type=float, default=15.0, help="longest dead time searched, s")
+    ap.add_argument("--arx", default="2,2", help="ARX orders na,nb")
+    ap.add_argument("--from", dest="t_from", type=float, default=0.0, help="skip the first seconds")
+    ap.add_argument("--to", dest="t_to", type=float, help="stop at this many seconds")
+    ap.add_argument("--header", help="write the C++ coefficient header here")
+    ap.add_argument("--limits", help="write profile_pack.py plate limits (JSON) here")
+    args = ap.parse_args()
+
+    t_start = time.perf_counter()
+    rows = load(args.input)
+    if rows:
+        t0 = min(r[0] for r in rows)
+        rows = [r for r in rows if r[0] - t0 >= args.t_from and (args.t_to is None or r[0] - t0 <= args.t_to)]
+    if len(rows) < 60:
+        sys.exit("%s: %d samples, need at least 60" % (args.input, len(rows)))
+    data = resample(rows, args.dt)
+    t_load = time.perf_counter()
+
+    cols = list(zip(*data))     # t_front, t_back, duty_front, duty_back, fan_pct
+    fan = [v / 100.0 for v in cols[4]]
+    if args.ambient is not None:
+        ta = args.ambient
+    else:
+        early = min(min(cols[0][:10]), min(cols[1][:10]))
+        ta = early if early < 35.0 else 25.0
+    na, nb = (int(v) for v in args.arx.split(","))
+
+    fits, plants = {}, {}
+    for p, name in enumerate(PLATES):
+        T = list(cols[p])
+        u = [v / 100.0 for v in cols[2 + p]]
+        if max(u) - min(u) < 0.05:
+            print("# %s: duty never moves, no fit" % name, file=sys.stderr)
+            continue
+        fits[name] = fit_plate(T, u, fan, ta, args.dt, args.max_dead, (na, nb))
+        plants[name] = plant_of(fits[name], ta)
+    t_fit = time.perf_counter()
+
+    for name in PLATES:
+        if name in fits:
+            report(name, fits[name], ta)
+    print("# %d samples at %.1f s, load %.0f ms, fit %.0f ms" % (len(data), args.dt,
+          (t_load - t_start) * 1e3, (t_fit - t_load) * 1e3), file=sys.stderr)
+
+    bad = [n for n in fits if not plants[n]]
+    if bad:
+        sys.exit("%s: no physical plant model (positive gain and loss, fit above 0%%)" % ", ".join(bad))
+    complete = all(plants.get(n) for n in PLATES)
+    if (args.header or args.limits) and not complete:
+        sys.exit("both plates need a usable model for --header / --limits")
+    if args.header:
+        write_header(args.header, args.input, fits, plants, args.dt)
+    if args.limits:
+        lim = {n: {"heat_gain": round(plants[n][0], 4), "loss_coef": round(plants[n][1], 6),
+                   "ambient": round(ta, 1)} for n in PLATES}
+        kf = [fits[n]["fopdt"]["kf"] if fits[n]["fopdt"] else 0.0 for n in PLATES]
+        if min(kf) > 0:
+            lim["fan_loss_coef"] = round(min(kf), 6)     # the slower plate bounds cooling
+        with open(args.limits, "w") as f:
+            json.dump({"limits": lim}, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""Decode a captured telemetry stream (see src/Telemetry.h) to CSV and columns.
+
+Capture the raw UART bytes first, e.g.
+    pio device monitor --raw > run.bin      (or: cat /dev/ttyUSB0 > run.bin)
+then
+    tools/telemetry_decode.py run.bin -o run.csv --columns run_cols
+
+Log text that shares the UART is passed through to stderr with --text.
+The column directory holds one little-endian array per field (<name>.bin)
+plus schema.json, so numpy.fromfile / pandas can load any subset quickly.
+"""
+import argparse
+import csv
+import json
+import os
+import struct
+import sys
+
+VERSION = 1
+# Mirrors TelemetryFrame (packed, little-endian)
+FIELDS = [
+    ("version", "B"), ("mode", "B"), ("seq", "H"), ("t_ms", "I"),
+    ("raw_front", "H"), ("raw_back", "H"),
+    ("t_front_cc", "h"), ("t_back_cc", "h"), ("setpoint_cc", "h"),
+    ("duty_front", "B"), ("duty_back", "B"), ("fan_pct", "B"),
+    ("flags", "B"), ("loop_us", "H"),
+]
+FRAME = struct.Struct("<" + "".join(f for _, f in FIELDS))
+MODES = ["MENU", "PROF_SETUP", "PROFILE_RUN", "CONST_SETUP", "CONST_RUN", "TEST_RUN", "COOL_TEST", "DIAG", "FAULT",
+         "CHARACTERIZE"]
+FLAGS = [(0x01, "fan_on"), (0x02, "cooling"), (0x04, "running"), (0x08, "sensor_err"), (0x10, "manual_fan"),
+         (0x20, "fan_stall"), (0x40, "fan_degraded")]
+NUMPY_TYPES = {"B": "uint8", "H": "uint16", "h": "int16", "I": "uint32", "f": "float32"}
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def frames(stream, text_out=None):
+    """Yield decoded frame tuples; count and skip anything that fails."""
+    stats = {"frames": 0, "bad": 0}
+    for chunk in stream.split(b"\x00"):
+        if not chunk:
+            continue
+        raw = cobs_decode(chunk)
+        if raw is None or len(raw) != FRAME.size + 2 or \
+                crc16(raw[:-2]) != struct.unpack_from("<H", raw, FRAME.size)[0]:
+            if text_out is not None and all(32 <= c < 127 or c in (9, 10, 13) for c in chunk):
+                text_out.write(chunk.decode("ascii"))
+            else:
+                stats["bad"] += 1
+            continue
+        rec = FRAME.unpack_from(raw)
+        if rec[0] != VERSION:
+            stats["bad"] += 1
+            continue
+        stats["frames"] += 1
+        yield rec
+    frames.stats = stats
+
+
+def to_row(rec):
+    d = dict(zip((n for n, _ in FIELDS), rec))
+    row = {
+        "t_s": d["t_ms"] / 1000.0,
+        "seq": d["seq"],
+        "mode": MODES[d["mode"]] if d["mode"] < len(MODES) else d["mode"],
+        "raw_front": d["raw_front"], "raw_back": d["raw_back"],
+        "t_front": d["t_front_cc"] / 100.0, "t_back": d["t_back_cc"] / 100.0,
+        "setpoint": d["setpoint_cc"] / 100.0,
+        "duty_front": d["duty_front"], "duty_back": d["duty_back"],
+        "fan_pct": d["fan_pct"], "loop_us": d["loop_us"],
+    }
+    for bit, name in FLAGS:
+        row[name] = int(bool(d["flags"] & bit))
+    return row
+
+
+def write_columns(path, recs):
+    os.makedirs(path, exist_ok=True)
+    schema = {"version": VERSION, "rows": len(recs), "columns": {}}
+    for idx, (name, fmt) in enumerate(FIELDS):
+        with open(os.path.join(path, name + ".bin"), "wb") as f:
+            f.write(struct.pack("<%d%s" % (len(recs), fmt), *(r[idx] for r in recs)))
+        schema["columns"][name] = NUMPY_TYPES[fmt]
+    with open(os.path.join(path, "schema.json"), "w") as f:
+        json.dump(schema, f, indent=2)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("capture", help="raw capture file, '-' for stdin")
+    ap.add_argument("-o", "--csv", help="CSV output (default stdout)")
+    ap.add_argument("--columns", help="directory for columnar output")
+    ap.add_argument("--text", action="store_true", help="echo interleaved log text to stderr")
+    args = ap.parse_args()
+
+    data = sys.stdin.buffer.read() if args.capture == "-" else open(args.capture, "rb").read()
+    recs = list(frames(data, sys.stderr if args.text else None))
+    rows = [to_row(r) for r in recs]
+
+    out = open(args.csv, "w", newline="") if args.csv else sys.stdout
+    if rows:
+        w = csv.DictWriter(out, fieldnames=list(rows[0].keys()))
+        w.writeheader()
+        w.writerows(rows)
+    if args.columns:
+        write_columns(args.columns, recs)
+
+    gaps = sum((b[2] - a[2] - 1) & 0xFFFF for a, b in zip(recs, recs[1:]))
+    print("frames=%d bad=%d seq_gaps=%d" % (frames.stats["frames"], frames.stats["bad"], gaps),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()